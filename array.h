@@ -163,6 +163,14 @@ Type* PushResize(Array<Type>* array, uint32 additional_space) {
     return PushResize(array, {}, additional_space);
 }
 
+template<typename Type>
+Type* PushResizeNZ(Array<Type>* array, Type elem, uint32 additional_space) {
+    if (!CanPush(array, 1)) {
+        ResizeNZ(array, array->size + additional_space);
+    }
+    return Push(array, elem);
+}
+
 template<typename Type>
 void PushRange(Array<Type>* array, const Type* data, uint32 data_size) {
     if (data_size == 0) {
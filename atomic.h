@@ -0,0 +1,51 @@
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 CACHE_LINE_SIZE = 64;
+
+struct Backoff {
+    uint32 count;
+};
+
+/// Interface
+////////////////////////////////////////////////////////////
+
+// x86 doesn't reorder loads with other loads or stores with other stores, so a compiler barrier is all that's needed
+// for acquire loads and release stores.
+uint32 AtomicLoad(volatile uint32* ptr) {
+    uint32 val = *ptr;
+    _ReadWriteBarrier();
+    return val;
+}
+
+void AtomicStore(volatile uint32* ptr, uint32 val) {
+    _ReadWriteBarrier();
+    *ptr = val;
+}
+
+// Returns value at ptr before exchange; exchange succeeded if return value == comparand.
+uint32 AtomicCompareExchange(volatile uint32* ptr, uint32 exchange, uint32 comparand) {
+    return (uint32)InterlockedCompareExchange((volatile LONG*)ptr, (LONG)exchange, (LONG)comparand);
+}
+
+// Returns value at ptr before add.
+uint32 AtomicAdd(volatile uint32* ptr, uint32 val) {
+    return (uint32)InterlockedExchangeAdd((volatile LONG*)ptr, (LONG)val);
+}
+
+void Spin(Backoff* backoff) {
+    constexpr uint32 MAX_PAUSE_SHIFT = 6;
+    if (backoff->count <= MAX_PAUSE_SHIFT) {
+        for (uint32 i = 0; i < (1u << backoff->count); i += 1) {
+            _mm_pause();
+        }
+        backoff->count += 1;
+    }
+    else {
+        // Spun long enough; give up time slice to other threads.
+        SwitchToThread();
+    }
+}
+
+void Reset(Backoff* backoff) {
+    backoff->count = 0;
+}
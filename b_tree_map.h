@@ -0,0 +1,252 @@
+/// Macros
+////////////////////////////////////////////////////////////
+#define CTK_ITER_BTREE(VAR, MAP) \
+    for (auto VAR = GetFirst(MAP); \
+         IsValid(&VAR); \
+         Next(&VAR))
+
+/// Data
+////////////////////////////////////////////////////////////
+
+// Keys per node are sized so a node's keys fill one cache line, making each per-node search a single line read.
+template<typename Key>
+constexpr uint32 BTREE_NODE_KEY_COUNT = CACHE_LINE_SIZE / sizeof(Key) >= 4 ? CACHE_LINE_SIZE / sizeof(Key) : 4;
+
+// Internal nodes hold separator keys and children; leaves hold keys, values and a link to the next leaf, so in-order
+// and range iteration walk leaves directly without revisiting internal nodes.
+template<typename Key, typename Value>
+struct BTreeNode {
+    alignas(CACHE_LINE_SIZE) Key keys[BTREE_NODE_KEY_COUNT<Key>];
+    uint32 count;
+    bool   leaf;
+    union {
+        BTreeNode* children[BTREE_NODE_KEY_COUNT<Key> + 1];
+        struct {
+            Value      values[BTREE_NODE_KEY_COUNT<Key>];
+            BTreeNode* next;
+        };
+    };
+};
+
+// B+tree: O(log n) insert, remove and lookup. Full nodes are split on the way down during inserts, so inserts never
+// have to walk back up the tree. Removal doesn't merge underfull nodes; trees that shrink substantially should be
+// rebuilt.
+template<typename Key, typename Value>
+struct BTreeMap {
+    Allocator*             allocator;
+    BTreeNode<Key, Value>* root;
+    BTreeNode<Key, Value>* first_leaf;
+    uint32                 count;
+};
+
+template<typename Key, typename Value>
+struct BTreeCursor {
+    BTreeNode<Key, Value>* leaf;
+    uint32                 index;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+template<typename Key, typename Value>
+BTreeNode<Key, Value>* CreateBTreeNode(Allocator* allocator, bool leaf) {
+    auto node = AllocateNZ<BTreeNode<Key, Value>>(allocator, 1);
+    node->count = 0;
+    node->leaf  = leaf;
+    if (leaf) {
+        node->next = NULL;
+    }
+    return node;
+}
+
+template<typename Key, typename Value>
+void DestroyBTreeNode(Allocator* allocator, BTreeNode<Key, Value>* node) {
+    if (!node->leaf) {
+        for (uint32 i = 0; i <= node->count; i += 1) {
+            DestroyBTreeNode(allocator, node->children[i]);
+        }
+    }
+    Deallocate(allocator, node);
+}
+
+template<typename Key, typename Value>
+BTreeNode<Key, Value>* FindLeaf(BTreeMap<Key, Value>* map, Key key) {
+    BTreeNode<Key, Value>* node = map->root;
+    while (!node->leaf) {
+        // Separators are the first key of their right subtree, so keys equal to a separator go right.
+        node = node->children[UpperBound(node->keys, node->count, key)];
+    }
+    return node;
+}
+
+// Splits parent's full child at child_index, moving its upper half into a new node and inserting the separator into
+// parent (which must not be full).
+template<typename Key, typename Value>
+void SplitChild(Allocator* allocator, BTreeNode<Key, Value>* parent, uint32 child_index) {
+    constexpr uint32 KEY_COUNT = BTREE_NODE_KEY_COUNT<Key>;
+    constexpr uint32 MID       = KEY_COUNT / 2;
+
+    BTreeNode<Key, Value>* child = parent->children[child_index];
+    BTreeNode<Key, Value>* sibling = CreateBTreeNode<Key, Value>(allocator, child->leaf);
+    Key separator = {};
+    if (child->leaf) {
+        // Leaf separators are copied up; the key stays in the right leaf.
+        sibling->count = KEY_COUNT - MID;
+        memcpy(sibling->keys,   &child->keys  [MID], sibling->count * sizeof(Key));
+        memcpy(sibling->values, &child->values[MID], sibling->count * sizeof(Value));
+        sibling->next = child->next;
+        child->next   = sibling;
+        separator = sibling->keys[0];
+    }
+    else {
+        // Internal separators are moved up.
+        sibling->count = KEY_COUNT - MID - 1;
+        memcpy(sibling->keys,     &child->keys    [MID + 1], sibling->count * sizeof(Key));
+        memcpy(sibling->children, &child->children[MID + 1], (sibling->count + 1) * sizeof(BTreeNode<Key, Value>*));
+        separator = child->keys[MID];
+    }
+    child->count = MID;
+
+    memmove(&parent->keys[child_index + 1], &parent->keys[child_index],
+            (parent->count - child_index) * sizeof(Key));
+    memmove(&parent->children[child_index + 2], &parent->children[child_index + 1],
+            (parent->count - child_index) * sizeof(BTreeNode<Key, Value>*));
+    parent->keys    [child_index]     = separator;
+    parent->children[child_index + 1] = sibling;
+    parent->count += 1;
+}
+
+// Skips empty leaves left behind by removals.
+template<typename Key, typename Value>
+void SkipExhaustedLeaves(BTreeCursor<Key, Value>* cursor) {
+    while (cursor->leaf != NULL && cursor->index >= cursor->leaf->count) {
+        cursor->leaf  = cursor->leaf->next;
+        cursor->index = 0;
+    }
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+template<typename Key, typename Value>
+BTreeMap<Key, Value> CreateBTreeMap(Allocator* allocator) {
+    BTreeMap<Key, Value> map = {};
+    map.allocator  = allocator;
+    map.root       = CreateBTreeNode<Key, Value>(allocator, true);
+    map.first_leaf = map.root;
+    map.count      = 0;
+    return map;
+}
+
+template<typename Key, typename Value>
+void DestroyBTreeMap(BTreeMap<Key, Value>* map) {
+    CTK_ASSERT(map->allocator != NULL);
+
+    DestroyBTreeNode(map->allocator, map->root);
+    *map = {};
+}
+
+template<typename Key, typename Value>
+Value* FindValue(BTreeMap<Key, Value>* map, Key key) {
+    BTreeNode<Key, Value>* leaf = FindLeaf(map, key);
+    uint32 index = LowerBound(leaf->keys, leaf->count, key);
+    return index < leaf->count && !(key < leaf->keys[index]) ? &leaf->values[index] : NULL;
+}
+
+template<typename Key, typename Value>
+Value* Insert(BTreeMap<Key, Value>* map, Key key, Value value) {
+    constexpr uint32 KEY_COUNT = BTREE_NODE_KEY_COUNT<Key>;
+
+    if (FindValue(map, key) != NULL) {
+        CTK_FATAL("can't insert key/value pair into b-tree map: key already exists in map");
+    }
+
+    if (map->root->count == KEY_COUNT) {
+        BTreeNode<Key, Value>* new_root = CreateBTreeNode<Key, Value>(map->allocator, false);
+        new_root->children[0] = map->root;
+        map->root = new_root;
+        SplitChild(map->allocator, new_root, 0);
+    }
+
+    BTreeNode<Key, Value>* node = map->root;
+    while (!node->leaf) {
+        uint32 child_index = UpperBound(node->keys, node->count, key);
+        if (node->children[child_index]->count == KEY_COUNT) {
+            SplitChild(map->allocator, node, child_index);
+            if (!(key < node->keys[child_index])) {
+                child_index += 1;
+            }
+        }
+        node = node->children[child_index];
+    }
+
+    uint32 index = LowerBound(node->keys, node->count, key);
+    memmove(&node->keys  [index + 1], &node->keys  [index], (node->count - index) * sizeof(Key));
+    memmove(&node->values[index + 1], &node->values[index], (node->count - index) * sizeof(Value));
+    node->keys[index] = key;
+    Value* new_value = &node->values[index];
+    *new_value = value;
+    node->count += 1;
+    map->count += 1;
+    return new_value;
+}
+
+template<typename Key, typename Value>
+Value* Insert(BTreeMap<Key, Value>* map, Key key) {
+    return Insert(map, key, {});
+}
+
+template<typename Key, typename Value>
+void Remove(BTreeMap<Key, Value>* map, Key key) {
+    BTreeNode<Key, Value>* leaf = FindLeaf(map, key);
+    uint32 index = LowerBound(leaf->keys, leaf->count, key);
+    if (index == leaf->count || key < leaf->keys[index]) {
+        CTK_FATAL("can't remove b-tree map entry with key: key does not exist in map");
+    }
+
+    memmove(&leaf->keys  [index], &leaf->keys  [index + 1], (leaf->count - index - 1) * sizeof(Key));
+    memmove(&leaf->values[index], &leaf->values[index + 1], (leaf->count - index - 1) * sizeof(Value));
+    leaf->count -= 1;
+    map->count -= 1;
+}
+
+template<typename Key, typename Value>
+BTreeCursor<Key, Value> GetFirst(BTreeMap<Key, Value>* map) {
+    BTreeCursor<Key, Value> cursor = { .leaf = map->first_leaf, .index = 0 };
+    SkipExhaustedLeaves(&cursor);
+    return cursor;
+}
+
+// Cursor at first entry with key >= key; iterate with Next() while GetKey(&cursor) < max_key for range queries.
+template<typename Key, typename Value>
+BTreeCursor<Key, Value> LowerBound(BTreeMap<Key, Value>* map, Key key) {
+    BTreeNode<Key, Value>* leaf = FindLeaf(map, key);
+    BTreeCursor<Key, Value> cursor = { .leaf = leaf, .index = LowerBound(leaf->keys, leaf->count, key) };
+    SkipExhaustedLeaves(&cursor);
+    return cursor;
+}
+
+template<typename Key, typename Value>
+bool IsValid(BTreeCursor<Key, Value>* cursor) {
+    return cursor->leaf != NULL;
+}
+
+template<typename Key, typename Value>
+void Next(BTreeCursor<Key, Value>* cursor) {
+    CTK_ASSERT(IsValid(cursor));
+
+    cursor->index += 1;
+    SkipExhaustedLeaves(cursor);
+}
+
+template<typename Key, typename Value>
+Key GetKey(BTreeCursor<Key, Value>* cursor) {
+    CTK_ASSERT(IsValid(cursor));
+
+    return cursor->leaf->keys[cursor->index];
+}
+
+template<typename Key, typename Value>
+Value* GetValue(BTreeCursor<Key, Value>* cursor) {
+    CTK_ASSERT(IsValid(cursor));
+
+    return &cursor->leaf->values[cursor->index];
+}
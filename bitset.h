@@ -0,0 +1,295 @@
+/// Macros
+////////////////////////////////////////////////////////////
+#define CTK_ITER_BITS(VAR, BITSET) \
+    for (uint32 VAR = FindFirstSet(BITSET); \
+         VAR < GetBitCount(BITSET); \
+         VAR = FindNextSet(BITSET, VAR + 1))
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 BITSET_WORD_BITS = 64;
+
+constexpr uint32 GetBitsetWordCount(uint32 bit_count) {
+    return (bit_count + (BITSET_WORD_BITS - 1)) / BITSET_WORD_BITS;
+}
+
+// Bits past bit_count in the last word are always kept clear, so whole-word operations (popcount, find, etc.) never
+// need to mask them out.
+template<uint32 bit_count>
+struct FBitset {
+    uint64 words[GetBitsetWordCount(bit_count)];
+};
+
+struct Bitset {
+    Allocator* allocator;
+    uint64*    words;
+    uint32     word_count;
+    uint32     bit_count;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+uint64 GetLastWordMask(uint32 bit_count) {
+    uint32 last_word_bits = bit_count % BITSET_WORD_BITS;
+    return last_word_bits == 0 ? UINT64_MAX : (1ull << last_word_bits) - 1;
+}
+
+void SetBit(uint64* words, uint32 index) {
+    words[index / BITSET_WORD_BITS] |= 1ull << (index % BITSET_WORD_BITS);
+}
+
+void ClearBit(uint64* words, uint32 index) {
+    words[index / BITSET_WORD_BITS] &= ~(1ull << (index % BITSET_WORD_BITS));
+}
+
+bool TestBit(const uint64* words, uint32 index) {
+    return (words[index / BITSET_WORD_BITS] & (1ull << (index % BITSET_WORD_BITS))) != 0;
+}
+
+void SetAllBits(uint64* words, uint32 bit_count) {
+    uint32 word_count = GetBitsetWordCount(bit_count);
+    memset(words, 0xFF, word_count * sizeof(uint64));
+    words[word_count - 1] &= GetLastWordMask(bit_count);
+}
+
+// Returns bit_count if no bits at or after start are set.
+uint32 FindNextSet(const uint64* words, uint32 bit_count, uint32 start) {
+    if (start >= bit_count) {
+        return bit_count;
+    }
+
+    uint32 word_count = GetBitsetWordCount(bit_count);
+    uint32 word_index = start / BITSET_WORD_BITS;
+    uint64 word = words[word_index] & (UINT64_MAX << (start % BITSET_WORD_BITS));
+    while (word == 0) {
+        word_index += 1;
+        if (word_index == word_count) {
+            return bit_count;
+        }
+        word = words[word_index];
+    }
+
+    return (word_index * BITSET_WORD_BITS) + CountTrailingZeros(word);
+}
+
+// AVX2 path uses nibble lookup via vpshufb and sums byte counts with vpsadbw, counting 256 bits per iteration.
+uint32 CountSetBits(const uint64* words, uint32 word_count) {
+    uint64 count = 0;
+    uint32 i = 0;
+
+    if (HasAVX2()) {
+        __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                          0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        __m256i low_mask = _mm256_set1_epi8(0x0F);
+        __m256i zero     = _mm256_setzero_si256();
+        __m256i sums     = _mm256_setzero_si256();
+        for (; i + 4 <= word_count; i += 4) {
+            __m256i vec = _mm256_loadu_si256((const __m256i*)&words[i]);
+            __m256i low  = _mm256_and_si256(vec, low_mask);
+            __m256i high = _mm256_and_si256(_mm256_srli_epi16(vec, 4), low_mask);
+            __m256i byte_counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low),
+                                                  _mm256_shuffle_epi8(lookup, high));
+            sums = _mm256_add_epi64(sums, _mm256_sad_epu8(byte_counts, zero));
+        }
+        count += (uint64)_mm256_extract_epi64(sums, 0) + (uint64)_mm256_extract_epi64(sums, 1) +
+                 (uint64)_mm256_extract_epi64(sums, 2) + (uint64)_mm256_extract_epi64(sums, 3);
+    }
+
+    for (; i < word_count; i += 1) {
+        count += PopCount(words[i]);
+    }
+
+    return (uint32)count;
+}
+
+// Generates NAME##Words(dst, a, b, word_count) over raw word ranges; dst may alias a or b. Kernels process 4 words per
+// iteration with AVX2 when available, otherwise 2 words with SSE2.
+#define CTK_BITSET_OP_FUNC(NAME, SCALAR_OP, SSE_OP, AVX2_OP) \
+void NAME##Words(uint64* dst, const uint64* a, const uint64* b, uint32 word_count) { \
+    uint32 i = 0; \
+    if (HasAVX2()) { \
+        for (; i + 4 <= word_count; i += 4) { \
+            __m256i a_vec = _mm256_loadu_si256((const __m256i*)&a[i]); \
+            __m256i b_vec = _mm256_loadu_si256((const __m256i*)&b[i]); \
+            _mm256_storeu_si256((__m256i*)&dst[i], AVX2_OP); \
+        } \
+    } \
+    for (; i + 2 <= word_count; i += 2) { \
+        __m128i a_vec = _mm_loadu_si128((const __m128i*)&a[i]); \
+        __m128i b_vec = _mm_loadu_si128((const __m128i*)&b[i]); \
+        _mm_storeu_si128((__m128i*)&dst[i], SSE_OP); \
+    } \
+    for (; i < word_count; i += 1) { \
+        uint64 a_word = a[i]; \
+        uint64 b_word = b[i]; \
+        dst[i] = SCALAR_OP; \
+    } \
+}
+CTK_BITSET_OP_FUNC(And,    a_word & b_word,  _mm_and_si128(a_vec, b_vec),    _mm256_and_si256(a_vec, b_vec))
+CTK_BITSET_OP_FUNC(Or,     a_word | b_word,  _mm_or_si128(a_vec, b_vec),     _mm256_or_si256(a_vec, b_vec))
+CTK_BITSET_OP_FUNC(Xor,    a_word ^ b_word,  _mm_xor_si128(a_vec, b_vec),    _mm256_xor_si256(a_vec, b_vec))
+CTK_BITSET_OP_FUNC(AndNot, a_word & ~b_word, _mm_andnot_si128(b_vec, a_vec), _mm256_andnot_si256(b_vec, a_vec))
+
+/// FBitset Interface
+////////////////////////////////////////////////////////////
+template<uint32 bit_count>
+uint32 GetBitCount(FBitset<bit_count>* bitset) {
+    return bit_count;
+}
+
+template<uint32 bit_count>
+void SetBit(FBitset<bit_count>* bitset, uint32 index) {
+    CTK_ASSERT(index < bit_count);
+
+    SetBit(bitset->words, index);
+}
+
+template<uint32 bit_count>
+void ClearBit(FBitset<bit_count>* bitset, uint32 index) {
+    CTK_ASSERT(index < bit_count);
+
+    ClearBit(bitset->words, index);
+}
+
+template<uint32 bit_count>
+bool TestBit(FBitset<bit_count>* bitset, uint32 index) {
+    CTK_ASSERT(index < bit_count);
+
+    return TestBit(bitset->words, index);
+}
+
+template<uint32 bit_count>
+void SetAll(FBitset<bit_count>* bitset) {
+    SetAllBits(bitset->words, bit_count);
+}
+
+template<uint32 bit_count>
+void Clear(FBitset<bit_count>* bitset) {
+    memset(bitset->words, 0, sizeof(bitset->words));
+}
+
+template<uint32 bit_count>
+uint32 FindFirstSet(FBitset<bit_count>* bitset) {
+    return FindNextSet(bitset->words, bit_count, 0);
+}
+
+template<uint32 bit_count>
+uint32 FindNextSet(FBitset<bit_count>* bitset, uint32 start) {
+    return FindNextSet(bitset->words, bit_count, start);
+}
+
+template<uint32 bit_count>
+uint32 CountSetBits(FBitset<bit_count>* bitset) {
+    return CountSetBits(bitset->words, GetBitsetWordCount(bit_count));
+}
+
+template<uint32 bit_count>
+void And(FBitset<bit_count>* dst, FBitset<bit_count>* a, FBitset<bit_count>* b) {
+    AndWords(dst->words, a->words, b->words, GetBitsetWordCount(bit_count));
+}
+
+template<uint32 bit_count>
+void Or(FBitset<bit_count>* dst, FBitset<bit_count>* a, FBitset<bit_count>* b) {
+    OrWords(dst->words, a->words, b->words, GetBitsetWordCount(bit_count));
+}
+
+template<uint32 bit_count>
+void Xor(FBitset<bit_count>* dst, FBitset<bit_count>* a, FBitset<bit_count>* b) {
+    XorWords(dst->words, a->words, b->words, GetBitsetWordCount(bit_count));
+}
+
+template<uint32 bit_count>
+void AndNot(FBitset<bit_count>* dst, FBitset<bit_count>* a, FBitset<bit_count>* b) {
+    AndNotWords(dst->words, a->words, b->words, GetBitsetWordCount(bit_count));
+}
+
+/// Bitset Interface
+////////////////////////////////////////////////////////////
+Bitset CreateBitset(Allocator* allocator, uint32 bit_count) {
+    CTK_ASSERT(bit_count > 0);
+
+    Bitset bitset = {};
+    bitset.allocator  = allocator;
+    bitset.word_count = GetBitsetWordCount(bit_count);
+    bitset.bit_count  = bit_count;
+    bitset.words      = Allocate<uint64>(allocator, bitset.word_count);
+    return bitset;
+}
+
+void DestroyBitset(Bitset* bitset) {
+    CTK_ASSERT(bitset->allocator != NULL);
+
+    Deallocate(bitset->allocator, bitset->words);
+    *bitset = {};
+}
+
+// Existing bits are preserved; new bits are clear.
+void Resize(Bitset* bitset, uint32 new_bit_count) {
+    CTK_ASSERT(new_bit_count > 0);
+
+    uint32 new_word_count = GetBitsetWordCount(new_bit_count);
+    if (new_word_count != bitset->word_count) {
+        bitset->words = ReallocateNZ(bitset->allocator, bitset->words, new_word_count);
+        if (new_word_count > bitset->word_count) {
+            memset(&bitset->words[bitset->word_count], 0, (new_word_count - bitset->word_count) * sizeof(uint64));
+        }
+        bitset->word_count = new_word_count;
+    }
+    if (new_bit_count < bitset->bit_count) {
+        bitset->words[new_word_count - 1] &= GetLastWordMask(new_bit_count);
+    }
+    bitset->bit_count = new_bit_count;
+}
+
+uint32 GetBitCount(Bitset* bitset) {
+    return bitset->bit_count;
+}
+
+void SetBit(Bitset* bitset, uint32 index) {
+    CTK_ASSERT(index < bitset->bit_count);
+
+    SetBit(bitset->words, index);
+}
+
+void ClearBit(Bitset* bitset, uint32 index) {
+    CTK_ASSERT(index < bitset->bit_count);
+
+    ClearBit(bitset->words, index);
+}
+
+bool TestBit(Bitset* bitset, uint32 index) {
+    CTK_ASSERT(index < bitset->bit_count);
+
+    return TestBit(bitset->words, index);
+}
+
+void SetAll(Bitset* bitset) {
+    SetAllBits(bitset->words, bitset->bit_count);
+}
+
+void Clear(Bitset* bitset) {
+    memset(bitset->words, 0, bitset->word_count * sizeof(uint64));
+}
+
+uint32 FindFirstSet(Bitset* bitset) {
+    return FindNextSet(bitset->words, bitset->bit_count, 0);
+}
+
+uint32 FindNextSet(Bitset* bitset, uint32 start) {
+    return FindNextSet(bitset->words, bitset->bit_count, start);
+}
+
+uint32 CountSetBits(Bitset* bitset) {
+    return CountSetBits(bitset->words, bitset->word_count);
+}
+
+#define CTK_BITSET_OP_INTERFACE_FUNC(NAME) \
+void NAME(Bitset* dst, Bitset* a, Bitset* b) { \
+    CTK_ASSERT(dst->bit_count == a->bit_count); \
+    CTK_ASSERT(dst->bit_count == b->bit_count); \
+    NAME##Words(dst->words, a->words, b->words, dst->word_count); \
+}
+CTK_BITSET_OP_INTERFACE_FUNC(And)
+CTK_BITSET_OP_INTERFACE_FUNC(Or)
+CTK_BITSET_OP_INTERFACE_FUNC(Xor)
+CTK_BITSET_OP_INTERFACE_FUNC(AndNot)
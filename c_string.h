@@ -1,10 +1,25 @@
-/// Interface
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 STRING_NOT_FOUND = UINT32_MAX;
+
+enum struct IntParseStatus {
+    SUCCESS,
+    INVALID,      // Empty, or contains characters other than a leading '-' and digits.
+    OUT_OF_RANGE, // Value doesn't fit in the integer type.
+};
+
+// Result of TryToInt(); value is 0 unless status is SUCCESS.
+template<typename IntType>
+struct IntParseResult {
+    IntType        value;
+    IntParseStatus status;
+};
+
+/// Scalar Implementations
 ////////////////////////////////////////////////////////////
-uint32 StringSize(const char* nt_string) {
-    if (nt_string == NULL) {
-        return 0;
-    }
 
+// Used by SIMD implementations for tails shorter than a vector, and kept as a reference for tests and benchmarks.
+uint32 Scalar_StringSize(const char* nt_string) {
     uint32 size = 0;
     while (nt_string[size] != '\0') {
         size += 1;
@@ -12,7 +27,7 @@ uint32 StringSize(const char* nt_string) {
     return size;
 }
 
-bool StringsMatch(const char* string_a, const char* string_b, uint32 match_size) {
+bool Scalar_StringsMatch(const char* string_a, const char* string_b, uint32 match_size) {
     for (uint32 i = 0; i < match_size; i += 1) {
         if (string_a[i] != string_b[i]) {
             return false;
@@ -22,6 +37,456 @@ bool StringsMatch(const char* string_a, const char* string_b, uint32 match_size)
     return true;
 }
 
+uint32 Scalar_FindChar(const char* string, uint32 string_size, char c) {
+    for (uint32 i = 0; i < string_size; i += 1) {
+        if (string[i] == c) {
+            return i;
+        }
+    }
+
+    return STRING_NOT_FOUND;
+}
+
+uint32 Scalar_FindSubstring(const char* string,    uint32 string_size,
+                            const char* substring, uint32 substring_size)
+{
+    if (substring_size == 0) {
+        return 0;
+    }
+
+    if (string_size < substring_size) {
+        return STRING_NOT_FOUND;
+    }
+
+    for (uint32 i = 0; i <= string_size - substring_size; i += 1) {
+        if (string[i] == substring[0] && Scalar_StringsMatch(&string[i + 1], &substring[1], substring_size - 1)) {
+            return i;
+        }
+    }
+
+    return STRING_NOT_FOUND;
+}
+
+/// SSE2 Implementations
+////////////////////////////////////////////////////////////
+
+// Loads are aligned, so reading past the terminator never crosses into an unmapped page.
+uint32 SSE2_StringSize(const char* nt_string) {
+    const char* block = (const char*)((uint64)nt_string & ~15ull);
+    __m128i zero = _mm_setzero_si128();
+    uint32 mask = (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i*)block), zero));
+    mask &= UINT32_MAX << (uint32)(nt_string - block);
+    while (mask == 0) {
+        block += 16;
+        mask = (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i*)block), zero));
+    }
+    return (uint32)(block + CountTrailingZeros(mask) - nt_string);
+}
+
+bool SSE2_StringsMatch(const char* string_a, const char* string_b, uint32 match_size) {
+    uint32 i = 0;
+    for (; i + 16 <= match_size; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i*)&string_a[i]);
+        __m128i b = _mm_loadu_si128((const __m128i*)&string_b[i]);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xFFFF) {
+            return false;
+        }
+    }
+
+    return Scalar_StringsMatch(&string_a[i], &string_b[i], match_size - i);
+}
+
+uint32 SSE2_FindChar(const char* string, uint32 string_size, char c) {
+    __m128i c_vec = _mm_set1_epi8(c);
+    uint32 i = 0;
+    for (; i + 16 <= string_size; i += 16) {
+        uint32 mask = (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)&string[i]), c_vec));
+        if (mask != 0) {
+            return i + CountTrailingZeros(mask);
+        }
+    }
+
+    uint32 tail_index = Scalar_FindChar(&string[i], string_size - i, c);
+    return tail_index == STRING_NOT_FOUND ? STRING_NOT_FOUND : i + tail_index;
+}
+
+// Filters candidate positions by comparing the substring's first and last chars against 16 positions at once, and only
+// runs a full compare for positions where both match.
+uint32 SSE2_FindSubstring(const char* string,    uint32 string_size,
+                          const char* substring, uint32 substring_size)
+{
+    if (substring_size < 2 || string_size < substring_size) {
+        return substring_size == 1 ? SSE2_FindChar(string, string_size, substring[0])
+                                   : Scalar_FindSubstring(string, string_size, substring, substring_size);
+    }
+
+    __m128i first = _mm_set1_epi8(substring[0]);
+    __m128i last  = _mm_set1_epi8(substring[substring_size - 1]);
+    uint32 start_count = string_size - substring_size + 1;
+    uint32 i = 0;
+    for (; i + 16 <= start_count; i += 16) {
+        __m128i first_eq = _mm_cmpeq_epi8(first, _mm_loadu_si128((const __m128i*)&string[i]));
+        __m128i last_eq  = _mm_cmpeq_epi8(last,  _mm_loadu_si128((const __m128i*)&string[i + substring_size - 1]));
+        uint32 mask = (uint32)_mm_movemask_epi8(_mm_and_si128(first_eq, last_eq));
+        while (mask != 0) {
+            uint32 start = i + CountTrailingZeros(mask);
+            if (SSE2_StringsMatch(&string[start + 1], &substring[1], substring_size - 2)) {
+                return start;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    uint32 tail_index = Scalar_FindSubstring(&string[i], string_size - i, substring, substring_size);
+    return tail_index == STRING_NOT_FOUND ? STRING_NOT_FOUND : i + tail_index;
+}
+
+/// AVX2 Implementations
+////////////////////////////////////////////////////////////
+uint32 AVX2_StringSize(const char* nt_string) {
+    const char* block = (const char*)((uint64)nt_string & ~31ull);
+    __m256i zero = _mm256_setzero_si256();
+    uint32 mask = (uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i*)block), zero));
+    mask &= UINT32_MAX << (uint32)(nt_string - block);
+    while (mask == 0) {
+        block += 32;
+        mask = (uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i*)block), zero));
+    }
+    return (uint32)(block + CountTrailingZeros(mask) - nt_string);
+}
+
+bool AVX2_StringsMatch(const char* string_a, const char* string_b, uint32 match_size) {
+    uint32 i = 0;
+    for (; i + 32 <= match_size; i += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)&string_a[i]);
+        __m256i b = _mm256_loadu_si256((const __m256i*)&string_b[i]);
+        if ((uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)) != UINT32_MAX) {
+            return false;
+        }
+    }
+
+    return SSE2_StringsMatch(&string_a[i], &string_b[i], match_size - i);
+}
+
+uint32 AVX2_FindChar(const char* string, uint32 string_size, char c) {
+    __m256i c_vec = _mm256_set1_epi8(c);
+    uint32 i = 0;
+    for (; i + 32 <= string_size; i += 32) {
+        __m256i eq = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)&string[i]), c_vec);
+        uint32 mask = (uint32)_mm256_movemask_epi8(eq);
+        if (mask != 0) {
+            return i + CountTrailingZeros(mask);
+        }
+    }
+
+    uint32 tail_index = SSE2_FindChar(&string[i], string_size - i, c);
+    return tail_index == STRING_NOT_FOUND ? STRING_NOT_FOUND : i + tail_index;
+}
+
+uint32 AVX2_FindSubstring(const char* string,    uint32 string_size,
+                          const char* substring, uint32 substring_size)
+{
+    if (substring_size < 2 || string_size < substring_size) {
+        return substring_size == 1 ? AVX2_FindChar(string, string_size, substring[0])
+                                   : Scalar_FindSubstring(string, string_size, substring, substring_size);
+    }
+
+    __m256i first = _mm256_set1_epi8(substring[0]);
+    __m256i last  = _mm256_set1_epi8(substring[substring_size - 1]);
+    uint32 start_count = string_size - substring_size + 1;
+    uint32 i = 0;
+    for (; i + 32 <= start_count; i += 32) {
+        __m256i first_eq = _mm256_cmpeq_epi8(first, _mm256_loadu_si256((const __m256i*)&string[i]));
+        __m256i last_eq  = _mm256_cmpeq_epi8(last,
+                                             _mm256_loadu_si256((const __m256i*)&string[i + substring_size - 1]));
+        uint32 mask = (uint32)_mm256_movemask_epi8(_mm256_and_si256(first_eq, last_eq));
+        while (mask != 0) {
+            uint32 start = i + CountTrailingZeros(mask);
+            if (AVX2_StringsMatch(&string[start + 1], &substring[1], substring_size - 2)) {
+                return start;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    uint32 tail_index = SSE2_FindSubstring(&string[i], string_size - i, substring, substring_size);
+    return tail_index == STRING_NOT_FOUND ? STRING_NOT_FOUND : i + tail_index;
+}
+
+/// Number Parsing
+////////////////////////////////////////////////////////////
+
+// Binary format parameters for Eisel-Lemire float parsing ("Number Parsing at a Gigabyte per Second", Lemire 2021).
+template<typename FloatType>
+struct FloatFormat;
+
+template<>
+struct FloatFormat<float32> {
+    using Bits = uint32;
+    static constexpr sint32  MANTISSA_BITS           = 23;
+    static constexpr sint32  MIN_EXPONENT            = -127;
+    static constexpr sint32  INFINITE_POWER          = 0xFF;
+    static constexpr sint32  MIN_POW10               = -65; // Smaller powers of 10 always round to 0.
+    static constexpr sint32  MAX_POW10               = 38;  // Larger powers of 10 always round to infinity.
+    static constexpr sint32  MIN_ROUND_TO_EVEN_POW10 = -17;
+    static constexpr sint32  MAX_ROUND_TO_EVEN_POW10 = 10;
+    static constexpr uint64  MAX_EXACT_MANTISSA      = 1ull << 24;
+    static constexpr sint32  MAX_EXACT_POW10         = 10;
+    static constexpr float32 EXACT_POW10[]           = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f,
+                                                         1e10f };
+};
+
+template<>
+struct FloatFormat<float64> {
+    using Bits = uint64;
+    static constexpr sint32  MANTISSA_BITS           = 52;
+    static constexpr sint32  MIN_EXPONENT            = -1023;
+    static constexpr sint32  INFINITE_POWER          = 0x7FF;
+    static constexpr sint32  MIN_POW10               = -342;
+    static constexpr sint32  MAX_POW10               = 308;
+    static constexpr sint32  MIN_ROUND_TO_EVEN_POW10 = -4;
+    static constexpr sint32  MAX_ROUND_TO_EVEN_POW10 = 23;
+    static constexpr uint64  MAX_EXACT_MANTISSA      = 1ull << 53;
+    static constexpr sint32  MAX_EXACT_POW10         = 22;
+    static constexpr float64 EXACT_POW10[]           = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,
+                                                         1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19,
+                                                         1e20, 1e21, 1e22 };
+};
+
+// Mantissa (without implicit bit) and biased exponent of a binary float.
+struct AdjustedMantissa {
+    uint64 mantissa;
+    sint32 power2;
+};
+
+bool IsDigit(char c) {
+    return (uint8)(c - '0') < 10;
+}
+
+uint64 LoadEightChars(const char* string) {
+    uint64 chars = 0;
+    memcpy(&chars, string, sizeof(chars));
+    return chars;
+}
+
+// Number of digits at the start of chars (first char in lowest byte), found by flagging the high bit of each non-digit
+// byte. Adding 6 can carry out of a byte >= 0xFA, but only into bytes after that non-digit, which don't matter.
+uint32 CountLeadingDigits(uint64 chars) {
+    uint64 nibbles = ((chars & 0xF0F0F0F0F0F0F0F0) | (((chars + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ^
+                     0x3333333333333333;
+    uint64 non_digits = (((nibbles & 0x7F7F7F7F7F7F7F7F) + 0x7F7F7F7F7F7F7F7F) | nibbles) & 0x8080808080808080;
+    return non_digits == 0 ? 8 : CountTrailingZeros(non_digits) / 8;
+}
+
+// SWAR: converts 8 digit chars (first digit in lowest byte) in 3 multiplies by combining adjacent digits into pairs,
+// then pairs into 4-digit groups, then groups into the final value.
+uint32 ParseEightDigits(uint64 chars) {
+    constexpr uint64 MASK = 0x000000FF000000FF;
+    constexpr uint64 MUL1 = 0x000F424000000064; // 100 + (1000000 << 32)
+    constexpr uint64 MUL2 = 0x0000271000000001; // 1 + (10000 << 32)
+    chars -= 0x3030303030303030;
+    chars = (chars * 10) + (chars >> 8);
+    return (uint32)((((chars & MASK) * MUL1) + (((chars >> 16) & MASK) * MUL2)) >> 32);
+}
+
+// Digit accumulators append digits starting at index to value (wrapping past 19 digits) and return the index of the
+// first non-digit.
+uint32 Scalar_AccumulateDigits(const char* string, uint32 size, uint32 index, uint64* value) {
+    while (index < size && IsDigit(string[index])) {
+        *value = (*value * 10) + (uint64)(string[index] - '0');
+        index += 1;
+    }
+
+    return index;
+}
+
+// Appends first digit_count (< 8) digits of chars to value by padding them with leading '0's to 8 digits.
+void AccumulatePartialDigits(uint64 chars, uint32 digit_count, uint64* value) {
+    constexpr uint64 POW10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000 };
+    if (digit_count == 0) {
+        return;
+    }
+
+    uint32 pad_bits = 8 * (8 - digit_count);
+    chars = (chars << pad_bits) | (0x3030303030303030 >> (64 - pad_bits));
+    *value = (*value * POW10[digit_count]) + ParseEightDigits(chars);
+}
+
+// Each 8-char window is parsed whole whatever its digit count, so there's no per-digit loop or branch. Tails shorter
+// than 8 chars are read as the last 8 chars of the string, shifted down, so reads never go past size.
+uint32 SWAR_AccumulateDigits(const char* string, uint32 size, uint32 index, uint64* value) {
+    while (index + 8 <= size) {
+        uint64 chars = LoadEightChars(&string[index]);
+        uint32 digit_count = CountLeadingDigits(chars);
+        if (digit_count < 8) {
+            AccumulatePartialDigits(chars, digit_count, value);
+            return index + digit_count;
+        }
+        *value = (*value * 100000000) + ParseEightDigits(chars);
+        index += 8;
+    }
+
+    if (index == size || size < 8) {
+        return Scalar_AccumulateDigits(string, size, index, value);
+    }
+
+    // Shifted-in zero bytes count as non-digits.
+    uint64 chars = LoadEightChars(&string[size - 8]) >> (8 * (8 - (size - index)));
+    uint32 digit_count = CountLeadingDigits(chars);
+    AccumulatePartialDigits(chars, digit_count, value);
+    return index + digit_count;
+}
+
+// Converts 16 digits per step: digit pairs, 4-digit groups and 8-digit groups are each combined with one multiply-add.
+// uint64 holds at most 20 digits, so there's at most one 16-digit step before falling back to SWAR.
+uint32 SSE41_AccumulateDigits(const char* string, uint32 size, uint32 index, uint64* value) {
+    if (index + 16 <= size) {
+        __m128i digits = _mm_sub_epi8(_mm_loadu_si128((__m128i*)&string[index]), _mm_set1_epi8('0'));
+        __m128i nine = _mm_set1_epi8(9);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(digits, nine), nine)) == 0xFFFF) {
+            __m128i pairs = _mm_maddubs_epi16(digits, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1,
+                                                                    10, 1, 10, 1, 10, 1, 10, 1));
+            __m128i quads = _mm_madd_epi16(pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+            quads = _mm_packus_epi32(quads, quads);
+            __m128i octs = _mm_madd_epi16(quads, _mm_setr_epi16(10000, 1, 10000, 1, 0, 0, 0, 0));
+            uint64 high = (uint32)_mm_cvtsi128_si32(octs);
+            uint64 low  = (uint32)_mm_extract_epi32(octs, 1);
+            *value = (*value * 10000000000000000) + (high * 100000000) + low;
+            index += 16;
+        }
+    }
+
+    return SWAR_AccumulateDigits(string, size, index, value);
+}
+
+uint32 AccumulateDigits(const char* string, uint32 size, uint32 index, uint64* value) {
+    return HasSSE41() ? SSE41_AccumulateDigits(string, size, index, value)
+                      : SWAR_AccumulateDigits(string, size, index, value);
+}
+
+// Eisel-Lemire: rounds mantissa * 10^pow10 to FloatType using a 128-bit product with a truncated 5^pow10 from
+// POW5_128; the table is wide enough that the result is always correctly rounded for exact mantissas.
+template<typename FloatType>
+AdjustedMantissa ComputeFloat(sint64 pow10, uint64 mantissa) {
+    using Format = FloatFormat<FloatType>;
+
+    if (mantissa == 0 || pow10 < Format::MIN_POW10) {
+        return { .mantissa = 0, .power2 = 0 };
+    }
+    if (pow10 > Format::MAX_POW10) {
+        return { .mantissa = 0, .power2 = Format::INFINITE_POWER };
+    }
+
+    uint32 leading_zeros = CountLeadingZeros(mantissa);
+    mantissa <<= leading_zeros;
+
+    // Low half of table entry only matters if it could carry into the bits kept from the high product.
+    constexpr uint64 PRECISION_MASK = UINT64_MAX >> (Format::MANTISSA_BITS + 3);
+    uint32 table_index = 2 * (uint32)(pow10 - POW5_128_MIN_EXPONENT);
+    uint64 high = 0;
+    uint64 low = Multiply128(mantissa, POW5_128[table_index], &high);
+    if ((high & PRECISION_MASK) == PRECISION_MASK) {
+        uint64 low_high = 0;
+        Multiply128(mantissa, POW5_128[table_index + 1], &low_high);
+        low += low_high;
+        high += low_high > low ? 1 : 0;
+    }
+
+    AdjustedMantissa result = {};
+    uint32 upper_bit = (uint32)(high >> 63);
+    uint32 shift = upper_bit + 64 - Format::MANTISSA_BITS - 3;
+    result.mantissa = high >> shift;
+
+    // ((217706 * pow10) >> 16) == floor(log2(10^pow10)) over the table's range.
+    result.power2 = (sint32)(((217706 * pow10) >> 16) + 63 + upper_bit - leading_zeros - Format::MIN_EXPONENT);
+
+    // Subnormal.
+    if (result.power2 <= 0) {
+        if (-result.power2 + 1 >= 64) {
+            return { .mantissa = 0, .power2 = 0 };
+        }
+        result.mantissa >>= -result.power2 + 1;
+        result.mantissa += result.mantissa & 1;
+        result.mantissa >>= 1;
+        result.power2 = result.mantissa < (1ull << Format::MANTISSA_BITS) ? 0 : 1;
+        return result;
+    }
+
+    // Product is exact and halfway between two floats; round to even instead of up.
+    if (low <= 1 && pow10 >= Format::MIN_ROUND_TO_EVEN_POW10 && pow10 <= Format::MAX_ROUND_TO_EVEN_POW10 &&
+        (result.mantissa & 3) == 1 && (result.mantissa << shift) == high)
+    {
+        result.mantissa &= ~1ull;
+    }
+
+    result.mantissa += result.mantissa & 1;
+    result.mantissa >>= 1;
+    if (result.mantissa >= (2ull << Format::MANTISSA_BITS)) {
+        result.mantissa = 1ull << Format::MANTISSA_BITS;
+        result.power2 += 1;
+    }
+    result.mantissa &= ~(1ull << Format::MANTISSA_BITS);
+
+    if (result.power2 >= Format::INFINITE_POWER) {
+        return { .mantissa = 0, .power2 = Format::INFINITE_POWER };
+    }
+
+    return result;
+}
+
+template<typename FloatType>
+FloatType MakeFloat(AdjustedMantissa adjusted_mantissa, bool is_negative) {
+    using Bits = typename FloatFormat<FloatType>::Bits;
+
+    Bits bits = (Bits)(adjusted_mantissa.mantissa |
+                       ((uint64)adjusted_mantissa.power2 << FloatFormat<FloatType>::MANTISSA_BITS));
+    bits |= (Bits)(is_negative ? 1 : 0) << ((sizeof(Bits) * 8) - 1);
+    FloatType value = 0;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Correctly rounded fallback for inputs with more than 19 significant digits that Eisel-Lemire can't decide from the
+// truncated mantissa. Also used as the reference for tests and benchmarks.
+template<typename FloatType>
+FloatType Strtod_ToFloat(const char* string, uint32 size) {
+    char  local_buffer[128];
+    char* buffer = size < sizeof(local_buffer) ? local_buffer : (char*)malloc(size + 1);
+    memcpy(buffer, string, size);
+    buffer[size] = '\0';
+
+    FloatType value = 0;
+    if constexpr (sizeof(FloatType) == sizeof(float32)) {
+        value = strtof(buffer, NULL);
+    }
+    else {
+        value = strtod(buffer, NULL);
+    }
+
+    if (buffer != local_buffer) {
+        free(buffer);
+    }
+
+    return value;
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+
+// SIMD implementations are selected at runtime via CPUID; SSE2 is always available on x64.
+uint32 StringSize(const char* nt_string) {
+    if (nt_string == NULL) {
+        return 0;
+    }
+
+    return HasAVX2() ? AVX2_StringSize(nt_string) : SSE2_StringSize(nt_string);
+}
+
+bool StringsMatch(const char* string_a, const char* string_b, uint32 match_size) {
+    return HasAVX2() ? AVX2_StringsMatch(string_a, string_b, match_size)
+                     : SSE2_StringsMatch(string_a, string_b, match_size);
+}
+
 bool StringsMatch(const char* string_a, uint32 string_a_size,
                   const char* string_b, uint32 string_b_size)
 {
@@ -40,14 +505,23 @@ bool StringsMatch(const char* string_a, uint32 string_a_size, const char* nt_str
     return StringsMatch(string_a, string_a_size, nt_string_b, StringSize(nt_string_b));
 }
 
+// Returns index of first occurrence of c, or STRING_NOT_FOUND.
+uint32 FindChar(const char* string, uint32 string_size, char c) {
+    return HasAVX2() ? AVX2_FindChar(string, string_size, c) : SSE2_FindChar(string, string_size, c);
+}
+
+// Returns index of first occurrence of substring, or STRING_NOT_FOUND.
+uint32 FindSubstring(const char* string,    uint32 string_size,
+                     const char* substring, uint32 substring_size)
+{
+    return HasAVX2() ? AVX2_FindSubstring(string, string_size, substring, substring_size)
+                     : SSE2_FindSubstring(string, string_size, substring, substring_size);
+}
+
 bool IsSubstring(const char* string,    uint32 string_size,
                  const char* substring, uint32 substring_size)
 {
-    if (string_size < substring_size) {
-        return false;
-    }
-
-    return StringsMatch(string, substring, substring_size);
+    return FindSubstring(string, string_size, substring, substring_size) != STRING_NOT_FOUND;
 }
 
 bool IsSubstring(const char* nt_string, const char* nt_substring) {
@@ -59,15 +533,11 @@ bool IsSubstring(const char* string, uint32 string_size, const char* nt_substrin
 }
 
 bool Contains(const char* string, uint32 string_size, char c) {
-    for (uint32 i = 0; i < string_size; i += 1) {
-        if (string[i] == c) {
-            return true;
-        }
-    }
-
-    return false;
+    return FindChar(string, string_size, c) != STRING_NOT_FOUND;
 }
 
+// Correctly rounded. Parses leading spaces, an optional '-', digits with an optional fraction and exponent, and stops
+// at the first character that isn't part of the number.
 template<typename FloatType>
 FloatType ToFloat(const char* string, uint32 size) {
     // Skip leading spaces.
@@ -78,6 +548,7 @@ FloatType ToFloat(const char* string, uint32 size) {
         }
         index += 1;
     }
+    uint32 number_start = index;
 
     bool is_negative = false;
     if (index < size && string[index] == '-') {
@@ -85,33 +556,102 @@ FloatType ToFloat(const char* string, uint32 size) {
         index += 1;
     }
 
-    FloatType value = 0.0f;
-    bool decimal_found = false;
-    FloatType base = 1;
-    while (index < size) {
-        char c = string[index];
+    uint64 mantissa = 0;
+    uint32 int_start = index;
+    index = AccumulateDigits(string, size, index, &mantissa);
+    uint32 int_end = index;
 
-        if (c == '.') {
-            if (decimal_found) {
-                CTK_FATAL("invalid string for parsing float: multiple decimals found");
+    uint32 frac_start = index;
+    uint32 frac_end   = index;
+    if (index < size && string[index] == '.') {
+        index += 1;
+        frac_start = index;
+        index = AccumulateDigits(string, size, index, &mantissa);
+        frac_end = index;
+        if (index < size && string[index] == '.') {
+            CTK_FATAL("invalid string for parsing float: multiple decimals found");
+        }
+    }
+
+    uint32 digit_count = (int_end - int_start) + (frac_end - frac_start);
+    if (digit_count == 0) {
+        return is_negative ? -(FloatType)0 : (FloatType)0;
+    }
+
+    // 'e' is only part of the number if followed by exponent digits.
+    sint64 exponent = 0;
+    if (index < size && (string[index] == 'e' || string[index] == 'E')) {
+        uint32 exponent_index = index + 1;
+        bool exponent_is_negative = false;
+        if (exponent_index < size && (string[exponent_index] == '-' || string[exponent_index] == '+')) {
+            exponent_is_negative = string[exponent_index] == '-';
+            exponent_index += 1;
+        }
+        if (exponent_index < size && IsDigit(string[exponent_index])) {
+            while (exponent_index < size && IsDigit(string[exponent_index])) {
+                // Exponents this large already round to 0 or infinity, so stop accumulating before overflow.
+                if (exponent < 0x10000000) {
+                    exponent = (exponent * 10) + (string[exponent_index] - '0');
+                }
+                exponent_index += 1;
             }
-            decimal_found = true;
+            exponent = exponent_is_negative ? -exponent : exponent;
+            index = exponent_index;
         }
-        else if (!ASCII_NUMERIC[c]) {
-            break;
+    }
+    sint64 pow10 = exponent - (sint64)(frac_end - frac_start);
+
+    // mantissa only holds 19 digits exactly; for longer inputs, use the first 19 significant digits and check that
+    // rounding the truncated mantissa up doesn't change the result.
+    bool truncated = false;
+    if (digit_count > 19) {
+        for (uint32 i = int_start; i < frac_end && (string[i] == '0' || string[i] == '.'); i += 1) {
+            digit_count -= string[i] == '0' ? 1 : 0;
         }
-        else {
-            if (decimal_found) {
-                base *= 10;
+
+        if (digit_count > 19) {
+            constexpr uint64 MIN_19_DIGIT_VALUE = 1000000000000000000;
+            truncated = true;
+            mantissa = 0;
+            uint32 i = int_start;
+            while (mantissa < MIN_19_DIGIT_VALUE && i < int_end) {
+                mantissa = (mantissa * 10) + (uint64)(string[i] - '0');
+                i += 1;
+            }
+
+            if (mantissa >= MIN_19_DIGIT_VALUE) {
+                pow10 = exponent + (sint64)(int_end - i);
+            }
+            else {
+                i = frac_start;
+                while (mantissa < MIN_19_DIGIT_VALUE && i < frac_end) {
+                    mantissa = (mantissa * 10) + (uint64)(string[i] - '0');
+                    i += 1;
+                }
+                pow10 = exponent - (sint64)(i - frac_start);
             }
-            value *= 10;
-            value += c - 48;
         }
+    }
 
-        index += 1;
+    // Clinger's fast path: mantissa and 10^pow10 are both exact in FloatType, so one multiply/divide rounds correctly.
+    if (!truncated && mantissa <= FloatFormat<FloatType>::MAX_EXACT_MANTISSA &&
+        pow10 >= -FloatFormat<FloatType>::MAX_EXACT_POW10 && pow10 <= FloatFormat<FloatType>::MAX_EXACT_POW10)
+    {
+        FloatType value = (FloatType)mantissa;
+        value = pow10 < 0 ? value / FloatFormat<FloatType>::EXACT_POW10[-pow10]
+                          : value * FloatFormat<FloatType>::EXACT_POW10[pow10];
+        return is_negative ? -value : value;
+    }
+
+    AdjustedMantissa result = ComputeFloat<FloatType>(pow10, mantissa);
+    if (truncated) {
+        AdjustedMantissa rounded_up_result = ComputeFloat<FloatType>(pow10, mantissa + 1);
+        if (result.mantissa != rounded_up_result.mantissa || result.power2 != rounded_up_result.power2) {
+            return Strtod_ToFloat<FloatType>(&string[number_start], index - number_start);
+        }
     }
 
-    return (value / base) * (is_negative ? -1 : 1);
+    return MakeFloat<FloatType>(result, is_negative);
 }
 
 template<typename FloatType>
@@ -129,6 +669,8 @@ float##BITS ToFloat##BITS(const char* nt_string) { \
 CSTRING_TO_FLOAT_FUNC(32)
 CSTRING_TO_FLOAT_FUNC(64)
 
+// Leading spaces are skipped and parsing stops at the first non-digit. Values that don't fit in IntType wrap; use
+// TryToInt() to detect invalid or out-of-range input.
 template<typename IntType>
 IntType ToInt(const char* string, uint32 size) {
     // Skip leading spaces.
@@ -146,26 +688,68 @@ IntType ToInt(const char* string, uint32 size) {
         index += 1;
     }
 
-    IntType value = 0;
-    while (index < size) {
-        char c = string[index];
-        if (!ASCII_NUMERIC[c]) {
-            // Skip all non-numeric characters at end of string, including trailing spaces.
-            break;
-        }
+    // Trailing non-digit characters, including spaces, are ignored.
+    uint64 value = 0;
+    AccumulateDigits(string, size, index, &value);
+
+    return (IntType)(is_negative ? 0 - value : value);
+}
+
+template<typename IntType>
+IntType ToInt(const char* nt_string) {
+    return ToInt<IntType>(nt_string, StringSize(nt_string));
+}
 
-        value *= 10;
-        value += c - 48;
+// Strict parse for untrusted input: string must be an optional '-' followed only by digits, and the value must fit in
+// IntType.
+template<typename IntType>
+IntParseResult<IntType> TryToInt(const char* string, uint32 size) {
+    constexpr bool   IS_SIGNED = (IntType)-1 < 0;
+    constexpr uint64 MAX_VALUE = UINT64_MAX >> ((64 - (sizeof(IntType) * 8)) + (IS_SIGNED ? 1 : 0));
 
+    uint32 index = 0;
+    bool is_negative = false;
+    if (index < size && string[index] == '-') {
+        is_negative = true;
         index += 1;
     }
+    if (index == size) {
+        return { .value = 0, .status = IntParseStatus::INVALID };
+    }
 
-    return value * (is_negative ? -1 : 1);
+    // Leading zeros don't count towards the 20 digits a uint64 can hold.
+    while (index < size && string[index] == '0') {
+        index += 1;
+    }
+
+    // 19 digits can't overflow uint64; a 20th digit needs checking, and more than 20 always overflow.
+    uint64 value = 0;
+    uint32 max_index = Min(size, index + 19);
+    index = AccumulateDigits(string, max_index, index, &value);
+    if (index == max_index && index < size && IsDigit(string[index])) {
+        uint64 digit = (uint64)(string[index] - '0');
+        if (value > (UINT64_MAX - digit) / 10 || (index + 1 < size && IsDigit(string[index + 1]))) {
+            return { .value = 0, .status = IntParseStatus::OUT_OF_RANGE };
+        }
+        value = (value * 10) + digit;
+        index += 1;
+    }
+
+    if (index < size) {
+        return { .value = 0, .status = IntParseStatus::INVALID };
+    }
+
+    uint64 max_magnitude = is_negative ? (IS_SIGNED ? MAX_VALUE + 1 : 0) : MAX_VALUE;
+    if (value > max_magnitude) {
+        return { .value = 0, .status = IntParseStatus::OUT_OF_RANGE };
+    }
+
+    return { .value = (IntType)(is_negative ? 0 - value : value), .status = IntParseStatus::SUCCESS };
 }
 
 template<typename IntType>
-IntType ToInt(const char* nt_string) {
-    return ToInt<IntType>(nt_string, StringSize(nt_string));
+IntParseResult<IntType> TryToInt(const char* nt_string) {
+    return TryToInt<IntType>(nt_string, StringSize(nt_string));
 }
 
 #define CSTRING_TO_INT_FUNC(SIGN, SIGN_UPPER, BITS) \
@@ -0,0 +1,71 @@
+/// Data
+////////////////////////////////////////////////////////////
+struct CPUFeatures {
+    bool pclmul;
+    bool sse41;
+    bool sse42;
+    bool popcnt;
+    bool bmi1;
+    bool bmi2;
+    bool avx2;
+    bool initialized;
+};
+
+CPUFeatures g_cpu_features;
+
+/// Interface
+////////////////////////////////////////////////////////////
+void InitCPUFeatures() {
+    sint32 info[4] = {}; // eax, ebx, ecx, edx
+    __cpuid(info, 0);
+    sint32 max_leaf = info[0];
+
+    __cpuid(info, 1);
+    g_cpu_features.pclmul = (info[2] & (1 << 1))  != 0;
+    g_cpu_features.sse41  = (info[2] & (1 << 19)) != 0;
+    g_cpu_features.sse42  = (info[2] & (1 << 20)) != 0;
+    g_cpu_features.popcnt = (info[2] & (1 << 23)) != 0;
+
+    // AVX registers are only usable if the OS saves YMM state on context switches (OSXSAVE + XCR0 bits 1 and 2).
+    bool avx = (info[2] & (1 << 28)) != 0;
+    bool os_saves_ymm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+
+    if (max_leaf >= 7) {
+        __cpuidex(info, 7, 0);
+        g_cpu_features.bmi1 = (info[1] & (1 << 3)) != 0;
+        g_cpu_features.avx2 = (info[1] & (1 << 5)) != 0 && avx && os_saves_ymm;
+        g_cpu_features.bmi2 = (info[1] & (1 << 8)) != 0;
+    }
+
+    g_cpu_features.initialized = true;
+}
+
+// Features are detected on first use, so SIMD kernels can dispatch without requiring an explicit init call. Detection
+// is idempotent, so concurrent first calls are harmless.
+CPUFeatures* GetCPUFeatures() {
+    if (!g_cpu_features.initialized) {
+        InitCPUFeatures();
+    }
+
+    return &g_cpu_features;
+}
+
+bool HasAVX2() {
+    return GetCPUFeatures()->avx2;
+}
+
+bool HasSSE41() {
+    return GetCPUFeatures()->sse41;
+}
+
+bool HasSSE42() {
+    return GetCPUFeatures()->sse42;
+}
+
+bool HasPCLMUL() {
+    return GetCPUFeatures()->pclmul;
+}
+
+bool HasPOPCNT() {
+    return GetCPUFeatures()->popcnt;
+}
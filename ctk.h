@@ -3,6 +3,8 @@
 #include <limits.h>
 #include <math.h>
 #include <xmmintrin.h>
+#include <immintrin.h>
+#include <intrin.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -16,15 +18,21 @@ namespace CTK {
 #include "ctk/common.h"
 #include "ctk/io.h"
 #include "ctk/debug.h"
+#include "ctk/cpu.h"
+#include "ctk/math.h"
 #include "ctk/ascii_parsing.h"
+#include "ctk/pow5_table.h"
 #include "ctk/c_array.h"
 #include "ctk/c_string.h"
+#include "ctk/format.h"
+#include "ctk/string_view.h"
+#include "ctk/hash.h"
 #include "ctk/f_array.h"
 #include "ctk/f_map.h"
 #include "ctk/f_string.h"
-#include "ctk/math.h"
 #include "ctk/optional.h"
 #include "ctk/pair.h"
+#include "ctk/atomic.h"
 
 // Allocators
 #include "ctk/allocator.h"
@@ -35,17 +43,32 @@ namespace CTK {
 
 // Collections
 #include "ctk/array.h"
+#include "ctk/s_array.h"
+#include "ctk/soa_array.h"
+#include "ctk/segmented_array.h"
 #include "ctk/string.h"
+#include "ctk/unicode.h"
 #include "ctk/pool.h"
+#include "ctk/slot_map.h"
 #include "ctk/ring_buffer.h"
+#include "ctk/queue.h"
+#include "ctk/bitset.h"
+#include "ctk/priority_queue.h"
+#include "ctk/sorted_map.h"
+#include "ctk/b_tree_map.h"
+#include "ctk/intern_table.h"
 
 // System
 #include "ctk/win32.h"
 #include "ctk/file.h"
 #include "ctk/json.h"
+#include "ctk/json_document.h"
+#include "ctk/json_reader.h"
+#include "ctk/json_writer.h"
 #include "ctk/window_keymap.h"
 #include "ctk/window.h"
 #include "ctk/thread_pool.h"
+#include "ctk/json_parallel.h"
 
 // Utils
 #include "ctk/testing.h"
@@ -5,6 +5,16 @@ using FString = FArray<char, size>;
 
 /// Interface
 ////////////////////////////////////////////////////////////
+template<uint32 size>
+StringView ViewString(FString<size>* string) {
+    return { .data = string->data, .size = string->count };
+}
+
+template<uint32 size>
+uint64 Hash(FString<size>* string, uint64 seed = 0) {
+    return Hash(string->data, string->count, seed);
+}
+
 template<uint32 size>
 void PushRange(FString<size>* string, const char* nt_string) {
     PushRange(string, nt_string, StringSize(nt_string));
@@ -23,6 +33,29 @@ void Append(FString<size>* string, const char* fmt_string, Args... args) {
     string->count += chars_to_append <= remaining_space ? chars_to_append : remaining_space;
 }
 
+template<uint32 size>
+uint32 GetMaxFormatSize(FString<size>* string) {
+    return string->count;
+}
+
+template<uint32 size>
+uint32 FormatValue(char* buffer, uint32 buffer_size, FString<size>* string) {
+    uint32 format_size = Min(string->count, buffer_size);
+    memcpy(buffer, string->data, format_size);
+    return format_size;
+}
+
+// Typed alternatives to Write()/Append(); see WriteValues(). Output that doesn't fit is truncated.
+template<uint32 size, typename ...Args>
+void WriteValues(FString<size>* string, Args... args) {
+    string->count = WriteValues(string->data, size, args...);
+}
+
+template<uint32 size, typename ...Args>
+void AppendValues(FString<size>* string, Args... args) {
+    string->count += WriteValues(&string->data[string->count], size - string->count, args...);
+}
+
 template<uint32 size>
 bool StringsMatch(FString<size>* string, const char* other_string, uint32 other_string_size) {
     return StringsMatch(string->data, string->count, other_string, other_string_size);
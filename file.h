@@ -1,3 +1,12 @@
+/// Data
+////////////////////////////////////////////////////////////
+struct MappedFile {
+    HANDLE      file;
+    HANDLE      mapping;
+    const char* data;
+    uint32      size;
+};
+
 /// Utils
 ////////////////////////////////////////////////////////////
 bool PathExists(DWORD attribs) {
@@ -163,6 +172,56 @@ void WriteFile(const char* path, Array<Type>* array) {
     WriteFile(path, array->data, array->count);
 }
 
+// Maps file at path into memory read-only. File is opened for sequential scanning so the OS reads ahead of pages as
+// they're faulted in front to back. data stays valid until UnmapFile(); empty files have no mapping and NULL data.
+MappedFile MapFile(const char* path) {
+    MappedFile mapped_file = {};
+    Win32Error e = {};
+
+    mapped_file.file = ::CreateFile(path,
+                                    GENERIC_READ,                                      // Access
+                                    FILE_SHARE_READ,                                   // Share Mode
+                                    NULL,                                              // Security Attributes
+                                    OPEN_EXISTING,                                     // Create Mode
+                                    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, // File Attributes
+                                    NULL);                                             // Template File
+    if (mapped_file.file == INVALID_HANDLE_VALUE) {
+        GetWin32Error(&e);
+        CTK_FATAL("CreateFile() failed for \"%s\": %.*s", path, e.message_length, e.message);
+    }
+
+    mapped_file.size = GetFileSize(mapped_file.file);
+    if (mapped_file.size == INVALID_FILE_SIZE) {
+        CTK_FATAL("failed to get size of file '%s'", path);
+    }
+
+    // CreateFileMapping() fails for empty files.
+    if (mapped_file.size == 0) {
+        return mapped_file;
+    }
+
+    mapped_file.mapping = CreateFileMapping(mapped_file.file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapped_file.mapping == NULL) {
+        GetWin32Error(&e);
+        CTK_FATAL("CreateFileMapping() failed for \"%s\": %.*s", path, e.message_length, e.message);
+    }
+
+    mapped_file.data = (const char*)MapViewOfFile(mapped_file.mapping, FILE_MAP_READ, 0, 0, 0);
+    if (mapped_file.data == NULL) {
+        GetWin32Error(&e);
+        CTK_FATAL("MapViewOfFile() failed for \"%s\": %.*s", path, e.message_length, e.message);
+    }
+
+    return mapped_file;
+}
+
+void UnmapFile(MappedFile* mapped_file) {
+    if (mapped_file->data    != NULL) { UnmapViewOfFile(mapped_file->data); }
+    if (mapped_file->mapping != NULL) { CloseHandle(mapped_file->mapping);  }
+    if (mapped_file->file    != NULL) { CloseHandle(mapped_file->file);     }
+    *mapped_file = {};
+}
+
 bool PathExists(const char* path) {
     return PathExists(GetFileAttributes(path));
 }
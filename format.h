@@ -0,0 +1,492 @@
+/// Data
+////////////////////////////////////////////////////////////
+
+// Upper bound on chars written for any non-string value, e.g. "-9223372036854775808" or "-2.2250738585072014e-308".
+constexpr uint32 FORMAT_MAX_NUMBER_SIZE = 32;
+
+// "00" to "99", so integers are written 2 digits per division.
+constexpr char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+constexpr uint64 UINT64_POW10[] = {
+    1,
+    10,
+    100,
+    1000,
+    10000,
+    100000,
+    1000000,
+    10000000,
+    100000000,
+    1000000000,
+    10000000000,
+    100000000000,
+    1000000000000,
+    10000000000000,
+    100000000000000,
+    1000000000000000,
+    10000000000000000,
+    100000000000000000,
+    1000000000000000000,
+    10000000000000000000,
+};
+
+struct FormatHex {
+    uint64 value;
+    uint32 min_digits;
+    bool   uppercase;
+};
+
+template<typename Type>
+struct FormatPad {
+    Type   value;
+    uint32 width;
+    char   pad_char;
+    bool   left_align;
+};
+
+// Shortest decimal that round-trips to a float: mantissa * 10^exponent.
+struct ShortestDecimal {
+    uint64 mantissa;
+    sint32 exponent;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+uint32 GetDecimalLength(uint64 value) {
+    if (value == 0) {
+        return 1;
+    }
+
+    // (bit length * 1233) >> 12 approximates log10(2^bit length) and is exact or 1 under.
+    uint32 approx_log10 = ((64 - CountLeadingZeros(value)) * 1233) >> 12;
+    return approx_log10 + (value >= UINT64_POW10[approx_log10] ? 1 : 0);
+}
+
+// Ryu helpers; see "Ryu: Fast Float-to-String Conversion" (Adams, 2018).
+uint32 Pow5Bits(sint32 e) {
+    return (uint32)(((e * 1217359) >> 19) + 1);
+}
+
+uint32 Log10Pow2(sint32 e) {
+    return (uint32)((e * 78913) >> 18);
+}
+
+uint32 Log10Pow5(sint32 e) {
+    return (uint32)((e * 732923) >> 20);
+}
+
+bool IsMultipleOfPow5(uint64 value, uint32 pow5) {
+    uint32 count = 0;
+    while (value > 0 && value % 5 == 0) {
+        value /= 5;
+        count += 1;
+    }
+    return count >= pow5;
+}
+
+bool IsMultipleOfPow2(uint64 value, uint32 pow2) {
+    return (value & ((1ull << pow2) - 1)) == 0;
+}
+
+// (m * mul) >> shift, where mul is a 128-bit { low, high } table entry and 64 < shift < 128.
+uint64 MultiplyShift(uint64 m, const uint64* mul, uint32 shift) {
+    uint64 low_high = 0;
+    Multiply128(m, mul[0], &low_high);
+    uint64 high_high = 0;
+    uint64 high_low = Multiply128(m, mul[1], &high_high);
+    uint64 sum_low  = low_high + high_low;
+    uint64 sum_high = high_high + (sum_low < low_high ? 1 : 0);
+    shift -= 64;
+    return (sum_high << (64 - shift)) | (sum_low >> shift);
+}
+
+// Ryu: finds the shortest decimal in the interval of reals that round to the float with the given IEEE fields, picking
+// the one closest to the float's exact value. Float32 uses the same 64-bit tables, which are more precise than its
+// narrower mantissa needs.
+ShortestDecimal ComputeShortestDecimal(uint64 ieee_mantissa, uint32 ieee_exponent, uint32 mantissa_bits, sint32 bias) {
+    sint32 e2 = 0;
+    uint64 m2 = 0;
+    if (ieee_exponent == 0) {
+        e2 = 1 - bias - (sint32)mantissa_bits - 2;
+        m2 = ieee_mantissa;
+    }
+    else {
+        e2 = (sint32)ieee_exponent - bias - (sint32)mantissa_bits - 2;
+        m2 = (1ull << mantissa_bits) | ieee_mantissa;
+    }
+    bool accept_bounds = (m2 & 1) == 0;
+
+    // Interval bounds are 4 * m2 - 1 - mm_shift and 4 * m2 + 2; the lower gap is half as wide at powers of 2.
+    uint64 mv = 4 * m2;
+    uint32 mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1 ? 1 : 0;
+
+    // Convert interval to a decimal power base.
+    uint64 vr = 0;
+    uint64 vp = 0;
+    uint64 vm = 0;
+    sint32 e10 = 0;
+    bool vm_is_trailing_zeros = false;
+    bool vr_is_trailing_zeros = false;
+    if (e2 >= 0) {
+        uint32 q = Log10Pow2(e2) - (e2 > 3 ? 1 : 0);
+        e10 = (sint32)q;
+        sint32 k = POW5_INV_BIT_COUNT + (sint32)Pow5Bits((sint32)q) - 1;
+        uint32 shift = (uint32)(-e2 + (sint32)q + k);
+        vr = MultiplyShift(mv,                POW5_INV_SPLIT[q], shift);
+        vp = MultiplyShift(mv + 2,            POW5_INV_SPLIT[q], shift);
+        vm = MultiplyShift(mv - 1 - mm_shift, POW5_INV_SPLIT[q], shift);
+        if (q <= 21) {
+            // Only one of mv, mv + 2 and mv - 1 - mm_shift can be a multiple of 5.
+            if (mv % 5 == 0) {
+                vr_is_trailing_zeros = IsMultipleOfPow5(mv, q);
+            }
+            else if (accept_bounds) {
+                vm_is_trailing_zeros = IsMultipleOfPow5(mv - 1 - mm_shift, q);
+            }
+            else {
+                vp -= IsMultipleOfPow5(mv + 2, q) ? 1 : 0;
+            }
+        }
+    }
+    else {
+        uint32 q = Log10Pow5(-e2) - (-e2 > 1 ? 1 : 0);
+        e10 = (sint32)q + e2;
+        sint32 i = -e2 - (sint32)q;
+        sint32 k = (sint32)Pow5Bits(i) - POW5_BIT_COUNT;
+        uint32 shift = (uint32)((sint32)q - k);
+        vr = MultiplyShift(mv,                POW5_SPLIT[i], shift);
+        vp = MultiplyShift(mv + 2,            POW5_SPLIT[i], shift);
+        vm = MultiplyShift(mv - 1 - mm_shift, POW5_SPLIT[i], shift);
+        if (q <= 1) {
+            // mv has at least q trailing 0 bits, so vr has at least q trailing 0 digits.
+            vr_is_trailing_zeros = true;
+            if (accept_bounds) {
+                vm_is_trailing_zeros = mm_shift == 1;
+            }
+            else {
+                vp -= 1;
+            }
+        }
+        else if (q < 63) {
+            vr_is_trailing_zeros = IsMultipleOfPow2(mv, q);
+        }
+    }
+
+    // Remove digits while the interval still contains a shorter decimal.
+    sint32 removed = 0;
+    uint8 last_removed_digit = 0;
+    uint64 output = 0;
+    if (vm_is_trailing_zeros || vr_is_trailing_zeros) {
+        // Rare general case (~0.7%), where exact ties and the inclusive lower bound need tracking.
+        while (vp / 10 > vm / 10) {
+            vm_is_trailing_zeros &= vm % 10 == 0;
+            vr_is_trailing_zeros &= last_removed_digit == 0;
+            last_removed_digit = (uint8)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed += 1;
+        }
+        if (vm_is_trailing_zeros) {
+            while (vm % 10 == 0) {
+                vr_is_trailing_zeros &= last_removed_digit == 0;
+                last_removed_digit = (uint8)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed += 1;
+            }
+        }
+
+        // Exact value is halfway between two decimals; round to even.
+        if (vr_is_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0) {
+            last_removed_digit = 4;
+        }
+        bool round_up = (vr == vm && (!accept_bounds || !vm_is_trailing_zeros)) || last_removed_digit >= 5;
+        output = vr + (round_up ? 1 : 0);
+    }
+    else {
+        bool round_up = false;
+        if (vp / 100 > vm / 100) {
+            round_up = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while (vp / 10 > vm / 10) {
+            round_up = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed += 1;
+        }
+        output = vr + (vr == vm || round_up ? 1 : 0);
+    }
+
+    return { .mantissa = output, .exponent = e10 + removed };
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+
+// Number formatters write straight into buffer, which must have room for FORMAT_MAX_NUMBER_SIZE chars, and return the
+// number of chars written. Output isn't null-terminated.
+uint32 FormatUInt(char* buffer, uint64 value) {
+    uint32 size = GetDecimalLength(value);
+    char* end = buffer + size;
+    while (value >= 100) {
+        uint64 pair = value % 100;
+        value /= 100;
+        end -= 2;
+        memcpy(end, &DIGIT_PAIRS[pair * 2], 2);
+    }
+
+    if (value >= 10) {
+        memcpy(end - 2, &DIGIT_PAIRS[value * 2], 2);
+    }
+    else {
+        end[-1] = (char)('0' + value);
+    }
+
+    return size;
+}
+
+uint32 FormatSInt(char* buffer, sint64 value) {
+    if (value < 0) {
+        buffer[0] = '-';
+        return FormatUInt(&buffer[1], 0 - (uint64)value) + 1;
+    }
+
+    return FormatUInt(buffer, (uint64)value);
+}
+
+// Writes decimal using JavaScript's Number.toString() rules: fixed notation for magnitudes in [1e-6, 1e21), e.g.
+// "0.000001" or "123400", and exponent notation otherwise, e.g. "1e-7" or "1.5e+21".
+uint32 FormatShortestDecimal(char* buffer, bool is_negative, ShortestDecimal decimal) {
+    uint32 size = 0;
+    if (is_negative) {
+        buffer[size++] = '-';
+    }
+
+    uint32 digit_count = GetDecimalLength(decimal.mantissa);
+    sint32 point = (sint32)digit_count + decimal.exponent; // Decimal point position relative to first digit.
+    if (decimal.exponent >= 0 && point <= 21) {
+        size += FormatUInt(&buffer[size], decimal.mantissa);
+        memset(&buffer[size], '0', (uint32)decimal.exponent);
+        size += (uint32)decimal.exponent;
+    }
+    else if (point > 0 && point <= 21) {
+        // Write digits one char to the right, then shift integer digits back over the decimal point's position.
+        FormatUInt(&buffer[size + 1], decimal.mantissa);
+        memmove(&buffer[size], &buffer[size + 1], (uint32)point);
+        buffer[size + (uint32)point] = '.';
+        size += digit_count + 1;
+    }
+    else if (point > -6 && point <= 0) {
+        buffer[size++] = '0';
+        buffer[size++] = '.';
+        memset(&buffer[size], '0', (uint32)-point);
+        size += (uint32)-point;
+        size += FormatUInt(&buffer[size], decimal.mantissa);
+    }
+    else {
+        FormatUInt(&buffer[size + 1], decimal.mantissa);
+        buffer[size] = buffer[size + 1];
+        if (digit_count > 1) {
+            buffer[size + 1] = '.';
+            size += digit_count + 1;
+        }
+        else {
+            size += 1;
+        }
+
+        sint32 exponent = point - 1;
+        buffer[size++] = 'e';
+        buffer[size++] = exponent < 0 ? '-' : '+';
+        size += FormatUInt(&buffer[size], (uint64)(exponent < 0 ? -exponent : exponent));
+    }
+
+    return size;
+}
+
+// Shortest output that parses back to the same value, e.g. 0.1 -> "0.1" rather than printf's "0.10000000000000001".
+uint32 FormatFloat(char* buffer, float64 value) {
+    uint64 bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    bool   is_negative   = (bits >> 63) != 0;
+    uint64 ieee_mantissa = bits & ((1ull << 52) - 1);
+    uint32 ieee_exponent = (uint32)((bits >> 52) & 0x7FF);
+
+    if (ieee_exponent == 0x7FF) {
+        const char* special = ieee_mantissa != 0 ? "nan" : is_negative ? "-inf" : "inf";
+        uint32 special_size = StringSize(special);
+        memcpy(buffer, special, special_size);
+        return special_size;
+    }
+    if (ieee_exponent == 0 && ieee_mantissa == 0) {
+        return FormatShortestDecimal(buffer, is_negative, { .mantissa = 0, .exponent = 0 });
+    }
+
+    return FormatShortestDecimal(buffer, is_negative, ComputeShortestDecimal(ieee_mantissa, ieee_exponent, 52, 1023));
+}
+
+uint32 FormatFloat(char* buffer, float32 value) {
+    uint32 bits = 0;
+    memcpy(&bits, &value, sizeof(bits));
+    bool   is_negative   = (bits >> 31) != 0;
+    uint64 ieee_mantissa = bits & ((1u << 23) - 1);
+    uint32 ieee_exponent = (bits >> 23) & 0xFF;
+
+    if (ieee_exponent == 0xFF) {
+        const char* special = ieee_mantissa != 0 ? "nan" : is_negative ? "-inf" : "inf";
+        uint32 special_size = StringSize(special);
+        memcpy(buffer, special, special_size);
+        return special_size;
+    }
+    if (ieee_exponent == 0 && ieee_mantissa == 0) {
+        return FormatShortestDecimal(buffer, is_negative, { .mantissa = 0, .exponent = 0 });
+    }
+
+    return FormatShortestDecimal(buffer, is_negative, ComputeShortestDecimal(ieee_mantissa, ieee_exponent, 23, 127));
+}
+
+uint32 FormatHexDigits(char* buffer, FormatHex hex) {
+    CTK_ASSERT(hex.min_digits <= 16);
+
+    const char* hex_chars = hex.uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+    uint32 digit_count = hex.value == 0 ? 1 : (64 - CountLeadingZeros(hex.value) + 3) / 4;
+    digit_count = Max(digit_count, hex.min_digits);
+    for (uint32 i = digit_count; i > 0; i -= 1) {
+        buffer[i - 1] = hex_chars[hex.value & 0xF];
+        hex.value >>= 4;
+    }
+
+    return digit_count;
+}
+
+// Wrappers for WriteValues()/AppendValues() args.
+FormatHex Hex(uint64 value, uint32 min_digits = 0, bool uppercase = false) {
+    return { .value = value, .min_digits = min_digits, .uppercase = uppercase };
+}
+
+template<typename Type>
+FormatPad<Type> AlignRight(Type value, uint32 width, char pad_char = ' ') {
+    return { .value = value, .width = width, .pad_char = pad_char, .left_align = false };
+}
+
+template<typename Type>
+FormatPad<Type> AlignLeft(Type value, uint32 width, char pad_char = ' ') {
+    return { .value = value, .width = width, .pad_char = pad_char, .left_align = true };
+}
+
+// Typed value formatting: GetMaxFormatSize() is an upper bound on FormatValue()'s output, so growable destinations can
+// reserve space up front. FormatValue() truncates output to buffer_size and returns chars written. Overloads for other
+// string types live with those types.
+template<typename Type>
+uint32 FormatNumber(char* buffer, uint32 buffer_size, Type value, Func<uint32, char*, Type> FormatFunc) {
+    if (buffer_size >= FORMAT_MAX_NUMBER_SIZE) {
+        return FormatFunc(buffer, value);
+    }
+
+    char scratch[FORMAT_MAX_NUMBER_SIZE];
+    uint32 size = Min(FormatFunc(scratch, value), buffer_size);
+    memcpy(buffer, scratch, size);
+    return size;
+}
+
+#define CTK_FORMAT_NUMBER_FUNC(TYPE, ARG_TYPE, FORMAT_FUNC) \
+uint32 GetMaxFormatSize(TYPE) { \
+    return FORMAT_MAX_NUMBER_SIZE; \
+} \
+uint32 FormatValue(char* buffer, uint32 buffer_size, TYPE value) { \
+    return FormatNumber<ARG_TYPE>(buffer, buffer_size, (ARG_TYPE)value, FORMAT_FUNC); \
+}
+CTK_FORMAT_NUMBER_FUNC(uint8,     uint64,    FormatUInt)
+CTK_FORMAT_NUMBER_FUNC(uint16,    uint64,    FormatUInt)
+CTK_FORMAT_NUMBER_FUNC(uint32,    uint64,    FormatUInt)
+CTK_FORMAT_NUMBER_FUNC(uint64,    uint64,    FormatUInt)
+CTK_FORMAT_NUMBER_FUNC(sint8,     sint64,    FormatSInt)
+CTK_FORMAT_NUMBER_FUNC(sint16,    sint64,    FormatSInt)
+CTK_FORMAT_NUMBER_FUNC(sint32,    sint64,    FormatSInt)
+CTK_FORMAT_NUMBER_FUNC(sint64,    sint64,    FormatSInt)
+CTK_FORMAT_NUMBER_FUNC(float32,   float32,   FormatFloat)
+CTK_FORMAT_NUMBER_FUNC(float64,   float64,   FormatFloat)
+CTK_FORMAT_NUMBER_FUNC(FormatHex, FormatHex, FormatHexDigits)
+
+uint32 GetMaxFormatSize(const char* nt_string) {
+    return StringSize(nt_string);
+}
+
+uint32 FormatValue(char* buffer, uint32 buffer_size, const char* nt_string) {
+    uint32 size = Min(StringSize(nt_string), buffer_size);
+    memcpy(buffer, nt_string, size);
+    return size;
+}
+
+uint32 GetMaxFormatSize(char) {
+    return 1;
+}
+
+uint32 FormatValue(char* buffer, uint32 buffer_size, char c) {
+    if (buffer_size == 0) {
+        return 0;
+    }
+
+    buffer[0] = c;
+    return 1;
+}
+
+uint32 GetMaxFormatSize(bool) {
+    return 5;
+}
+
+uint32 FormatValue(char* buffer, uint32 buffer_size, bool value) {
+    return FormatValue(buffer, buffer_size, value ? "true" : "false");
+}
+
+template<typename Type>
+uint32 GetMaxFormatSize(FormatPad<Type> pad) {
+    return Max(pad.width, GetMaxFormatSize(pad.value));
+}
+
+template<typename Type>
+uint32 FormatValue(char* buffer, uint32 buffer_size, FormatPad<Type> pad) {
+    uint32 value_size = FormatValue(buffer, buffer_size, pad.value);
+    if (value_size >= pad.width || value_size == buffer_size) {
+        return value_size;
+    }
+
+    uint32 pad_size = Min(pad.width - value_size, buffer_size);
+    if (pad.left_align) {
+        pad_size = Min(pad_size, buffer_size - value_size);
+        memset(&buffer[value_size], pad.pad_char, pad_size);
+        return value_size + pad_size;
+    }
+
+    // Shift value right to make room for padding, truncating its end if needed. Zero padding goes after a '-'.
+    uint32 kept_size = Min(value_size, buffer_size - pad_size);
+    uint32 sign_size = pad.pad_char == '0' && kept_size > 0 && buffer[0] == '-' ? 1 : 0;
+    memmove(&buffer[sign_size + pad_size], &buffer[sign_size], kept_size - sign_size);
+    memset(&buffer[sign_size], pad.pad_char, pad_size);
+    return pad_size + kept_size;
+}
+
+// Writes args into buffer by type, with no format string parsing, and returns chars written; output past buffer_size
+// is truncated. Output isn't null-terminated.
+template<typename ...Args>
+uint32 WriteValues(char* buffer, uint32 buffer_size, Args... args) {
+    uint32 size = 0;
+    ((size += FormatValue(&buffer[size], buffer_size - size, args)), ...);
+    return size;
+}
@@ -0,0 +1,285 @@
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint64 HASH_SECRET[3] = { 0x2D358DCCAA6C78A5, 0x8BB84B93962EACC9, 0x4B33A62ED433D4A3 };
+
+// Inputs over 48 bytes are hashed in 48-byte blocks across 3 independent lanes.
+constexpr uint32 HASH_BLOCK_SIZE = 48;
+
+// Incrementally hashes data passed in pieces; GetHash() matches Hash() of all the pieces concatenated. buffer holds the
+// last 16 bytes of the previous block (read by the final mix when few bytes follow it), then up to a block of pending
+// bytes, which are only hashed once more data arrives because the last bytes of the input are mixed differently.
+struct HashStream {
+    uint64 seed;
+    uint64 lane_1;
+    uint64 lane_2;
+    uint64 size;
+    uint32 pending_size;
+    uint8  buffer[16 + HASH_BLOCK_SIZE];
+};
+
+struct CRC32CTable {
+    uint32 entries[256];
+};
+
+constexpr CRC32CTable CreateCRC32CTable() {
+    CRC32CTable table = {};
+    for (uint32 i = 0; i < 256; i += 1) {
+        uint32 crc = i;
+        for (uint32 bit = 0; bit < 8; bit += 1) {
+            crc = (crc >> 1) ^ (0x82F63B78 & (0 - (crc & 1))); // Reflected Castagnoli polynomial.
+        }
+        table.entries[i] = crc;
+    }
+    return table;
+}
+
+constexpr CRC32CTable CRC32C_TABLE = CreateCRC32CTable();
+
+/// Utils
+////////////////////////////////////////////////////////////
+uint64 LoadHashWord64(const uint8* bytes) {
+    uint64 word = 0;
+    memcpy(&word, bytes, sizeof(word));
+    return word;
+}
+
+uint64 LoadHashWord32(const uint8* bytes) {
+    uint32 word = 0;
+    memcpy(&word, bytes, sizeof(word));
+    return word;
+}
+
+// Folds the full 128-bit product of a and b into 64 bits.
+uint64 HashMix(uint64 a, uint64 b) {
+    uint64 high = 0;
+    uint64 low = Multiply128(a, b, &high);
+    return low ^ high;
+}
+
+uint64 MixHashSeed(uint64 seed) {
+    return seed ^ HashMix(seed ^ HASH_SECRET[0], HASH_SECRET[1]);
+}
+
+uint64 FinishHash(uint64 a, uint64 b, uint64 seed, uint64 size) {
+    uint64 high = 0;
+    uint64 low = Multiply128(a ^ HASH_SECRET[1], b ^ seed, &high);
+    return HashMix(low ^ HASH_SECRET[0] ^ size, high ^ HASH_SECRET[1]);
+}
+
+// Inputs up to 16 bytes are read as 2 words with overlapping loads, so there are no per-byte loops or branches on size
+// beyond picking the load pattern.
+uint64 HashShort(const uint8* bytes, uint32 size, uint64 mixed_seed) {
+    uint64 a = 0;
+    uint64 b = 0;
+    if (size >= 4) {
+        const uint8* last = &bytes[size - 4];
+        uint32 delta = (size & 24) >> (size >> 3);
+        a = (LoadHashWord32(bytes) << 32) | LoadHashWord32(last);
+        b = (LoadHashWord32(&bytes[delta]) << 32) | LoadHashWord32(last - delta);
+    }
+    else if (size > 0) {
+        a = ((uint64)bytes[0] << 56) | ((uint64)bytes[size >> 1] << 32) | bytes[size - 1];
+    }
+    return FinishHash(a, b, mixed_seed, size);
+}
+
+void HashBlock(const uint8* bytes, uint64* seed, uint64* lane_1, uint64* lane_2) {
+    *seed   = HashMix(LoadHashWord64(&bytes[0])  ^ HASH_SECRET[0], LoadHashWord64(&bytes[8])  ^ *seed);
+    *lane_1 = HashMix(LoadHashWord64(&bytes[16]) ^ HASH_SECRET[1], LoadHashWord64(&bytes[24]) ^ *lane_1);
+    *lane_2 = HashMix(LoadHashWord64(&bytes[32]) ^ HASH_SECRET[2], LoadHashWord64(&bytes[40]) ^ *lane_2);
+}
+
+// Mixes the last remaining (<= 48) bytes of an input over 16 bytes. The final 16 bytes are always read, so if remaining
+// is under 16, the 16 - remaining bytes before bytes must be the end of the previous block.
+uint64 HashTail(const uint8* bytes, uint32 remaining, uint64 seed, uint64 size) {
+    if (remaining > 16) {
+        seed = HashMix(LoadHashWord64(&bytes[0]) ^ HASH_SECRET[2], LoadHashWord64(&bytes[8]) ^ seed ^ HASH_SECRET[1]);
+        if (remaining > 32) {
+            seed = HashMix(LoadHashWord64(&bytes[16]) ^ HASH_SECRET[2], LoadHashWord64(&bytes[24]) ^ seed);
+        }
+    }
+    uint64 a = LoadHashWord64(bytes + remaining - 16);
+    uint64 b = LoadHashWord64(bytes + remaining - 8);
+    return FinishHash(a, b, seed, size);
+}
+
+// Seed is pre-mixed with MixHashSeed(), so batch hashing only mixes it once.
+uint64 HashMixedSeed(const uint8* bytes, uint32 size, uint64 mixed_seed) {
+    if (size <= 16) {
+        return HashShort(bytes, size, mixed_seed);
+    }
+
+    uint64 seed = mixed_seed;
+    uint32 remaining = size;
+    if (size > HASH_BLOCK_SIZE) {
+        uint64 lane_1 = seed;
+        uint64 lane_2 = seed;
+        do {
+            HashBlock(bytes, &seed, &lane_1, &lane_2);
+            bytes     += HASH_BLOCK_SIZE;
+            remaining -= HASH_BLOCK_SIZE;
+        } while (remaining >= HASH_BLOCK_SIZE);
+        seed ^= lane_1 ^ lane_2;
+    }
+    return HashTail(bytes, remaining, seed, size);
+}
+
+// Key size is a template parameter so the size branches in HashShort() fold away.
+template<uint32 KEY_SIZE>
+void HashFixedKeys(const uint8* keys, uint32 key_count, uint64* hashes, uint64 mixed_seed) {
+    for (uint32 i = 0; i < key_count; i += 1) {
+        hashes[i] = HashShort(&keys[i * KEY_SIZE], KEY_SIZE, mixed_seed);
+    }
+}
+
+/// Scalar Implementations
+////////////////////////////////////////////////////////////
+uint32 Scalar_CRC32C(const uint8* bytes, uint32 size, uint32 crc) {
+    for (uint32 i = 0; i < size; i += 1) {
+        crc = (crc >> 8) ^ CRC32C_TABLE.entries[(crc ^ bytes[i]) & 0xFF];
+    }
+    return crc;
+}
+
+/// SSE4.2 Implementations
+////////////////////////////////////////////////////////////
+uint32 SSE42_CRC32C(const uint8* bytes, uint32 size, uint32 crc) {
+    uint64 crc64 = crc;
+    uint32 i = 0;
+    for (; i + 8 <= size; i += 8) {
+        crc64 = _mm_crc32_u64(crc64, LoadHashWord64(&bytes[i]));
+    }
+    crc = (uint32)crc64;
+    for (; i < size; i += 1) {
+        crc = _mm_crc32_u8(crc, bytes[i]);
+    }
+    return crc;
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+
+// Fast non-cryptographic 64-bit hash (rapidhash-style 64x64 -> 128-bit multiply mixing). Not suitable for anything that
+// needs to resist deliberately colliding inputs.
+uint64 Hash(const void* data, uint32 size, uint64 seed = 0) {
+    return HashMixedSeed((const uint8*)data, size, MixHashSeed(seed));
+}
+
+uint64 Hash(const char* nt_string) {
+    return Hash(nt_string, StringSize(nt_string));
+}
+
+uint64 Hash(StringView string, uint64 seed = 0) {
+    return Hash(string.data, string.size, seed);
+}
+
+// Writes Hash() of each string to hashes.
+void HashStrings(const StringView* strings, uint32 string_count, uint64* hashes, uint64 seed = 0) {
+    uint64 mixed_seed = MixHashSeed(seed);
+    for (uint32 i = 0; i < string_count; i += 1) {
+        hashes[i] = HashMixedSeed((const uint8*)strings[i].data, strings[i].size, mixed_seed);
+    }
+}
+
+// Writes Hash() of each key_size-byte key in keys to hashes. Common key sizes get loops specialized for their size.
+void HashKeys(const void* keys, uint32 key_size, uint32 key_count, uint64* hashes, uint64 seed = 0) {
+    const uint8* key_bytes = (const uint8*)keys;
+    uint64 mixed_seed = MixHashSeed(seed);
+    switch (key_size) {
+        case 4:  HashFixedKeys<4> (key_bytes, key_count, hashes, mixed_seed); break;
+        case 8:  HashFixedKeys<8> (key_bytes, key_count, hashes, mixed_seed); break;
+        case 12: HashFixedKeys<12>(key_bytes, key_count, hashes, mixed_seed); break;
+        case 16: HashFixedKeys<16>(key_bytes, key_count, hashes, mixed_seed); break;
+        default: {
+            for (uint32 i = 0; i < key_count; i += 1) {
+                hashes[i] = HashMixedSeed(&key_bytes[i * key_size], key_size, mixed_seed);
+            }
+            break;
+        }
+    }
+}
+
+// Hashes the bytes of each key, so Key must not contain padding.
+template<typename Key>
+void HashKeys(const Key* keys, uint32 key_count, uint64* hashes, uint64 seed = 0) {
+    HashKeys((const void*)keys, sizeof(Key), key_count, hashes, seed);
+}
+
+HashStream CreateHashStream(uint64 seed = 0) {
+    HashStream stream = {};
+    stream.seed         = MixHashSeed(seed);
+    stream.lane_1       = stream.seed;
+    stream.lane_2       = stream.seed;
+    stream.size         = 0;
+    stream.pending_size = 0;
+    return stream;
+}
+
+void Update(HashStream* stream, const void* data, uint32 size) {
+    const uint8* bytes = (const uint8*)data;
+    stream->size += size;
+    if (stream->pending_size + size <= HASH_BLOCK_SIZE) {
+        memcpy(&stream->buffer[16 + stream->pending_size], bytes, size);
+        stream->pending_size += size;
+        return;
+    }
+
+    // More data follows the pending bytes, so they're a full block and can be hashed.
+    if (stream->pending_size > 0) {
+        uint32 fill_size = HASH_BLOCK_SIZE - stream->pending_size;
+        memcpy(&stream->buffer[16 + stream->pending_size], bytes, fill_size);
+        bytes += fill_size;
+        size  -= fill_size;
+        HashBlock(&stream->buffer[16], &stream->seed, &stream->lane_1, &stream->lane_2);
+        memmove(stream->buffer, &stream->buffer[HASH_BLOCK_SIZE], 16);
+        stream->pending_size = 0;
+    }
+
+    // Hash blocks straight from data, always leaving at least 1 byte pending for GetHash().
+    if (size > HASH_BLOCK_SIZE) {
+        do {
+            HashBlock(bytes, &stream->seed, &stream->lane_1, &stream->lane_2);
+            bytes += HASH_BLOCK_SIZE;
+            size  -= HASH_BLOCK_SIZE;
+        } while (size > HASH_BLOCK_SIZE);
+        memcpy(stream->buffer, bytes - 16, 16);
+    }
+    memcpy(&stream->buffer[16], bytes, size);
+    stream->pending_size = size;
+}
+
+void Update(HashStream* stream, StringView string) {
+    Update(stream, string.data, string.size);
+}
+
+// Doesn't modify stream, so more data can still be added afterwards.
+uint64 GetHash(HashStream* stream) {
+    const uint8* pending = &stream->buffer[16];
+    if (stream->size <= HASH_BLOCK_SIZE) {
+        return HashMixedSeed(pending, (uint32)stream->size, stream->seed);
+    }
+
+    uint64 seed   = stream->seed;
+    uint64 lane_1 = stream->lane_1;
+    uint64 lane_2 = stream->lane_2;
+    uint32 remaining = stream->pending_size;
+    if (remaining == HASH_BLOCK_SIZE) {
+        HashBlock(pending, &seed, &lane_1, &lane_2);
+        pending  += HASH_BLOCK_SIZE;
+        remaining = 0;
+    }
+    return HashTail(pending, remaining, seed ^ lane_1 ^ lane_2, stream->size);
+}
+
+// CRC-32C (Castagnoli) as used by iSCSI, ext4 and SSE4.2's crc32 instruction. Pass a previous result as crc to continue
+// a checksum across multiple buffers.
+uint32 CRC32C(const void* data, uint32 size, uint32 crc = 0) {
+    const uint8* bytes = (const uint8*)data;
+    crc = ~crc;
+    crc = HasSSE42() ? SSE42_CRC32C(bytes, size, crc) : Scalar_CRC32C(bytes, size, crc);
+    return ~crc;
+}
+
+uint32 CRC32C(StringView string, uint32 crc = 0) {
+    return CRC32C(string.data, string.size, crc);
+}
@@ -0,0 +1,206 @@
+/// Data
+////////////////////////////////////////////////////////////
+
+// Interned strings are identified by atoms, so interned strings can be compared with a single integer compare.
+using Atom = uint32;
+
+constexpr Atom ATOM_NOT_FOUND = UINT32_MAX;
+
+struct InternEntry {
+    uint32 hash;
+    uint32 offset;
+    uint32 size;
+};
+
+// Maps strings to atoms. Strings are copied null-terminated into one chars buffer, and slots is an open-addressed
+// (linear probing) hash index of atom + 1 (0 for empty slots).
+//
+// Capacity is fixed at creation so nothing is ever moved or freed while readers are using it: lookups are lock-free,
+// and interning new strings takes a spin lock. An entry and its chars are written before the slot pointing to them is
+// published, so readers never see a partially written entry.
+struct InternTable {
+    Allocator*       allocator;
+    char*            chars;
+    InternEntry*     entries;
+    volatile uint32* slots;
+    uint32           slot_mask;
+    uint32           max_atom_count;
+    uint32           max_char_count;
+
+    alignas(CACHE_LINE_SIZE) volatile uint32 atom_count;
+    uint32                                   char_count;
+    volatile uint32                          lock;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+uint32 HashInternString(const char* string, uint32 size) {
+    return (uint32)Hash(string, size);
+}
+
+Atom FindAtom(InternTable* table, const char* string, uint32 size, uint32 hash) {
+    for (uint32 slot = hash & table->slot_mask;; slot = (slot + 1) & table->slot_mask) {
+        uint32 slot_value = AtomicLoad(&table->slots[slot]);
+        if (slot_value == 0) {
+            return ATOM_NOT_FOUND;
+        }
+
+        InternEntry* entry = &table->entries[slot_value - 1];
+        if (entry->hash == hash && StringsMatch(&table->chars[entry->offset], entry->size, string, size)) {
+            return slot_value - 1;
+        }
+    }
+}
+
+void LockInternTable(InternTable* table) {
+    Backoff backoff = {};
+    while (AtomicCompareExchange(&table->lock, 1, 0) != 0) {
+        Spin(&backoff);
+    }
+}
+
+void UnlockInternTable(InternTable* table) {
+    AtomicStore(&table->lock, 0);
+}
+
+// Caller must hold table's lock.
+Atom InternLocked(InternTable* table, const char* string, uint32 size, uint32 hash) {
+    // Check again now that no other writers can insert.
+    Atom atom = FindAtom(table, string, size, hash);
+    if (atom != ATOM_NOT_FOUND) {
+        return atom;
+    }
+
+    atom = table->atom_count;
+    if (atom == table->max_atom_count) {
+        UnlockInternTable(table);
+        CTK_FATAL("can't intern string '%.*s': table is at max atom count of %u", size, string, table->max_atom_count);
+    }
+    if (size + 1 > table->max_char_count - table->char_count) {
+        UnlockInternTable(table);
+        CTK_FATAL("can't intern string '%.*s': table has %u of %u chars left", size, string,
+                  table->max_char_count - table->char_count, table->max_char_count);
+    }
+
+    InternEntry* entry = &table->entries[atom];
+    entry->hash   = hash;
+    entry->offset = table->char_count;
+    entry->size   = size;
+    memcpy(&table->chars[entry->offset], string, size);
+    table->chars[entry->offset + size] = '\0';
+    table->char_count += size + 1;
+
+    // Count is published before the slot, so any atom a reader can find is already less than the count.
+    AtomicStore(&table->atom_count, atom + 1);
+    uint32 slot = hash & table->slot_mask;
+    while (table->slots[slot] != 0) {
+        slot = (slot + 1) & table->slot_mask;
+    }
+    AtomicStore(&table->slots[slot], atom + 1);
+    return atom;
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+InternTable CreateInternTable(Allocator* allocator, uint32 max_atom_count, uint32 max_char_count) {
+    if (max_atom_count == 0 || max_atom_count > (1u << 30)) {
+        CTK_FATAL("can't create intern table with max atom count %u: must be in range [1, 2^30]", max_atom_count);
+    }
+
+    // Keep load factor at or below 50% so probe sequences stay short.
+    uint32 slot_count = 2;
+    while (slot_count < max_atom_count * 2) {
+        slot_count *= 2;
+    }
+
+    InternTable table = {};
+    table.allocator      = allocator;
+    table.chars          = AllocateNZ<char>(allocator, max_char_count);
+    table.entries        = AllocateNZ<InternEntry>(allocator, max_atom_count);
+    table.slots          = Allocate<uint32>(allocator, slot_count);
+    table.slot_mask      = slot_count - 1;
+    table.max_atom_count = max_atom_count;
+    table.max_char_count = max_char_count;
+    table.atom_count     = 0;
+    table.char_count     = 0;
+    table.lock           = 0;
+    return table;
+}
+
+void DestroyInternTable(InternTable* table) {
+    CTK_ASSERT(table->allocator != NULL);
+
+    Deallocate(table->allocator, table->chars);
+    Deallocate(table->allocator, table->entries);
+    Deallocate(table->allocator, (uint32*)table->slots);
+    *table = {};
+}
+
+// Lock-free; returns ATOM_NOT_FOUND if string hasn't been interned.
+Atom FindAtom(InternTable* table, const char* string, uint32 size) {
+    return FindAtom(table, string, size, HashInternString(string, size));
+}
+
+Atom FindAtom(InternTable* table, const char* nt_string) {
+    return FindAtom(table, nt_string, StringSize(nt_string));
+}
+
+Atom FindAtom(InternTable* table, StringView string) {
+    return FindAtom(table, string.data, string.size);
+}
+
+// Returns string's existing atom, or interns a copy of string. Only takes the lock if string hasn't been interned.
+Atom Intern(InternTable* table, const char* string, uint32 size) {
+    uint32 hash = HashInternString(string, size);
+    Atom atom = FindAtom(table, string, size, hash);
+    if (atom != ATOM_NOT_FOUND) {
+        return atom;
+    }
+
+    LockInternTable(table);
+    atom = InternLocked(table, string, size, hash);
+    UnlockInternTable(table);
+    return atom;
+}
+
+Atom Intern(InternTable* table, const char* nt_string) {
+    return Intern(table, nt_string, StringSize(nt_string));
+}
+
+Atom Intern(InternTable* table, StringView string) {
+    return Intern(table, string.data, string.size);
+}
+
+// Interns string_count strings into atoms. Strings that are already interned are found lock-free, and the lock is taken
+// once for all the rest, rather than once per string.
+void InternRange(InternTable* table, const StringView* strings, uint32 string_count, Atom* atoms) {
+    bool all_found = true;
+    for (uint32 i = 0; i < string_count; i += 1) {
+        atoms[i] = FindAtom(table, strings[i]);
+        all_found &= atoms[i] != ATOM_NOT_FOUND;
+    }
+    if (all_found) {
+        return;
+    }
+
+    LockInternTable(table);
+    for (uint32 i = 0; i < string_count; i += 1) {
+        if (atoms[i] == ATOM_NOT_FOUND) {
+            const StringView* string = &strings[i];
+            atoms[i] = InternLocked(table, string->data, string->size, HashInternString(string->data, string->size));
+        }
+    }
+    UnlockInternTable(table);
+}
+
+// Returned view is null-terminated and valid until table is destroyed.
+StringView GetAtomString(InternTable* table, Atom atom) {
+    CTK_ASSERT(atom < AtomicLoad(&table->atom_count));
+
+    InternEntry* entry = &table->entries[atom];
+    return { .data = &table->chars[entry->offset], .size = entry->size };
+}
+
+uint32 GetAtomCount(InternTable* table) {
+    return AtomicLoad(&table->atom_count);
+}
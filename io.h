@@ -84,24 +84,27 @@ void PrintLine(OutputColor output_color, const char* msg, Args... args) {
     PrintLine();
 }
 
+// Overwrites current line; output is padded to INLINE_LINE_SIZE chars to clear leftovers from a longer previous line.
+constexpr sint32 INLINE_LINE_SIZE = 128;
+
 template<typename ...Args>
 void PrintInline(const char* msg, Args... args) {
-    constexpr sint32 BUFFER_SIZE = 128;
-    char buffer[BUFFER_SIZE] = {};
-    sint32 chars_written = snprintf(buffer, BUFFER_SIZE, msg, args...);
-    memset(buffer + chars_written, ' ', BUFFER_SIZE - chars_written);
     Print('\r');
-    Print("%.*s", BUFFER_SIZE, buffer);
+    sint32 chars_printed = printf(msg, args...);
+    if (chars_printed < INLINE_LINE_SIZE) {
+        printf("%*s", INLINE_LINE_SIZE - chars_printed, "");
+    }
 }
 
 template<typename ...Args>
 void PrintInline(OutputColor output_color, const char* msg, Args... args) {
-    constexpr sint32 BUFFER_SIZE = 128;
-    char buffer[BUFFER_SIZE] = {};
-    sint32 chars_written = snprintf(buffer, BUFFER_SIZE, msg, args...);
-    memset(buffer + chars_written, ' ', BUFFER_SIZE - chars_written);
     Print('\r');
-    Print(output_color, "%.*s", BUFFER_SIZE, buffer);
+    PrintColor(output_color);
+    sint32 chars_printed = printf(msg, args...);
+    PrintColorReset();
+    if (chars_printed < INLINE_LINE_SIZE) {
+        printf("%*s", INLINE_LINE_SIZE - chars_printed, "");
+    }
 }
 
 void PrintLines(uint32 count) {
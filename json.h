@@ -1,7 +1,6 @@
 /// Data
 ////////////////////////////////////////////////////////////
-struct JSONTokenParseState {
-    uint32 char_index;
+struct JSONFilePosition {
     uint32 line;
     uint32 column;
 };
@@ -32,6 +31,10 @@ struct JSONToken {
     JSONTokenType type;
     uint32        index;
     uint32        size;
+    union {
+        uint32 close_index; // Token index of an open bracket's matching close bracket.
+        bool   has_escapes; // Whether a string contains escape sequences, so strings are only scanned for them once.
+    };
 };
 
 struct JSONListState {
@@ -44,6 +47,11 @@ struct JSONNodeParseState {
     uint32               key_index;
     uint32               key_offset;
     uint32               value_offset;
+
+    // If not NULL, BuildKeyTable() takes slots from here instead of allocating them, so threads parsing into the same
+    // JSON never share its allocator.
+    uint32*              key_table_slots;
+    uint32               key_table_slots_left;
 };
 
 enum struct JSONNodeType {
@@ -61,6 +69,7 @@ struct JSONNodeList {
     uint32 node_index;
     uint32 key_index;
     uint32 size;
+    uint32 key_table_index; // Index + 1 of object's table in JSON::key_tables, or 0 if it has none.
 };
 
 struct JSONNode {
@@ -77,59 +86,68 @@ struct JSONNode {
     };
 };
 
+// Objects with at least this many keys get a key table when they're parsed; smaller objects are searched linearly.
+constexpr uint32 JSON_KEY_TABLE_MIN_KEYS = 32;
+
+// Open-addressed (linear probing) hash index of an object's keys. slots hold child index + 1 (0 for empty slots).
+struct JSONKeyTable {
+    uint32* slots;
+    uint32  slot_mask;
+};
+
 struct JSON {
-    Allocator*      allocator;
-    JSONNode        root_node;
-    Array<JSONNode> nodes;
-    uint32          string_buffer_size;
-    uint32          max_keys;
-    char*           string_buffer;
-    uint32*         key_sizes;
-    uint32*         key_offsets;
+    uint32              id; // Unique per load, so JSONPaths can tell if their cached node is from this JSON.
+    Allocator*          allocator;
+    JSONNode            root_node;
+    Array<JSONNode>     nodes;
+    uint32              string_buffer_size;
+    uint32              max_keys;
+    uint32              max_depth; // Deepest nesting of arrays and objects, with root at depth 1 (0 for empty files).
+    char*               string_buffer;
+    const char*         key_chars; // What key_offsets index into: string_buffer, or mapped_file's data if it's mapped.
+    uint32*             key_sizes;
+    uint32*             key_offsets;
+    Array<JSONKeyTable> key_tables;
+    uint32*             key_table_slots; // Slots of all key tables if they share one buffer, or NULL if not.
+    MappedFile          mapped_file;
 };
 
-using PrintChildFunc = Func<void, JSONNode*, uint32, uint32, uint32>;
-struct PrintChildFuncs {
-    PrintChildFunc array;
-    PrintChildFunc object;
+uint32 g_json_load_count;
+
+constexpr uint32 JSON_PATH_MAX_SEGMENTS = 64;
+
+enum struct JSONPathSegmentType {
+    KEY,
+    INDEX,
 };
 
-constexpr bool JSON_SYMBOL[128] = {
-    /*0*/   false, false, false,     false,     false,     false,     false, false,
-    /*8*/   false, false, false,     false,     false,     false,     false, false,
-    /*16*/  false, false, false,     false,     false,     false,     false, false,
-    /*24*/  false, false, false,     false,     false,     false,     false, false,
-    /*32*/  false, false, false,     false,     false,     false,     false, false,
-    /*40*/  false, false, false,     false,     true/*,*/, false,     false, false,
-    /*48*/  false, false, false,     false,     false,     false,     false, false,
-    /*56*/  false, false, true/*:*/, false,     false,     false,     false, false,
-    /*64*/  false, false, false,     false,     false,     false,     false, false,
-    /*72*/  false, false, false,     false,     false,     false,     false, false,
-    /*80*/  false, false, false,     false,     false,     false,     false, false,
-    /*88*/  false, false, false,     true/*[*/, false,     true/*]*/, false, false,
-    /*96*/  false, false, false,     false,     false,     false,     false, false,
-    /*104*/ false, false, false,     false,     false,     false,     false, false,
-    /*112*/ false, false, false,     false,     false,     false,     false, false,
-    /*120*/ false, false, false,     true/*{*/, false,     true/*}*/, false, false,
+struct JSONPathSegment {
+    JSONPathSegmentType type;
+    uint32              index;
+    uint32              key_offset;
+    uint32              key_size;
+    uint32              key_hash;
 };
 
-constexpr bool JSON_SKIPPABLE[128] = {
-    /*0*/   true/*\0*/, false,      false,      false, false, false,      false, false,
-    /*8*/   false,      true/*\t*/, true/*\n*/, false, false, true/*\r*/, false, false,
-    /*16*/  false,      false,      false,      false, false, false,      false, false,
-    /*24*/  false,      false,      false,      false, false, false,      false, false,
-    /*32*/  true/* */,  false,      false,      false, false, false,      false, false,
-    /*40*/  false,      false,      false,      false, false, false,      false, false,
-    /*48*/  false,      false,      false,      false, false, false,      false, false,
-    /*56*/  false,      false,      false,      false, false, false,      false, false,
-    /*64*/  false,      false,      false,      false, false, false,      false, false,
-    /*72*/  false,      false,      false,      false, false, false,      false, false,
-    /*80*/  false,      false,      false,      false, false, false,      false, false,
-    /*88*/  false,      false,      false,      false, false, false,      false, false,
-    /*96*/  false,      false,      false,      false, false, false,      false, false,
-    /*104*/ false,      false,      false,      false, false, false,      false, false,
-    /*112*/ false,      false,      false,      false, false, false,      false, false,
-    /*120*/ false,      false,      false,      false, false, false,      false, false,
+// Search string parsed once into segments, so searching with it doesn't re-parse it or re-hash its keys. Keys are
+// copied into keys, so the search string isn't needed after compiling.
+struct JSONPath {
+    Allocator*       allocator;
+    JSONPathSegment* segments;
+    uint32           segment_count;
+    char*            keys;
+
+    // Set by CompileJSONPath(); last node found is reused while searching the same JSON load from the same node.
+    bool      cache_node;
+    uint32    cached_json_id;
+    JSONNode* cached_start_node;
+    JSONNode* cached_node;
+};
+
+using PrintChildFunc = Func<void, JSONNode*, uint32, uint32, uint32>;
+struct PrintChildFuncs {
+    PrintChildFunc array;
+    PrintChildFunc object;
 };
 
 constexpr JSONTokenType JSON_TOKEN_TYPE_SYMBOL[128] = {
@@ -151,6 +169,203 @@ constexpr JSONTokenType JSON_TOKEN_TYPE_SYMBOL[128] = {
     /*120*/ JSONTokenType::NONE, JSONTokenType::NONE, JSONTokenType::NONE,  JSONTokenType::OPEN_CURLY_BRACKET,  JSONTokenType::NONE,  JSONTokenType::CLOSE_CURLY_BRACKET,  JSONTokenType::NONE, JSONTokenType::NONE,
 };
 
+// Bitmasks of a 64-char block of a JSON file, where bit i is set if char i is in the mask.
+struct JSONBlockMasks {
+    uint64 quotes;
+    uint64 backslashes;
+    uint64 symbols;    // { } [ ] : ,
+    uint64 whitespace; // ' ' \t \n \r \0
+};
+
+// Carried from each 64-char block to the next while finding structurals.
+struct JSONStructuralState {
+    uint64 escaped;            // Low bit set if the next block's first char is escaped.
+    uint64 in_string;          // All bits set if the next block starts inside a string.
+    uint64 follows_value_char; // Low bit set if the last block's last char was a value char.
+};
+
+/// Structural Index Utils
+////////////////////////////////////////////////////////////
+// Structurals are the indexes of chars ParseTokens() visits: symbols and the first char of each number or literal
+// outside of strings, and every unescaped quotation mark, so a string token runs from one structural to the next.
+// Finding them 64 chars at a time with bitmasks means whitespace and string contents are never branched on.
+
+// Returns mask of chars escaped by a backslash. A backslash run escapes the char after it if the run's length is odd,
+// which is found without looping over runs by adding the odd-aligned run starts to the runs: runs with odd-aligned
+// starts carry out past their end, while runs with even-aligned starts are left as is.
+uint64 FindEscapedChars(JSONStructuralState* state, uint64 backslashes) {
+    constexpr uint64 EVEN_BITS = 0x5555555555555555;
+    backslashes &= ~state->escaped; // An escaped backslash doesn't escape the char after it.
+    uint64 follows_backslash = backslashes << 1 | state->escaped;
+    uint64 odd_run_starts    = backslashes & ~EVEN_BITS & ~follows_backslash;
+    uint64 carried_runs      = odd_run_starts + backslashes;
+    state->escaped = carried_runs < odd_run_starts ? 1 : 0;
+    return (EVEN_BITS ^ (carried_runs << 1)) & follows_backslash;
+}
+
+// Returns mask where bit i is the XOR of bits [0, i], which turns a mask of quotation marks into a mask of chars in
+// strings, including opening quotation marks but not closing ones.
+uint64 CLMUL_PrefixXOR(uint64 bits) {
+    // Carry-less multiplication by all 1s XORs each bit into every bit above it in a single instruction.
+    __m128i product = _mm_clmulepi64_si128(_mm_set_epi64x(0, (sint64)bits), _mm_set1_epi8(-1), 0);
+    return (uint64)_mm_cvtsi128_si64(product);
+}
+
+// Writes indexes of the set bits of block_structurals to structurals.
+void PushStructurals(Array<uint32>* structurals, uint32 block_index, uint64 block_structurals) {
+    // Reserve space for a full block, so indexes can be written in groups of 4 without checking the count after each
+    // one (that branch would mispredict on every block). Indexes written past the block's structural count are
+    // overwritten by the next block; bit 63 is set when finding them so CountTrailingZeros() isn't passed 0.
+    constexpr uint64 LAST_BIT = (uint64)1 << 63;
+    if (structurals->count + 64 > structurals->size) {
+        ResizeNZ(structurals, structurals->size * 2);
+    }
+
+    uint32* indexes = &structurals->data[structurals->count];
+    uint32 count = PopCount(block_structurals);
+    for (uint32 i = 0; i < count; i += 4) {
+        indexes[i + 0] = block_index + CountTrailingZeros(block_structurals | LAST_BIT);
+        block_structurals &= block_structurals - 1;
+        indexes[i + 1] = block_index + CountTrailingZeros(block_structurals | LAST_BIT);
+        block_structurals &= block_structurals - 1;
+        indexes[i + 2] = block_index + CountTrailingZeros(block_structurals | LAST_BIT);
+        block_structurals &= block_structurals - 1;
+        indexes[i + 3] = block_index + CountTrailingZeros(block_structurals | LAST_BIT);
+        block_structurals &= block_structurals - 1;
+    }
+    structurals->count += count;
+}
+
+void PushBlockStructurals(JSONStructuralState* state, JSONBlockMasks* masks, uint32 block_index,
+                          Array<uint32>* structurals) {
+    uint64 quotes = masks->quotes & ~FindEscapedChars(state, masks->backslashes);
+    uint64 in_string = CLMUL_PrefixXOR(quotes) ^ state->in_string;
+    state->in_string = (uint64)((sint64)in_string >> 63);
+
+    // Value chars are number, literal and string chars. A value char following a symbol, whitespace or quotation mark
+    // starts a number or literal (or is an invalid char ParseTokens() will report).
+    uint64 value_chars = ~(masks->symbols | masks->whitespace | quotes);
+    uint64 value_starts = value_chars & ~(value_chars << 1 | state->follows_value_char);
+    state->follows_value_char = value_chars >> 63;
+
+    PushStructurals(structurals, block_index, ((masks->symbols | value_starts) & ~in_string) | quotes);
+}
+
+// Pads the last partial block of chars with whitespace, which is never structural.
+JSONBlockMasks ClassifyTailBlock(const char* chars, uint32 size, Func<JSONBlockMasks, const char*> classify) {
+    alignas(64) char tail[64];
+    memset(tail, ' ', sizeof(tail));
+    memcpy(tail, chars, size);
+    return classify(tail);
+}
+
+/// Scalar Implementations
+////////////////////////////////////////////////////////////
+// Returns true if chars end inside a string.
+bool Scalar_FindStructurals(const char* chars, uint32 size, Array<uint32>* structurals) {
+    bool in_string          = false;
+    bool escaped            = false;
+    bool follows_value_char = false;
+    for (uint32 i = 0; i < size; i += 1) {
+        char c = chars[i];
+        if (c == '\"' && !escaped) {
+            PushResizeNZ(structurals, i, structurals->size);
+            in_string          = !in_string;
+            follows_value_char = false;
+            continue;
+        }
+        escaped = c == '\\' && !escaped;
+
+        bool is_symbol     = c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',';
+        bool is_whitespace = c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\0';
+        if (!in_string && (is_symbol || (!is_whitespace && !follows_value_char))) {
+            PushResizeNZ(structurals, i, structurals->size);
+        }
+        follows_value_char = !is_symbol && !is_whitespace;
+    }
+    return in_string;
+}
+
+/// SSE2 Implementations
+////////////////////////////////////////////////////////////
+uint64 SSE2_MatchMask(__m128i chars, char c) {
+    return (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8(c)));
+}
+
+JSONBlockMasks SSE2_ClassifyJSONBlock(const char* block) {
+    JSONBlockMasks masks = {};
+    for (uint32 i = 0; i < 64; i += 16) {
+        __m128i chars = _mm_loadu_si128((const __m128i*)&block[i]);
+
+        // '[' and ']' only differ from '{' and '}' by bit 5, so setting it matches both brackets in one compare.
+        __m128i bracket_chars = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+        uint64 symbols    = SSE2_MatchMask(bracket_chars, '{') | SSE2_MatchMask(bracket_chars, '}') |
+                            SSE2_MatchMask(chars, ':')         | SSE2_MatchMask(chars, ',');
+        uint64 whitespace = SSE2_MatchMask(chars, ' ')  | SSE2_MatchMask(chars, '\t') | SSE2_MatchMask(chars, '\n') |
+                            SSE2_MatchMask(chars, '\r') | SSE2_MatchMask(chars, '\0');
+        masks.quotes      |= SSE2_MatchMask(chars, '\"') << i;
+        masks.backslashes |= SSE2_MatchMask(chars, '\\') << i;
+        masks.symbols     |= symbols << i;
+        masks.whitespace  |= whitespace << i;
+    }
+    return masks;
+}
+
+// Requires PCLMULQDQ. Returns true if chars end inside a string.
+bool SSE2_FindStructurals(const char* chars, uint32 size, Array<uint32>* structurals) {
+    JSONStructuralState state = {};
+    uint32 i = 0;
+    for (; i + 64 <= size; i += 64) {
+        JSONBlockMasks masks = SSE2_ClassifyJSONBlock(&chars[i]);
+        PushBlockStructurals(&state, &masks, i, structurals);
+    }
+    if (i < size) {
+        JSONBlockMasks masks = ClassifyTailBlock(&chars[i], size - i, SSE2_ClassifyJSONBlock);
+        PushBlockStructurals(&state, &masks, i, structurals);
+    }
+    return state.in_string != 0;
+}
+
+/// AVX2 Implementations
+////////////////////////////////////////////////////////////
+uint64 AVX2_MatchMask(__m256i chars, char c) {
+    return (uint32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8(c)));
+}
+
+JSONBlockMasks AVX2_ClassifyJSONBlock(const char* block) {
+    JSONBlockMasks masks = {};
+    for (uint32 i = 0; i < 64; i += 32) {
+        __m256i chars = _mm256_loadu_si256((const __m256i*)&block[i]);
+
+        // Same as SSE2_ClassifyJSONBlock().
+        __m256i bracket_chars = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+        uint64 symbols    = AVX2_MatchMask(bracket_chars, '{') | AVX2_MatchMask(bracket_chars, '}') |
+                            AVX2_MatchMask(chars, ':')         | AVX2_MatchMask(chars, ',');
+        uint64 whitespace = AVX2_MatchMask(chars, ' ')  | AVX2_MatchMask(chars, '\t') | AVX2_MatchMask(chars, '\n') |
+                            AVX2_MatchMask(chars, '\r') | AVX2_MatchMask(chars, '\0');
+        masks.quotes      |= AVX2_MatchMask(chars, '\"') << i;
+        masks.backslashes |= AVX2_MatchMask(chars, '\\') << i;
+        masks.symbols     |= symbols << i;
+        masks.whitespace  |= whitespace << i;
+    }
+    return masks;
+}
+
+// Requires PCLMULQDQ. Returns true if chars end inside a string.
+bool AVX2_FindStructurals(const char* chars, uint32 size, Array<uint32>* structurals) {
+    JSONStructuralState state = {};
+    uint32 i = 0;
+    for (; i + 64 <= size; i += 64) {
+        JSONBlockMasks masks = AVX2_ClassifyJSONBlock(&chars[i]);
+        PushBlockStructurals(&state, &masks, i, structurals);
+    }
+    if (i < size) {
+        JSONBlockMasks masks = ClassifyTailBlock(&chars[i], size - i, AVX2_ClassifyJSONBlock);
+        PushBlockStructurals(&state, &masks, i, structurals);
+    }
+    return state.in_string != 0;
+}
+
 /// Utils
 ////////////////////////////////////////////////////////////
 const char* TokenTypeName(JSONTokenType type) {
@@ -194,428 +409,389 @@ const char* NodeTypeName(JSONNodeType type) {
     return NODE_TYPE_NAMES[(uint32)type];
 }
 
-void ParseLiteralToken(JSONTokenParseState* parse_state, String* json_file, const char* value, uint32 size) {
-    if (parse_state->char_index + size >= json_file->count) {
-        CTK_FATAL("reached end of JSON file parsing literal %s on line %u column %u", value,
-                  parse_state->line,
-                  parse_state->column);
-    }
-    if (!StringsMatch(&json_file->data[parse_state->char_index], size, value)) {
-        CTK_FATAL("invalid literal %s on line %u column %u", value,
-                  parse_state->line,
-                  parse_state->column);
+// Line and column are only needed for error messages, so they're found by rescanning the file up to char_index rather
+// than being tracked for every char while tokenizing.
+JSONFilePosition GetFilePosition(String* json_file, uint32 char_index) {
+    JSONFilePosition position = { .line = 1, .column = 1 };
+    for (uint32 i = 0; i < char_index && i < json_file->count; i += 1) {
+        if (json_file->data[i] == '\n') {
+            position.line  += 1;
+            position.column = 1;
+        }
+        else {
+            position.column += 1;
+        }
     }
-    parse_state->char_index += size;
-    parse_state->column     += size;
+    return position;
 }
 
-Array<JSONToken> ParseTokens(JSON* json, String* json_file) {
-    auto tokens = CreateArray<JSONToken>(json->allocator);
+// Tokens never outnumber structurals, so tokens is sized up front and never grows.
+JSONToken* PushToken(Array<JSONToken>* tokens, JSONTokenType type, uint32 index, uint32 size) {
+    CTK_ASSERT(tokens->count < tokens->size);
 
-    // Parse File
-    JSONTokenParseState parse_state = {
-        .char_index = 0,
-        .line       = 1,
-        .column     = 1,
-    };
+    JSONToken* token = &tokens->data[tokens->count];
+    token->type        = type;
+    token->index       = index;
+    token->size        = size;
+    token->close_index = 0;
+    tokens->count += 1;
+    return token;
+}
 
-    // Count max tokens.
-    uint32 max_tokens = 0;
-    uint32 depth      = 0;
-    uint32 max_depth  = 0;
-    while (parse_state.char_index < json_file->count) {
-        char c = json_file->data[parse_state.char_index];
-        if (c == '\"') {
-            uint32 start_line = parse_state.line;
-            uint32 start_column = parse_state.column;
-            max_tokens += 1;
-            parse_state.char_index += 1; // Skip opening quotation mark.
-            parse_state.column += 1;
-
-            // Find end of string token.
-            bool escape_next = false;
-            while (true) {
-                if (parse_state.char_index >= json_file->count) {
-                    CTK_FATAL("reached EOF while parsing string starting on line %u column %u",
-                              start_line,
-                              start_column);
-                }
-                char string_char = json_file->data[parse_state.char_index];
-                if (escape_next) {
-                    escape_next = false;
-                }
-                else if (string_char == '\\') {
-                    escape_next = true;
-                }
-                else if (string_char == '\n') {
-                    parse_state.line += 1;
-                    parse_state.column = 0; // Reset to 0 so column increment after char_index increment will be 1.
-                }
-                else if (string_char == '\"') {
-                    parse_state.char_index += 1; // Skips close quotation mark.
-                    parse_state.column += 1;
-                    break;
-                }
-                parse_state.char_index += 1;
-                parse_state.column += 1;
-                json->string_buffer_size += 1;
-            }
-        }
-        else if (c == 'n') {
-            max_tokens += 1;
-            ParseLiteralToken(&parse_state, json_file, "null", 4);
+bool IsJSONDelimiter(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\0' || c == '\"' ||
+           c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',';
+}
 
-            // Parsing ends after last char of value; no need to increment parse_state.char_index.
-        }
-        else if (c == 't') {
-            max_tokens += 1;
-            ParseLiteralToken(&parse_state, json_file, "true", 4);
+void ParseLiteralToken(String* json_file, uint32 char_index, const char* value, uint32 size) {
+    if (char_index + size > json_file->count) {
+        JSONFilePosition position = GetFilePosition(json_file, char_index);
+        CTK_FATAL("reached end of JSON file parsing literal %s on line %u column %u", value,
+                  position.line,
+                  position.column);
+    }
+    if (!StringsMatch(&json_file->data[char_index], size, value)) {
+        JSONFilePosition position = GetFilePosition(json_file, char_index);
+        CTK_FATAL("invalid literal %s on line %u column %u", value,
+                  position.line,
+                  position.column);
+    }
+}
 
-            // Parsing ends after last char of value; no need to increment parse_state.char_index.
+// Returns index of the char after the number starting at char_index and writes the number's token type to type.
+uint32 ParseNumberToken(String* json_file, uint32 char_index, JSONTokenType* type) {
+    const char* chars = json_file->data;
+    uint32      size  = json_file->count;
+    uint32      i     = char_index;
+    *type = JSONTokenType::UINT32;
+
+    // Parse char after negative sign.
+    if (chars[i] == '-') {
+        i += 1;
+        if (i >= size) {
+            JSONFilePosition position = GetFilePosition(json_file, i);
+            CTK_FATAL("reached EOF while parsing number after negative sign on line %u column %u",
+                      position.line,
+                      position.column);
         }
-        else if (c == 'f') {
-            max_tokens += 1;
-            ParseLiteralToken(&parse_state, json_file, "false", 5);
-
-            // Parsing ends after last char of value; no need to increment parse_state.char_index.
+        if (!IsDigit(chars[i])) {
+            JSONFilePosition position = GetFilePosition(json_file, i);
+            CTK_FATAL("non-numeric character following negative sign on line %u column %u: '%c'",
+                      position.line,
+                      position.column,
+                      chars[i]);
         }
-        else if (ASCII_NUMERIC[c] || c == '-') {
-            max_tokens += 1;
-            parse_state.char_index += 1;
-            parse_state.column += 1;
-
-            JSONTokenType token_type = JSONTokenType::UINT32;
-
-            // Parse char after negative sign.
-            if (c == '-') {
-                if (parse_state.char_index >= json_file->count) {
-                    CTK_FATAL("reached EOF while parsing number after negative sign on line %u column %u",
-                              parse_state.line,
-                              parse_state.column);
-                }
-                if (!ASCII_NUMERIC[json_file->data[parse_state.char_index]]) {
-                    CTK_FATAL("non-numeric character following negative sign on line %u column %u: '%c'",
-                              parse_state.line,
-                              parse_state.column,
-                              json_file->data[parse_state.char_index]);
-                }
-                token_type = JSONTokenType::SINT32;
-                parse_state.char_index += 1;
-                parse_state.column += 1;
-            }
+        *type = JSONTokenType::SINT32;
+    }
 
-            // Parse rest of numeric value.
-            while (parse_state.char_index < json_file->count) {
-                char num_char = json_file->data[parse_state.char_index];
-                if (num_char == '.') {
-                    if (token_type == JSONTokenType::FLOAT32) {
-                        CTK_FATAL("multiple decimals in numeric value on line %u column %u",
-                                  parse_state.line,
-                                  parse_state.column);
-                    }
-                    else {
-                        token_type = JSONTokenType::FLOAT32;
-                    }
-                }
-                else if (num_char == 'e') {
-                    parse_state.char_index += 1;
-                    parse_state.column += 1;
-                    num_char = json_file->data[parse_state.char_index];
-                    if (num_char != '-' && num_char != '+' && !ASCII_NUMERIC[num_char]) {
-                        CTK_FATAL("character following e on line %u column %u must be '-', '+' or a numeric value for "
-                                  "the exponent",
-                                  parse_state.line,
-                                  parse_state.column)
-                    }
-                    if (num_char == '-' || num_char == '+') {
-                        parse_state.char_index += 1;
-                        parse_state.column += 1;
-                    }
-                    while (parse_state.char_index < json_file->count) {
-                        num_char = json_file->data[parse_state.char_index];
-                        if (!ASCII_NUMERIC[num_char]) {
-                            break;
-                        }
-                        parse_state.char_index += 1;
-                        parse_state.column += 1;
-                    }
-                    break;
-                }
-                else if (!ASCII_NUMERIC[num_char]) {
-                    break;
-                }
-                parse_state.char_index += 1;
-                parse_state.column += 1;
-            }
+    while (i < size && IsDigit(chars[i])) {
+        i += 1;
+    }
 
-            // Parsing ends after last char of value; no need to increment parse_state.char_index.
+    if (i < size && chars[i] == '.') {
+        *type = JSONTokenType::FLOAT32;
+        i += 1;
+        while (i < size && IsDigit(chars[i])) {
+            i += 1;
         }
-        else if (JSON_SKIPPABLE[c]) {
-            // Skip
-            if (c == '\n') {
-                parse_state.line += 1;
-                parse_state.column = 0; // Reset to 0 so column increment after char_index increment will be 1.
-            }
-            parse_state.char_index += 1;
-            parse_state.column += 1;
+        if (i < size && chars[i] == '.') {
+            JSONFilePosition position = GetFilePosition(json_file, i);
+            CTK_FATAL("multiple decimals in numeric value on line %u column %u",
+                      position.line,
+                      position.column);
         }
-        else if (JSON_SYMBOL[c]) {
-            max_tokens += 1;
-
-            JSONTokenType token_type = JSON_TOKEN_TYPE_SYMBOL[c];
-            if (token_type == JSONTokenType::NONE) {
-                CTK_FATAL("failed to find symbol token type for symbol character on line %u column %u: \'%c\'",
-                          parse_state.line,
-                          parse_state.column,
-                          c);
-            }
-
-            if (token_type == JSONTokenType::OPEN_SQUARE_BRACKET ||
-                token_type == JSONTokenType::OPEN_CURLY_BRACKET) {
-                depth += 1;
-                if (depth > max_depth) {
-                    max_depth = depth;
-                }
-            }
-            else if (token_type == JSONTokenType::CLOSE_SQUARE_BRACKET ||
-                     token_type == JSONTokenType::CLOSE_CURLY_BRACKET) {
-                if (depth == 0) {
-                    CTK_FATAL("found extraneous close bracket on line %u column %u: \'%c\'",
-                              parse_state.line,
-                              parse_state.column,
-                              c);
-                }
-                depth -= 1;
-            }
-
-            // Every key has a colon following it.
-            if (token_type == JSONTokenType::COLON) {
-                json->max_keys += 1;
-            }
+    }
 
-            // Parsing ends on last char of token; skip to next.
-            parse_state.char_index += 1;
-            parse_state.column += 1;
+    // Exponent is part of the token, so values like 2.3e10 and 1e5 are parsed as floats including their exponent.
+    if (i < size && (chars[i] == 'e' || chars[i] == 'E')) {
+        *type = JSONTokenType::FLOAT32;
+        i += 1;
+        if (i < size && (chars[i] == '-' || chars[i] == '+')) {
+            i += 1;
         }
-        else {
-            CTK_FATAL("invalid character on line %u column %u: \'%c\'",
-                      parse_state.line,
-                      parse_state.column,
-                      c);
+        if (i >= size || !IsDigit(chars[i])) {
+            JSONFilePosition position = GetFilePosition(json_file, i);
+            CTK_FATAL("exponent on line %u column %u must be digits with an optional '-' or '+' sign",
+                      position.line,
+                      position.column)
+        }
+        while (i < size && IsDigit(chars[i])) {
+            i += 1;
         }
     }
-    if (max_tokens == 0) {
-        return tokens;
+
+    return i;
+}
+
+// Numbers and literals must be followed by a delimiter; the chars after them aren't structurals, so they're checked
+// here instead of being reported as invalid chars by ParseTokens().
+void CheckValueEnd(String* json_file, uint32 char_index) {
+    if (char_index < json_file->count && !IsJSONDelimiter(json_file->data[char_index])) {
+        JSONFilePosition position = GetFilePosition(json_file, char_index);
+        CTK_FATAL("invalid character on line %u column %u: \'%c\'",
+                  position.line,
+                  position.column,
+                  json_file->data[char_index]);
+    }
+}
+
+Array<uint32> FindStructurals(Allocator* allocator, String* json_file) {
+    auto structurals = CreateArray<uint32>(allocator);
+    ResizeNZ(&structurals, json_file->count / 4 + 64);
+
+    const char* chars = json_file->data;
+    uint32      size  = json_file->count;
+    bool ends_in_string = HasAVX2() && HasPCLMUL() ? AVX2_FindStructurals(chars, size, &structurals) :
+                          HasPCLMUL()              ? SSE2_FindStructurals(chars, size, &structurals) :
+                                                     Scalar_FindStructurals(chars, size, &structurals);
+    if (ends_in_string) {
+        // Nothing after an unterminated string's opening quotation mark is structural, so it's the last structural.
+        JSONFilePosition position = GetFilePosition(json_file, structurals.data[structurals.count - 1]);
+        DestroyArray(&structurals);
+        CTK_FATAL("reached EOF while parsing string starting on line %u column %u",
+                  position.line,
+                  position.column);
     }
 
-    // Parse tokens.
-    parse_state.char_index = 0;
-    Resize(&tokens, max_tokens);
+    return structurals;
+}
 
-    // Track what list tokens belong to. An extra level is added to stack to allow resetting is_array flag on the final
-    // close bracket. This removes the need to check is_array_stack.count > 0 every time is_array needs reset.
-    uint32 frame = TempStack_PushFrame();
-    auto is_array_stack = CreateArray<bool>(TempStack_Allocator(), max_depth + 1);
-    bool is_array = false;
-    Push(&is_array_stack, false);
-
-    while (parse_state.char_index < json_file->count) {
-        char c = json_file->data[parse_state.char_index];
-        if (c == '\"') {
-            // Every string token will have its own node.
-            if (is_array) {
-                json->nodes.size += 1;
-            }
+bool HasEscapes(const char* string, uint32 size) {
+    return FindChar(string, size, '\\') != STRING_NOT_FOUND;
+}
 
-            parse_state.char_index += 1; // Skip opening quotation mark.
+// Tokenizes json_file by visiting only its structurals, counting the nodes, keys and string chars ParseNodes() needs to
+// size its buffers along the way. Strings of a mapped json_file are only copied if they contain escape sequences, so
+// only those are counted. Each open bracket token gets the index of its matching close bracket token, so lists can be
+// skipped over without rescanning their tokens.
+Array<JSONToken> ParseTokens(JSON* json, String* json_file) {
+    const char* chars = json_file->data;
+    Array<uint32> structurals = FindStructurals(json->allocator, json_file);
 
-            JSONToken* token = Push(&tokens);
-            token->type  = JSONTokenType::STRING;
-            token->index = parse_state.char_index;
-            token->size  = 0;
+    auto tokens = CreateArray<JSONToken>(json->allocator);
+    ResizeNZ(&tokens, structurals.count + 1);
 
-            // Find end of string token.
-            bool escape_next = false;
-            while (true) {
-                char string_char = json_file->data[parse_state.char_index];
-                if (escape_next) {
-                    escape_next = false;
-                }
-                else if (string_char == '\\') {
-                    escape_next = true;
-                }
-                else if (string_char == '\"') {
-                    parse_state.char_index += 1; // Skips close quotation mark.
-                    break;
+    // Track the open bracket tokens of the lists tokens belong to. An extra level is added to stack to allow resetting
+    // is_array flag on the final close bracket. This removes the need to check open_bracket_stack.count > 0 every time
+    // is_array needs reset.
+    auto open_bracket_stack = CreateArray<uint32>(json->allocator, 64);
+    bool is_array = false;
+    Push(&open_bracket_stack, UINT32_MAX);
+
+    uint32 node_count         = 0;
+    uint32 key_count          = 0;
+    uint32 max_depth          = 0;
+    uint32 string_buffer_size = 0;
+    for (uint32 s = 0; s < structurals.count; s += 1) {
+        uint32 i = structurals.data[s];
+        char c = chars[i];
+        switch (c) {
+            case '\"': {
+                // Next structural is the closing quotation mark. Token is the string's contents without them.
+                s += 1;
+                uint32 string_size = structurals.data[s] - i - 1;
+                JSONToken* token = PushToken(&tokens, JSONTokenType::STRING, i + 1, string_size);
+                token->has_escapes = HasEscapes(&chars[i + 1], string_size);
+                if (json->mapped_file.data == NULL || token->has_escapes) {
+                    string_buffer_size += string_size;
                 }
-                parse_state.char_index += 1;
-                token->size += 1;
+                node_count += is_array ? 1 : 0;
+                break;
             }
-        }
-        else if (c == 'n') {
-            // Every literal token will have its own node.
-            if (is_array) {
-                json->nodes.size += 1;
+            case 'n': {
+                ParseLiteralToken(json_file, i, "null", 4);
+                CheckValueEnd(json_file, i + 4);
+                PushToken(&tokens, JSONTokenType::NULL_, i, 4);
+                node_count += is_array ? 1 : 0;
+                break;
             }
-
-            JSONToken* token = Push(&tokens);
-            token->type  = JSONTokenType::NULL_;
-            token->index = parse_state.char_index;
-            token->size  = 4;
-
-            parse_state.char_index += token->size;
-
-            // Parsing ends on char after value; no need to increment parse_state.char_index.
-        }
-        else if (c == 't') {
-            // Every literal token will have its own node.
-            if (is_array) {
-                json->nodes.size += 1;
+            case 't': {
+                ParseLiteralToken(json_file, i, "true", 4);
+                CheckValueEnd(json_file, i + 4);
+                PushToken(&tokens, JSONTokenType::BOOLEAN, i, 4);
+                node_count += is_array ? 1 : 0;
+                break;
             }
-
-            JSONToken* token = Push(&tokens);
-            token->type  = JSONTokenType::BOOLEAN;
-            token->index = parse_state.char_index;
-            token->size  = 4;
-
-            parse_state.char_index += token->size;
-
-            // Parsing ends on char after value; no need to increment parse_state.char_index.
-        }
-        else if (c == 'f') {
-            // Every literal token will have its own node.
-            if (is_array) {
-                json->nodes.size += 1;
+            case 'f': {
+                ParseLiteralToken(json_file, i, "false", 5);
+                CheckValueEnd(json_file, i + 5);
+                PushToken(&tokens, JSONTokenType::BOOLEAN, i, 5);
+                node_count += is_array ? 1 : 0;
+                break;
             }
-
-            JSONToken* token = Push(&tokens);
-            token->type  = JSONTokenType::BOOLEAN;
-            token->index = parse_state.char_index;
-            token->size  = 5;
-
-            parse_state.char_index += token->size;
-
-            // Parsing ends on char after value; no need to increment parse_state.char_index.
-        }
-        else if (ASCII_NUMERIC[c] || c == '-') {
-            // Every numeric token will have its own node.
-            if (is_array) {
-                json->nodes.size += 1;
+            case '-':
+            case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9': {
+                JSONTokenType type = JSONTokenType::NONE;
+                uint32 end = ParseNumberToken(json_file, i, &type);
+                CheckValueEnd(json_file, end);
+                PushToken(&tokens, type, i, end - i);
+                node_count += is_array ? 1 : 0;
+                break;
             }
-
-            JSONToken* token = Push(&tokens);
-            token->type  = JSONTokenType::UINT32;
-            token->index = parse_state.char_index;
-            token->size  = 1; // First char is start of numeric value.
-
-            parse_state.char_index += 1;
-
-            // Parse char after negative sign.
-            if (c == '-') {
-                token->type = JSONTokenType::SINT32;
-                parse_state.char_index += 1;
-                token->size += 1;
+            case '[':
+            case '{': {
+                // Lists in arrays are nodes; lists in objects are counted by their key's colon.
+                node_count += is_array ? 1 : 0;
+                is_array = c == '[';
+                PushResizeNZ(&open_bracket_stack, tokens.count, open_bracket_stack.size);
+                max_depth = Max(max_depth, open_bracket_stack.count - 1);
+                PushToken(&tokens, JSON_TOKEN_TYPE_SYMBOL[c], i, 1);
+                break;
             }
-
-            // Parse rest of numeric value.
-            while (parse_state.char_index < json_file->count) {
-                char num_char = json_file->data[parse_state.char_index];
-                if (num_char == '.') {
-                    token->type = JSONTokenType::FLOAT32;
-                }
-                else if (num_char == 'e') {
-                    parse_state.char_index += 1;
-                    parse_state.column += 1;
-                    num_char = json_file->data[parse_state.char_index];
-                    if (num_char == '-' || num_char == '+') {
-                        parse_state.char_index += 1;
-                        parse_state.column += 1;
-                    }
-                    while (parse_state.char_index < json_file->count) {
-                        num_char = json_file->data[parse_state.char_index];
-                        if (!ASCII_NUMERIC[num_char]) {
-                            break;
-                        }
-                        parse_state.char_index += 1;
-                        parse_state.column += 1;
-                    }
-                    break;
-                }
-                else if (!ASCII_NUMERIC[num_char]) {
-                    break;
+            case ']':
+            case '}': {
+                if (open_bracket_stack.count == 1) {
+                    JSONFilePosition position = GetFilePosition(json_file, i);
+                    CTK_FATAL("found extraneous close bracket on line %u column %u: \'%c\'",
+                              position.line,
+                              position.column,
+                              c);
                 }
-                parse_state.char_index += 1;
-                token->size += 1;
-            }
-
-            // Parsing ends on char after value; no need to increment parse_state.char_index.
-        }
-        else if (JSON_SKIPPABLE[c]) {
-            // Skip
-            parse_state.char_index += 1;
-        }
-        else if (JSON_SYMBOL[c]) {
-            JSONToken* token = Push(&tokens);
-            token->type  = JSON_TOKEN_TYPE_SYMBOL[c];
-            token->index = parse_state.char_index;
-            token->size  = 1; // Symbols are always 1 character.
-
-            // Track if token is in array or object for calculating node count.
-            if (token->type == JSONTokenType::OPEN_SQUARE_BRACKET) {
-                if (is_array) {
-                    json->nodes.size += 1;
+                JSONToken* open_bracket = &tokens.data[open_bracket_stack.data[open_bracket_stack.count - 1]];
+                if (open_bracket->type != (c == ']' ? JSONTokenType::OPEN_SQUARE_BRACKET :
+                                                      JSONTokenType::OPEN_CURLY_BRACKET)) {
+                    JSONFilePosition position = GetFilePosition(json_file, i);
+                    CTK_FATAL("found mismatched close bracket on line %u column %u: \'%c\'",
+                              position.line,
+                              position.column,
+                              c);
                 }
-
-                Push(&is_array_stack, true);
-                is_array = true;
+                open_bracket->close_index = tokens.count;
+                PushToken(&tokens, JSON_TOKEN_TYPE_SYMBOL[c], i, 1);
+                open_bracket_stack.count -= 1;
+                is_array = open_bracket_stack.count > 1 &&
+                           tokens.data[open_bracket_stack.data[open_bracket_stack.count - 1]].type ==
+                           JSONTokenType::OPEN_SQUARE_BRACKET;
+                break;
             }
-            else if (token->type == JSONTokenType::OPEN_CURLY_BRACKET) {
-                if (is_array) {
-                    json->nodes.size += 1;
+            case ':': {
+                // All nodes within an object will have a colon to separate key & value.
+                PushToken(&tokens, JSONTokenType::COLON, i, 1);
+                if (!is_array) {
+                    node_count += 1;
+                    key_count  += 1;
                 }
-
-                Push(&is_array_stack, false);
-                is_array = false;
+                break;
             }
-            else if (token->type == JSONTokenType::CLOSE_SQUARE_BRACKET ||
-                     token->type == JSONTokenType::CLOSE_CURLY_BRACKET) {
-                is_array_stack.count -= 1;
-                is_array = is_array_stack.data[is_array_stack.count - 1];
+            case ',': {
+                PushToken(&tokens, JSONTokenType::COMMA, i, 1);
+                break;
             }
-            else if (!is_array && token->type == JSONTokenType::COLON) {
-                // All nodes within an object will have a colon to separate key & value.
-                json->nodes.size += 1;
-                json->max_keys += 1;
+            default: {
+                JSONFilePosition position = GetFilePosition(json_file, i);
+                CTK_FATAL("invalid character on line %u column %u: \'%c\'",
+                          position.line,
+                          position.column,
+                          c);
             }
-
-            // Parsing ends on last char of token; skip to next.
-            parse_state.char_index += 1;
         }
     }
-    TempStack_PopFrame(frame);
+    if (open_bracket_stack.count > 1) {
+        JSONFilePosition position = GetFilePosition(json_file, tokens.data[open_bracket_stack.data[1]].index);
+        DestroyArray(&open_bracket_stack);
+        DestroyArray(&structurals);
+        DestroyArray(&tokens);
+        CTK_FATAL("reached EOF without finding close bracket for list starting on line %u column %u",
+                  position.line,
+                  position.column);
+    }
+    DestroyArray(&open_bracket_stack);
+    DestroyArray(&structurals);
+
+    json->nodes.size         = node_count;
+    json->max_keys           = key_count;
+    json->max_depth          = max_depth;
+    json->string_buffer_size = string_buffer_size;
     return tokens;
 }
 
-void FindCloseBracket(JSONTokenType open_bracket_type, Array<JSONToken>* tokens, uint32* token_index) {
-    JSONTokenType close_bracket_type = (JSONTokenType)((uint32)open_bracket_type + 1);
-    uint32 nesting_level = 0;
-    while (*token_index <= tokens->count) {
-        JSONToken* token = &tokens->data[*token_index];
-        if (token->type == open_bracket_type) {
-            nesting_level += 1;
+// Reads the 4 hex digits of a \uXXXX escape sequence starting at string[index] as a UTF-16 code unit.
+uint32 ReadJSONCodeUnit(const char* string, uint32 size, uint32 index) {
+    if (index + 4 > size) {
+        CTK_FATAL("invalid \\u escape sequence: expected 4 hex digits");
+    }
+
+    uint32 unit = 0;
+    for (uint32 i = index; i < index + 4; i += 1) {
+        char c = string[i];
+        uint32 digit = 0;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
         }
-        else if (token->type == close_bracket_type) {
-            if (nesting_level == 0) {
-                *token_index += 1;
-                return;
-            }
-            nesting_level -= 1;
+        else if (c >= 'a' && c <= 'f') {
+            digit = c - 'a' + 10;
         }
-        *token_index += 1;
+        else if (c >= 'A' && c <= 'F') {
+            digit = c - 'A' + 10;
+        }
+        else {
+            CTK_FATAL("invalid \\u escape sequence: '%.*s' isn't 4 hex digits", 4, &string[index]);
+        }
+        unit = (unit << 4) | digit;
     }
+    return unit;
+}
+
+// Copies size chars of string to out, evaluating escape sequences to their char values; \uXXXX escape sequences are
+// written as UTF-8, with surrogate pairs combined. Unescaped strings are never longer than escaped ones, so out needs
+// space for at most size chars; returns size of unescaped string. string can't end with an unpaired backslash, which
+// tokenizers guarantee as it would escape the closing quotation mark.
+uint32 UnescapeJSONString(const char* string, uint32 size, char* out) {
+    uint32 out_size     = 0;
+    uint32 region_start = 0;
+    for (uint32 i = 0; i < size; i += 1) {
+        if (string[i] != '\\') {
+            continue;
+        }
 
-    CTK_FATAL("reached end of tokens without finding close bracket type %s for open bracket type %s",
-              TokenTypeName(close_bracket_type), TokenTypeName(open_bracket_type));
+        // Copy region before escape sequence, then the escaped char.
+        memcpy(&out[out_size], &string[region_start], i - region_start);
+        out_size += i - region_start;
+        i += 1;
+        char escaped_char = string[i];
+        switch (escaped_char) {
+            case 'n':  { out[out_size] = '\n'; break; }
+            case 'r':  { out[out_size] = '\r'; break; }
+            case 't':  { out[out_size] = '\t'; break; }
+            case 'b':  { out[out_size] = '\b'; break; }
+            case 'f':  { out[out_size] = '\f'; break; }
+            case '/':  { out[out_size] = '/';  break; }
+            case '\\': { out[out_size] = '\\'; break; }
+            case '\"': { out[out_size] = '\"'; break; }
+            case '\0': { out[out_size] = '\0'; break; }
+            case 'u': {
+                uint32 codepoint = ReadJSONCodeUnit(string, size, i + 1);
+                i += 4;
+                if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+                    // High surrogate must be followed by a \uXXXX escaped low surrogate.
+                    uint32 low_unit = i + 2 < size && string[i + 1] == '\\' && string[i + 2] == 'u'
+                                      ? ReadJSONCodeUnit(string, size, i + 3)
+                                      : 0;
+                    if (low_unit < 0xDC00 || low_unit > 0xDFFF) {
+                        CTK_FATAL("invalid \\u escape sequence: high surrogate %04X isn't followed by a low surrogate",
+                                  codepoint);
+                    }
+                    codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low_unit - 0xDC00);
+                    i += 6;
+                }
+                else if (IsSurrogate(codepoint)) {
+                    CTK_FATAL("invalid \\u escape sequence: low surrogate %04X isn't preceded by a high surrogate",
+                              codepoint);
+                }
+
+                // At most 4 bytes are written for the 6 or 12 escaped chars, keeping the unescaped string shorter.
+                out_size += EncodeUTF8(&out[out_size], codepoint) - 1;
+                break;
+            }
+            default: {
+                CTK_FATAL("invalid escape char: '%c' (%u)", escaped_char, escaped_char);
+            }
+        }
+        out_size += 1;
+        region_start = i + 1;
+    }
+    memcpy(&out[out_size], &string[region_start], size - region_start);
+    return out_size + size - region_start;
 }
 
 void ParseValue(JSON*               json,
@@ -634,7 +810,7 @@ void ParseValue(JSON*               json,
         list_state->node_index  = node_index;
 
         node->type = JSONNodeType::ARRAY;
-        FindCloseBracket(JSONTokenType::OPEN_SQUARE_BRACKET, tokens, token_index);
+        *token_index = value_token->close_index + 1;
     }
     else if (value_token->type == JSONTokenType::OPEN_CURLY_BRACKET) {
         // Store nodex index and token index for parsing container later.
@@ -643,7 +819,7 @@ void ParseValue(JSON*               json,
         list_state->node_index  = node_index;
 
         node->type = JSONNodeType::OBJECT;
-        FindCloseBracket(JSONTokenType::OPEN_CURLY_BRACKET, tokens, token_index);
+        *token_index = value_token->close_index + 1;
     }
     else if (value_token->type == JSONTokenType::UINT32) {
         node->type       = JSONNodeType::UINT32;
@@ -660,63 +836,27 @@ void ParseValue(JSON*               json,
 
     }
     else if (value_token->type == JSONTokenType::STRING) {
-        parse_state->value_offset -= value_token->size;
-
-        node->type         = JSONNodeType::STRING;
-        node->string.data  = &json->string_buffer[parse_state->value_offset];
-
-        // Copy token string data to string buffer, evaluating escape sequences to their char values.
+        node->type = JSONNodeType::STRING;
         String* node_string = &node->string;
-        uint32 token_string_start = value_token->index;
-        uint32 token_string_index = value_token->index;
-        uint32 token_string_size  = 0;
-        uint32 value_token_end    = value_token->index + value_token->size;
-        char token_char           = 0;
-        while (true) {
-            if (token_string_index >= value_token_end) {
-                memcpy(&node_string->data[node_string->size], &json_file->data[token_string_start], token_string_size);
-                node_string->size += token_string_size;
-                break; // Parsing reached end of string.
-            }
-
-            token_char = json_file->data[token_string_index];
-            if (token_char == '\\') {
-                memcpy(&node_string->data[node_string->size], &json_file->data[token_string_start], token_string_size);
-                node_string->size += token_string_size;
-                token_string_index += 1;
-                token_char = json_file->data[token_string_index];
-                if (token_char == 'n') {
-                    node_string->data[node_string->size] = '\n';
-                }
-                else if (token_char == 'r') {
-                    node_string->data[node_string->size] = '\r';
-                }
-                else if (token_char == 't') {
-                    node_string->data[node_string->size] = '\t';
-                }
-                else if (token_char == '\\') {
-                    node_string->data[node_string->size] = '\\';
-                }
-                else if (token_char == '\"') {
-                    node_string->data[node_string->size] = '\"';
-                }
-                else if (token_char == '\0') {
-                    node_string->data[node_string->size] = '\0';
-                }
-                else {
-                    CTK_FATAL("invalid escape char: '%c' (%u)", token_char, token_char);
-                }
+        const char* token_string = &json_file->data[value_token->index];
+        if (json->mapped_file.data != NULL && !value_token->has_escapes) {
+            // Mapped file outlives nodes, so point to string in it instead of copying. The mapping is read-only, so
+            // the string must not be written to.
+            node_string->data  = (char*)token_string;
+            node_string->size  = value_token->size;
+            node_string->count = value_token->size;
+            return;
+        }
 
-                // Beging new region.
-                node_string->size += 1;
-                token_string_index += 1;
-                token_string_start = token_string_index;
-                token_string_size  = 0;
-            }
-            else {
-                token_string_index += 1;
-                token_string_size += 1;
-            }
+        // Copy token string data to string buffer, evaluating escape sequences to their char values.
+        parse_state->value_offset -= value_token->size;
+        node_string->data = &json->string_buffer[parse_state->value_offset];
+        if (value_token->has_escapes) {
+            node_string->size = UnescapeJSONString(token_string, value_token->size, node_string->data);
+        }
+        else {
+            memcpy(node_string->data, token_string, value_token->size);
+            node_string->size = value_token->size;
         }
         node_string->count = node_string->size;
     }
@@ -810,23 +950,28 @@ uint32 ParseObjectChildren(JSON*               json,
             CTK_FATAL("expected token for colon to be COLON type: was %s", TokenTypeName(colon_token->type));
         }
 
-        // Initialize key and write key string to string buffer at key_offset.
+        // Initialize key and write key string to string buffer at key_offset. Keys aren't unescaped, so keys in a
+        // mapped file are used in place, offset from the start of the file.
         child_count += 1;
         uint32 child_node_index = json->nodes.count;
         JSONNode* child_node = Push(&json->nodes);
-        child_node->key.data  = &json->string_buffer[parse_state->key_offset];
+        uint32 key_offset = parse_state->key_offset;
+        if (json->mapped_file.data != NULL) {
+            key_offset = key_token->index;
+        }
+        else {
+            memcpy(&json->string_buffer[key_offset], &json_file->data[key_token->index], key_token->size);
+            parse_state->key_offset += key_token->size;
+        }
+        child_node->key.data  = (char*)&json->key_chars[key_offset];
         child_node->key.size  = key_token->size;
         child_node->key.count = key_token->size;
         child_node->key_index = parse_state->key_index;
-        memcpy(child_node->key.data, &json_file->data[key_token->index], key_token->size);
 
         // Store key size and index of key's node.
         json->key_sizes  [parse_state->key_index] = key_token->size;
-        json->key_offsets[parse_state->key_index] = parse_state->key_offset;
-
-        // Update key parse state.
-        parse_state->key_index  += 1;
-        parse_state->key_offset += key_token->size;
+        json->key_offsets[parse_state->key_index] = key_offset;
+        parse_state->key_index += 1;
 
         // Parse value for node.
         ParseValue(json, json_file, tokens, parse_state, &token_index, child_node, child_node_index);
@@ -834,11 +979,108 @@ uint32 ParseObjectChildren(JSON*               json,
     return child_count;
 }
 
-void ParseNodes(JSON* json, String* json_file, Array<JSONToken>* tokens) {
+bool KeyMatches(JSON* json, uint32 key_index, const char* key, uint32 key_size) {
+    return json->key_sizes[key_index] == key_size &&
+           StringsMatch(&json->key_chars[json->key_offsets[key_index]], key, key_size);
+}
+
+uint32 HashKey(const char* key, uint32 key_size) {
+    return (uint32)Hash(key, key_size);
+}
+
+// Keep load factor at or below 50% so probe sequences stay short.
+uint32 GetKeyTableSlotCount(uint32 key_count) {
+    uint32 slot_count = 2;
+    while (slot_count < key_count * 2) {
+        slot_count *= 2;
+    }
+    return slot_count;
+}
+
+// Keys are inserted in order, so the first of any duplicate keys is earlier in their probe sequence and is found first,
+// as with a linear search. key_tables is sized for the most tables json's keys could fill, so it never grows.
+void BuildKeyTable(JSON* json, JSONNodeParseState* parse_state, JSONNodeList* list) {
+    uint32 slot_count = GetKeyTableSlotCount(list->size);
+    uint32* slots = NULL;
+    if (parse_state->key_table_slots != NULL) {
+        if (slot_count > parse_state->key_table_slots_left) {
+            CTK_FATAL("can't build key table with %u slots: only %u slots left", slot_count,
+                      parse_state->key_table_slots_left);
+        }
+        slots = parse_state->key_table_slots;
+        parse_state->key_table_slots      += slot_count;
+        parse_state->key_table_slots_left -= slot_count;
+    }
+    else {
+        slots = Allocate<uint32>(json->allocator, slot_count);
+    }
+
+    JSONKeyTable key_table = {
+        .slots     = slots,
+        .slot_mask = slot_count - 1,
+    };
+    for (uint32 child_index = 0; child_index < list->size; child_index += 1) {
+        uint32 key_index = list->key_index + child_index;
+        uint32 hash = HashKey(&json->key_chars[json->key_offsets[key_index]], json->key_sizes[key_index]);
+        uint32 slot = hash & key_table.slot_mask;
+        while (key_table.slots[slot] != 0) {
+            slot = (slot + 1) & key_table.slot_mask;
+        }
+        key_table.slots[slot] = child_index + 1;
+    }
+
+    Push(&json->key_tables, key_table);
+    list->key_table_index = json->key_tables.count;
+}
+
+// Parses children of list node starting at token_index to the end of json's nodes.
+void ParseList(JSON*               json,
+               String*             json_file,
+               Array<JSONToken>*   tokens,
+               JSONNodeParseState* parse_state,
+               JSONNode*           node,
+               uint32              token_index) {
+    node->list.node_index = json->nodes.count;
+    if (node->type == JSONNodeType::OBJECT) {
+        node->list.key_index = parse_state->key_index;
+        node->list.size = ParseObjectChildren(json, json_file, tokens, parse_state, token_index);
+        if (node->list.size >= JSON_KEY_TABLE_MIN_KEYS) {
+            BuildKeyTable(json, parse_state, &node->list);
+        }
+    }
+    else if (node->type == JSONNodeType::ARRAY) {
+        node->list.size = ParseArrayChildren(json, json_file, tokens, parse_state, token_index);
+    }
+    else {
+        CTK_FATAL("expected container node to be ARRAY or OBJECT type: was %s",
+                  NodeTypeName(node->type));
+    }
+}
+
+// Parses lists queued by ParseValue(), including lists queued while parsing them, so lists are parsed breadth-first.
+void ParseQueuedLists(JSON* json, String* json_file, Array<JSONToken>* tokens, JSONNodeParseState* parse_state) {
+    for (uint32 i = 0; i < parse_state->list_states.count; i += 1) {
+        JSONListState* list_state = &parse_state->list_states.data[i];
+        ParseList(json, json_file, tokens, parse_state, &json->nodes.data[list_state->node_index],
+                  list_state->token_index);
+    }
+}
+
+// Allocates json's node and key buffers with the sizes counted by ParseTokens().
+void CreateNodeBuffers(JSON* json) {
     json->nodes         = CreateArray<JSONNode>(json->allocator, json->nodes.size);
-    json->string_buffer = Allocate<char>  (json->allocator, json->string_buffer_size);
+    json->string_buffer = json->string_buffer_size > 0
+                          ? Allocate<char>(json->allocator, json->string_buffer_size)
+                          : NULL;
+    json->key_chars     = json->mapped_file.data != NULL ? json->mapped_file.data : json->string_buffer;
     json->key_sizes     = Allocate<uint32>(json->allocator, json->max_keys);
     json->key_offsets   = Allocate<uint32>(json->allocator, json->max_keys);
+    json->key_tables    = CreateArray<JSONKeyTable>(json->allocator, json->max_keys / JSON_KEY_TABLE_MIN_KEYS);
+    json->id            = AtomicAdd(&g_json_load_count, 1) + 1;
+}
+
+void ParseNodes(JSON* json, String* json_file, Array<JSONToken>* tokens) {
+    CreateNodeBuffers(json);
 
     // Parse nodes from tokens.
     JSONNodeParseState parse_state = {
@@ -853,37 +1095,87 @@ void ParseNodes(JSON* json, String* json_file, Array<JSONToken>* tokens) {
     JSONNode* root_node = &json->root_node;
     if (first_token->type == JSONTokenType::OPEN_SQUARE_BRACKET) {
         root_node->type = JSONNodeType::ARRAY;
-        root_node->list.size = ParseArrayChildren(json, json_file, tokens, &parse_state, 1);
     }
     else if (first_token->type == JSONTokenType::OPEN_CURLY_BRACKET) {
         root_node->type = JSONNodeType::OBJECT;
-        root_node->list.size = ParseObjectChildren(json, json_file, tokens, &parse_state, 1);
     }
     else {
         CTK_FATAL("JSON file must start with { or [");
     }
+    ParseList(json, json_file, tokens, &parse_state, root_node, 1);
 
     // Parse all child lists of root.
-    for (uint32 i = 0; i < parse_state.list_states.count; i += 1) {
-        // Don't use pointers to container state or node as both arrays can be reallocated during ParseXChildren().
-        uint32 node_index  = parse_state.list_states.data[i].node_index;
-        uint32 token_index = parse_state.list_states.data[i].token_index;
-        JSONNode* node = &json->nodes.data[node_index];
-        node->list.node_index = json->nodes.count;
-        if (node->type == JSONNodeType::OBJECT) {
-            node->list.key_index = parse_state.key_index;
-            node->list.size = ParseObjectChildren(json, json_file, tokens, &parse_state, token_index);
+    ParseQueuedLists(json, json_file, tokens, &parse_state);
+
+    DestroyArray(&parse_state.list_states);
+}
+
+JSONNode* FindNodeInKeyTable(JSON* json, JSONNodeList* list, const char* key, uint32 key_size, uint32 key_hash) {
+    JSONKeyTable* key_table = &json->key_tables.data[list->key_table_index - 1];
+    for (uint32 slot = key_hash & key_table->slot_mask;; slot = (slot + 1) & key_table->slot_mask) {
+        uint32 slot_value = key_table->slots[slot];
+        if (slot_value == 0) {
+            return NULL;
         }
-        else if (node->type == JSONNodeType::ARRAY) {
-            node->list.size = ParseArrayChildren(json, json_file, tokens, &parse_state, token_index);
+
+        uint32 child_index = slot_value - 1;
+        if (KeyMatches(json, list->key_index + child_index, key, key_size)) {
+            return &json->nodes.data[list->node_index + child_index];
         }
-        else {
-            CTK_FATAL("expected container node to be ARRAY or OBJECT type: was %s",
-                      NodeTypeName(node->type));
+    }
+}
+
+JSONNode* FindNodeLinear(JSON* json, JSONNodeList* list, const char* key, uint32 key_size) {
+    for (uint32 child_index = 0; child_index < list->size; child_index += 1) {
+        if (KeyMatches(json, list->key_index + child_index, key, key_size)) {
+            return &json->nodes.data[list->node_index + child_index];
         }
     }
 
-    DestroyArray(&parse_state.list_states);
+    return NULL;
+}
+
+bool PathSegmentsMatch(JSONPath* path_a, JSONPathSegment* segment_a, JSONPath* path_b, JSONPathSegment* segment_b) {
+    if (segment_a->type != segment_b->type) {
+        return false;
+    }
+
+    if (segment_a->type == JSONPathSegmentType::INDEX) {
+        return segment_a->index == segment_b->index;
+    }
+
+    return segment_a->key_hash == segment_b->key_hash &&
+           StringsMatch(&path_a->keys[segment_a->key_offset], segment_a->key_size,
+                        &path_b->keys[segment_b->key_offset], segment_b->key_size);
+}
+
+JSONNode* GetPathSegmentNode(JSON* json, JSONNode* node, JSONPath* path, JSONPathSegment* segment) {
+    if (segment->type == JSONPathSegmentType::INDEX) {
+        if (node->type != JSONNodeType::ARRAY && node->type != JSONNodeType::OBJECT) {
+            CTK_FATAL("can't get child node [%u] of \"%.*s\": node is %s, not ARRAY or OBJECT",
+                      segment->index, node->key.size, node->key.data, NodeTypeName(node->type));
+        }
+        if (segment->index >= node->list.size) {
+            CTK_FATAL("can't get child node in \"%.*s\": index %u exceeds child count of %u",
+                      node->key.size, node->key.data, segment->index, node->list.size);
+        }
+        return &json->nodes.data[node->list.node_index + segment->index];
+    }
+
+    const char* key = &path->keys[segment->key_offset];
+    if (node->type != JSONNodeType::OBJECT) {
+        CTK_FATAL("can't get child node with key \"%.*s\" of \"%.*s\": node is %s, not OBJECT",
+                  segment->key_size, key, node->key.size, node->key.data, NodeTypeName(node->type));
+    }
+
+    JSONNode* child_node = node->list.key_table_index != 0
+                           ? FindNodeInKeyTable(json, &node->list, key, segment->key_size, segment->key_hash)
+                           : FindNodeLinear(json, &node->list, key, segment->key_size);
+    if (child_node == NULL) {
+        CTK_FATAL("can't get child node with key \"%.*s\" in object \"%.*s\"",
+                  segment->key_size, key, node->key.size, node->key.data);
+    }
+    return child_node;
 }
 
 /// Debug
@@ -1027,13 +1319,15 @@ void PrintKeys(JSON* json, JSONNode* node) {
         PrintLine("[%4u] %.*s (node_index:%4u)",
                   key_index,
                   key_size,
-                  &json->string_buffer[key_offset],
+                  &json->key_chars[key_offset],
                   list->node_index + child_index);
     }
 }
 
 /// Interface
 ////////////////////////////////////////////////////////////
+// Commas are optional: each item of a list and its close bracket may follow at most one comma, so missing, leading and
+// trailing commas are accepted and repeated commas aren't. LoadJSONDocument() and JSONReader read the same grammar.
 JSON LoadJSON(Allocator* allocator, const char* path) {
     CTK_ASSERT(allocator != NULL);
     CTK_ASSERT(allocator->Deallocate != NULL);
@@ -1050,6 +1344,7 @@ JSON LoadJSON(Allocator* allocator, const char* path) {
     Array<JSONToken> tokens = ParseTokens(&json, &json_file);
     if (tokens.count == 0) {
         DestroyString(&json_file);
+        DestroyArray(&tokens);
         return json;
     }
 // for (uint32 i = 0; i < tokens.count; i += 1)
@@ -1075,29 +1370,62 @@ JSON LoadJSON(Allocator* allocator, const char* path) {
     return json;
 }
 
+// Loads JSON from a read-only mapping of the file at path instead of a copy of it. Keys and strings without escape
+// sequences point into the mapping instead of being copied to string_buffer, so the file stays mapped until
+// DestroyJSON(). Those keys and strings are read-only: writing through node->key or node->string crashes.
+JSON LoadMappedJSON(Allocator* allocator, const char* path) {
+    CTK_ASSERT(allocator != NULL);
+    CTK_ASSERT(allocator->Deallocate != NULL);
+
+    JSON json = {};
+    json.allocator   = allocator;
+    json.mapped_file = MapFile(path);
+    if (json.mapped_file.size == 0) {
+        return json;
+    }
+
+    // Tokenizing only reads json_file, so the mapping can be used in place of a buffer.
+    String json_file = {
+        .allocator = NULL,
+        .data      = (char*)json.mapped_file.data,
+        .size      = json.mapped_file.size,
+        .count     = json.mapped_file.size,
+    };
+    Array<JSONToken> tokens = ParseTokens(&json, &json_file);
+    if (tokens.count > 0) {
+        ParseNodes(&json, &json_file, &tokens);
+    }
+    DestroyArray(&tokens);
+
+    return json;
+}
+
 void DestroyJSON(JSON* json) {
     DestroyArray(&json->nodes);
     if (json->string_buffer != NULL) { Deallocate(json->allocator, json->string_buffer); }
     if (json->key_sizes     != NULL) { Deallocate(json->allocator, json->key_sizes);     }
     if (json->key_offsets   != NULL) { Deallocate(json->allocator, json->key_offsets);   }
+    if (json->key_tables.allocator != NULL) {
+        for (uint32 i = 0; json->key_table_slots == NULL && i < json->key_tables.count; i += 1) {
+            Deallocate(json->allocator, json->key_tables.data[i].slots);
+        }
+        DestroyArray(&json->key_tables);
+    }
+    if (json->key_table_slots != NULL) { Deallocate(json->allocator, json->key_table_slots); }
+    UnmapFile(&json->mapped_file);
     *json = {};
 }
 
+// Searches small objects linearly and large objects through their key table. Doesn't modify json, so a loaded JSON can
+// be searched from several threads at once.
 JSONNode* FindNode(JSON* json, JSONNode* node, const char* key, uint32 key_size) {
     CTK_ASSERT(node->type == JSONNodeType::OBJECT);
 
     JSONNodeList* list = &node->list;
-    for (uint32 child_index = 0; child_index < list->size; child_index += 1) {
-        uint32 key_index = list->key_index + child_index;
-        if (json->key_sizes[key_index] == key_size) {
-            uint32 key_offset = json->key_offsets[key_index];
-            if (StringsMatch(&json->string_buffer[key_offset], key, key_size)) {
-                return &json->nodes.data[list->node_index + child_index];
-            }
-        }
+    if (list->key_table_index != 0) {
+        return FindNodeInKeyTable(json, list, key, key_size, HashKey(key, key_size));
     }
-
-    return NULL;
+    return FindNodeLinear(json, list, key, key_size);
 }
 
 JSONNode* FindNode(JSON* json, JSONNode* node, const char* key) {
@@ -1412,3 +1740,201 @@ bool SearchBoolean(JSON* json, JSONNode* node, const char* search) {
 bool SearchBoolean(JSON* json, const char* search) {
     return SearchBoolean(json, &json->root_node, search);
 }
+
+// Parses search (same syntax as SearchNode()) into a JSONPath. If cache_node is set, searches with the path return
+// the node found by the last search while searching the same JSON load from the same node.
+JSONPath CompileJSONPath(Allocator* allocator, const char* search, bool cache_node = false) {
+    uint32 search_size = StringSize(search);
+
+    // Every segment but the first takes at least 2 chars ("a.b", "[0]"), and keys are copied without separators.
+    JSONPath path = {};
+    path.allocator  = allocator;
+    path.segments   = Allocate<JSONPathSegment>(allocator, Min(search_size / 2 + 1, JSON_PATH_MAX_SEGMENTS));
+    path.keys       = Allocate<char>(allocator, search_size + 1);
+    path.cache_node = cache_node;
+
+    uint32 key_chars_size = 0;
+    uint32 i = 0;
+    while (i < search_size) {
+        // Both key parsing and subscript parsing can end on '.'.
+        if (search[i] == '.') {
+            i += 1;
+            continue;
+        }
+
+        if (path.segment_count == JSON_PATH_MAX_SEGMENTS) {
+            CTK_FATAL("can't compile JSON path \"%s\": exceeds max of %u segments", search, JSON_PATH_MAX_SEGMENTS);
+        }
+        JSONPathSegment* segment = &path.segments[path.segment_count];
+        path.segment_count += 1;
+
+        if (search[i] == '[') {
+            i += 1;
+            uint32 index_start = i;
+            while (true) {
+                if (i >= search_size) {
+                    CTK_FATAL("reached end of search term parsing subscript index");
+                }
+                if (search[i] == ']') {
+                    break;
+                }
+                if (!ASCII_NUMERIC[search[i]]) {
+                    CTK_FATAL("non-numeric character in subscript index at search term column %u", i);
+                }
+                i += 1;
+            }
+            if (i == index_start) {
+                CTK_FATAL("empty subscript at search term column %u", index_start - 1);
+            }
+            segment->type  = JSONPathSegmentType::INDEX;
+            segment->index = ToUInt32(&search[index_start], i - index_start);
+            i += 1; // Skip close square bracket.
+        }
+        else {
+            uint32 key_start = i;
+            while (i < search_size && search[i] != '.' && search[i] != '[') {
+                i += 1;
+            }
+            segment->type       = JSONPathSegmentType::KEY;
+            segment->key_offset = key_chars_size;
+            segment->key_size   = i - key_start;
+            segment->key_hash   = HashKey(&search[key_start], segment->key_size);
+            memcpy(&path.keys[key_chars_size], &search[key_start], segment->key_size);
+            key_chars_size += segment->key_size;
+        }
+    }
+
+    return path;
+}
+
+void DestroyJSONPath(JSONPath* path) {
+    Deallocate(path->allocator, path->segments);
+    Deallocate(path->allocator, path->keys);
+    *path = {};
+}
+
+// Doesn't allocate or modify json; large objects are searched through the key tables built when json was loaded. Only
+// paths that cache their node are written to, so those can't be shared between threads.
+JSONNode* SearchNode(JSON* json, JSONNode* node, JSONPath* path) {
+    if (path->cache_node && path->cached_json_id == json->id && path->cached_start_node == node) {
+        return path->cached_node;
+    }
+
+    JSONNode* start_node = node;
+    for (uint32 i = 0; i < path->segment_count; i += 1) {
+        node = GetPathSegmentNode(json, node, path, &path->segments[i]);
+    }
+
+    if (path->cache_node) {
+        path->cached_json_id    = json->id;
+        path->cached_start_node = start_node;
+        path->cached_node       = node;
+    }
+    return node;
+}
+
+JSONNode* SearchNode(JSON* json, JSONPath* path) {
+    return SearchNode(json, &json->root_node, path);
+}
+
+// Finds nodes for path_count paths from node, writing them to nodes. Segments a path shares with the start of the
+// previous path aren't searched again, so listing paths grouped by shared prefix searches each shared node once.
+void SearchNodes(JSON* json, JSONNode* node, JSONPath* paths, uint32 path_count, JSONNode** nodes) {
+    // prefix_nodes[i] is the node found by the previous path's first i segments.
+    JSONNode* prefix_nodes[JSON_PATH_MAX_SEGMENTS + 1] = {};
+    prefix_nodes[0] = node;
+    JSONPath* prev_path = NULL;
+    for (uint32 path_index = 0; path_index < path_count; path_index += 1) {
+        JSONPath* path = &paths[path_index];
+        uint32 shared_count = 0;
+        if (prev_path != NULL) {
+            uint32 max_shared_count = Min(path->segment_count, prev_path->segment_count);
+            while (shared_count < max_shared_count &&
+                   PathSegmentsMatch(path,      &path->segments[shared_count],
+                                     prev_path, &prev_path->segments[shared_count]))
+            {
+                shared_count += 1;
+            }
+        }
+
+        for (uint32 i = shared_count; i < path->segment_count; i += 1) {
+            prefix_nodes[i + 1] = GetPathSegmentNode(json, prefix_nodes[i], path, &path->segments[i]);
+        }
+        nodes[path_index] = prefix_nodes[path->segment_count];
+        prev_path = path;
+    }
+}
+
+void SearchNodes(JSON* json, JSONPath* paths, uint32 path_count, JSONNode** nodes) {
+    SearchNodes(json, &json->root_node, paths, path_count, nodes);
+}
+
+JSONNode* SearchObject(JSON* json, JSONNode* node, JSONPath* path) {
+    node = SearchNode(json, node, path);
+    CTK_ASSERT(node->type == JSONNodeType::OBJECT);
+    return node;
+}
+
+JSONNode* SearchObject(JSON* json, JSONPath* path) {
+    return SearchObject(json, &json->root_node, path);
+}
+
+JSONNode* SearchArray(JSON* json, JSONNode* node, JSONPath* path) {
+    node = SearchNode(json, node, path);
+    CTK_ASSERT(node->type == JSONNodeType::ARRAY);
+    return node;
+}
+
+JSONNode* SearchArray(JSON* json, JSONPath* path) {
+    return SearchArray(json, &json->root_node, path);
+}
+
+uint32 SearchUInt32(JSON* json, JSONNode* node, JSONPath* path) {
+    node = SearchNode(json, node, path);
+    CTK_ASSERT(node->type == JSONNodeType::UINT32);
+    return node->num_uint32;
+}
+
+uint32 SearchUInt32(JSON* json, JSONPath* path) {
+    return SearchUInt32(json, &json->root_node, path);
+}
+
+sint32 SearchSInt32(JSON* json, JSONNode* node, JSONPath* path) {
+    node = SearchNode(json, node, path);
+    CTK_ASSERT(node->type == JSONNodeType::SINT32);
+    return node->num_sint32;
+}
+
+sint32 SearchSInt32(JSON* json, JSONPath* path) {
+    return SearchSInt32(json, &json->root_node, path);
+}
+
+float32 SearchFloat32(JSON* json, JSONNode* node, JSONPath* path) {
+    node = SearchNode(json, node, path);
+    CTK_ASSERT(node->type == JSONNodeType::FLOAT32);
+    return node->num_float32;
+}
+
+float32 SearchFloat32(JSON* json, JSONPath* path) {
+    return SearchFloat32(json, &json->root_node, path);
+}
+
+String* SearchString(JSON* json, JSONNode* node, JSONPath* path) {
+    node = SearchNode(json, node, path);
+    CTK_ASSERT(node->type == JSONNodeType::STRING);
+    return &node->string;
+}
+
+String* SearchString(JSON* json, JSONPath* path) {
+    return SearchString(json, &json->root_node, path);
+}
+
+bool SearchBoolean(JSON* json, JSONNode* node, JSONPath* path) {
+    node = SearchNode(json, node, path);
+    CTK_ASSERT(node->type == JSONNodeType::BOOLEAN);
+    return node->boolean;
+}
+
+bool SearchBoolean(JSON* json, JSONPath* path) {
+    return SearchBoolean(json, &json->root_node, path);
+}
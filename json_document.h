@@ -0,0 +1,292 @@
+/// Macros
+////////////////////////////////////////////////////////////
+#define CTK_ITER_JSON(VAR, LIST_VALUE) \
+    for (auto VAR = IterateList(LIST_VALUE); \
+         IsValid(&VAR); \
+         Next(&VAR))
+
+/// Data
+////////////////////////////////////////////////////////////
+// On-demand alternative to JSON: only the file's tokens are kept, and values are parsed (and strings unescaped) when
+// they're read rather than all being converted to nodes up front. Open bracket tokens store the index of their close
+// bracket token, so lists that aren't read are skipped in a single step.
+struct JSONDocument {
+    Allocator*       allocator;
+    MappedFile       mapped_file;
+    String           file; // View of mapped_file's data that tokens index into.
+    Array<JSONToken> tokens;
+};
+
+// Cursor to a value in a document. Values are passed by value and are only valid until their document is destroyed.
+struct JSONValue {
+    JSONDocument* document;
+    uint32        token_index;
+};
+
+// Iterates the children of an array or object, visiting a child's own children only if it's iterated itself.
+struct JSONIterator {
+    JSONDocument* document;
+    uint32        next_token_index;
+    uint32        end_token_index; // Index of list's close bracket token.
+    bool          is_object;
+    bool          valid;
+    StringView    key;             // Key of value when iterating an object, with escape sequences left in.
+    JSONValue     value;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+JSONToken* GetToken(JSONValue value) {
+    return &value.document->tokens.data[value.token_index];
+}
+
+StringView GetTokenChars(JSONDocument* document, JSONToken* token) {
+    return ViewString(&document->file.data[token->index], token->size);
+}
+
+JSONNodeType GetValueTokenType(JSONDocument* document, JSONToken* token) {
+    switch (token->type) {
+        case JSONTokenType::OPEN_SQUARE_BRACKET: return JSONNodeType::ARRAY;
+        case JSONTokenType::OPEN_CURLY_BRACKET:  return JSONNodeType::OBJECT;
+        case JSONTokenType::UINT32:              return JSONNodeType::UINT32;
+        case JSONTokenType::SINT32:              return JSONNodeType::SINT32;
+        case JSONTokenType::FLOAT32:             return JSONNodeType::FLOAT32;
+        case JSONTokenType::STRING:              return JSONNodeType::STRING;
+        case JSONTokenType::BOOLEAN:             return JSONNodeType::BOOLEAN;
+        case JSONTokenType::NULL_:               return JSONNodeType::NULL_;
+        default: {
+            JSONFilePosition position = GetFilePosition(&document->file, token->index);
+            CTK_FATAL("invalid value token on line %u column %u: '%.*s'",
+                      position.line,
+                      position.column,
+                      token->size,
+                      &document->file.data[token->index]);
+        }
+    }
+}
+
+// Index of the token after the value at token_index.
+uint32 SkipValue(JSONDocument* document, uint32 token_index) {
+    JSONToken* token = &document->tokens.data[token_index];
+    return token->type == JSONTokenType::OPEN_SQUARE_BRACKET || token->type == JSONTokenType::OPEN_CURLY_BRACKET
+           ? token->close_index + 1
+           : token_index + 1;
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+// Tokenizes a read-only mapping of the file at path without parsing any values. Keys and strings are read from the
+// mapping, so it stays mapped until DestroyJSONDocument().
+JSONDocument LoadJSONDocument(Allocator* allocator, const char* path) {
+    CTK_ASSERT(allocator != NULL);
+    CTK_ASSERT(allocator->Deallocate != NULL);
+
+    JSONDocument document = {};
+    document.allocator   = allocator;
+    document.mapped_file = MapFile(path);
+    document.file = {
+        .allocator = NULL,
+        .data      = (char*)document.mapped_file.data,
+        .size      = document.mapped_file.size,
+        .count     = document.mapped_file.size,
+    };
+    if (document.mapped_file.size == 0) {
+        document.tokens = CreateArray<JSONToken>(allocator);
+        return document;
+    }
+
+    // ParseTokens() also counts what ParseNodes() needs to size its buffers, which a document doesn't use, so counts
+    // are written to a scratch JSON.
+    JSON counts = {};
+    counts.allocator = allocator;
+    document.tokens = ParseTokens(&counts, &document.file);
+    if (document.tokens.count > 0 &&
+        document.tokens.data[0].type != JSONTokenType::OPEN_SQUARE_BRACKET &&
+        document.tokens.data[0].type != JSONTokenType::OPEN_CURLY_BRACKET) {
+        DestroyArray(&document.tokens);
+        UnmapFile(&document.mapped_file);
+        CTK_FATAL("JSON file must start with { or [");
+    }
+
+    return document;
+}
+
+void DestroyJSONDocument(JSONDocument* document) {
+    DestroyArray(&document->tokens);
+    UnmapFile(&document->mapped_file);
+    *document = {};
+}
+
+JSONValue GetRoot(JSONDocument* document) {
+    return { .document = document, .token_index = 0 };
+}
+
+// An empty document's root is an empty array, matching the root node of JSON loaded from an empty file.
+JSONNodeType GetType(JSONValue value) {
+    if (value.document->tokens.count == 0) {
+        return JSONNodeType::ARRAY;
+    }
+    return GetValueTokenType(value.document, GetToken(value));
+}
+
+bool IsValid(JSONIterator* iterator) {
+    return iterator->valid;
+}
+
+// Commas are optional, with the same grammar as LoadJSON().
+void Next(JSONIterator* iterator) {
+    JSONDocument* document = iterator->document;
+    JSONToken*    tokens   = document->tokens.data;
+    uint32        index    = iterator->next_token_index;
+    uint32        end      = iterator->end_token_index;
+    if (index < end && tokens[index].type == JSONTokenType::COMMA) {
+        // Skip comma after previous value.
+        index += 1;
+    }
+    if (index >= end) {
+        iterator->next_token_index = end;
+        iterator->valid = false;
+        iterator->key   = {};
+        iterator->value = {};
+        return;
+    }
+
+    if (iterator->is_object) {
+        JSONToken* key_token = &tokens[index];
+        if (key_token->type != JSONTokenType::STRING) {
+            CTK_FATAL("expected token for key to be STRING type: was %s", TokenTypeName(key_token->type));
+        }
+        if (index + 2 >= end || tokens[index + 1].type != JSONTokenType::COLON) {
+            CTK_FATAL("expected COLON token and value after key \"%.*s\"",
+                      key_token->size,
+                      &document->file.data[key_token->index]);
+        }
+        iterator->key = GetTokenChars(document, key_token);
+        index += 2;
+    }
+
+    // Validate value token so values read through the iterator are known to be values.
+    GetValueTokenType(document, &tokens[index]);
+    iterator->value = { .document = document, .token_index = index };
+    iterator->next_token_index = SkipValue(document, index);
+    iterator->valid = true;
+}
+
+JSONIterator IterateList(JSONValue list) {
+    JSONNodeType type = GetType(list);
+    if (type != JSONNodeType::ARRAY && type != JSONNodeType::OBJECT) {
+        CTK_FATAL("can't iterate %s value: must be ARRAY or OBJECT", NodeTypeName(type));
+    }
+
+    JSONIterator iterator = {};
+    iterator.document = list.document;
+    if (list.document->tokens.count == 0) {
+        return iterator;
+    }
+
+    iterator.next_token_index = list.token_index + 1;
+    iterator.end_token_index  = GetToken(list)->close_index;
+    iterator.is_object        = type == JSONNodeType::OBJECT;
+    Next(&iterator);
+    return iterator;
+}
+
+// Number of children in list; each call iterates list, so the result should be kept if it's needed more than once.
+uint32 GetSize(JSONValue list) {
+    uint32 size = 0;
+    CTK_ITER_JSON(iterator, list) {
+        size += 1;
+    }
+    return size;
+}
+
+// Finds the first value in object with key, which is compared to keys with their escape sequences left in.
+bool FindValue(JSONValue object, const char* key, uint32 key_size, JSONValue* value) {
+    JSONNodeType type = GetType(object);
+    if (type != JSONNodeType::OBJECT) {
+        CTK_FATAL("can't find value with key \"%.*s\" in %s value: must be OBJECT", key_size, key, NodeTypeName(type));
+    }
+
+    CTK_ITER_JSON(iterator, object) {
+        if (StringsMatch(iterator.key, key, key_size)) {
+            *value = iterator.value;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FindValue(JSONValue object, const char* key, JSONValue* value) {
+    return FindValue(object, key, StringSize(key), value);
+}
+
+JSONValue GetValue(JSONValue object, const char* key, uint32 key_size) {
+    JSONValue value = {};
+    if (!FindValue(object, key, key_size, &value)) {
+        CTK_FATAL("can't get value with key \"%.*s\": object has no value with that key", key_size, key);
+    }
+    return value;
+}
+
+JSONValue GetValue(JSONValue object, const char* key) {
+    return GetValue(object, key, StringSize(key));
+}
+
+JSONValue GetValue(JSONValue list, uint32 index) {
+    uint32 child_index = 0;
+    CTK_ITER_JSON(iterator, list) {
+        if (child_index == index) {
+            return iterator.value;
+        }
+        child_index += 1;
+    }
+    CTK_FATAL("can't get value: index %u exceeds child count of %u", index, child_index);
+}
+
+uint32 GetUInt32(JSONValue value) {
+    CTK_ASSERT(GetType(value) == JSONNodeType::UINT32);
+    JSONToken* token = GetToken(value);
+    return ToUInt32(&value.document->file.data[token->index], token->size);
+}
+
+sint32 GetSInt32(JSONValue value) {
+    CTK_ASSERT(GetType(value) == JSONNodeType::SINT32);
+    JSONToken* token = GetToken(value);
+    return ToSInt32(&value.document->file.data[token->index], token->size);
+}
+
+float32 GetFloat32(JSONValue value) {
+    CTK_ASSERT(GetType(value) == JSONNodeType::FLOAT32);
+    JSONToken* token = GetToken(value);
+    return ToFloat32(&value.document->file.data[token->index], token->size);
+}
+
+bool GetBoolean(JSONValue value) {
+    CTK_ASSERT(GetType(value) == JSONNodeType::BOOLEAN);
+    JSONToken* token = GetToken(value);
+    return ToBool(&value.document->file.data[token->index], token->size);
+}
+
+bool IsNull(JSONValue value) {
+    return GetType(value) == JSONNodeType::NULL_;
+}
+
+// String value's chars with escape sequences left in. Points into the mapped file, so nothing is copied.
+StringView GetRawString(JSONValue value) {
+    CTK_ASSERT(GetType(value) == JSONNodeType::STRING);
+    return GetTokenChars(value.document, GetToken(value));
+}
+
+// Copy of string value with escape sequences evaluated to their char values.
+String GetString(Allocator* allocator, JSONValue value) {
+    StringView raw_string = GetRawString(value);
+    String string = CreateString(allocator, raw_string.size);
+    if (GetToken(value)->has_escapes) {
+        string.count = UnescapeJSONString(raw_string.data, raw_string.size, string.data);
+    }
+    else {
+        memcpy(string.data, raw_string.data, raw_string.size);
+        string.count = raw_string.size;
+    }
+    return string;
+}
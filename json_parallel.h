@@ -0,0 +1,321 @@
+/// Data
+////////////////////////////////////////////////////////////
+// A range of the root array's elements, parsed on a thread pool thread. Each batch first counts the nodes, keys, lists,
+// key table slots and string chars in its range, then is given its own region of the JSON's nodes, keys, key tables,
+// key table slots and string buffer to parse into, so batches never share memory or the JSON's allocator and need no
+// copying or index fixups once they're done.
+struct JSONParseBatch {
+    JSON*             json;
+    String*           json_file;
+    Array<JSONToken>* tokens;
+    uint32*           element_token_indexes;
+    BatchRange        elements;
+    TaskHnd           task;
+    bool              failed;
+
+    // Counted by CountJSONBatch(). node_count doesn't include the elements themselves, which are the root's children.
+    uint32 node_count;
+    uint32 key_count;
+    uint32 list_count;
+    uint32 key_table_slot_count;
+    uint32 string_buffer_size;
+
+    // Start of batch's regions, set once all batches are counted.
+    uint32               node_base;
+    uint32               key_base;
+    uint32               string_base;
+    uint32               key_table_base;
+    uint32               key_table_slot_base;
+    Array<JSONListState> list_states;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+// Counts the root array's elements, skipping nested lists via their close bracket index, and writes each one's token
+// index to element_token_indexes if it isn't NULL. Called once to count and again to fill an array of that size, so the
+// array never needs to grow.
+uint32 FindRootElements(String* json_file, Array<JSONToken>* tokens, uint32* element_token_indexes) {
+    uint32 element_count = 0;
+    uint32 end = tokens->data[0].close_index;
+    uint32 token_index = 1;
+    while (true) {
+        if (tokens->data[token_index].type == JSONTokenType::COMMA) {
+            // Skip comma after value.
+            token_index += 1;
+        }
+        if (token_index >= end) {
+            break;
+        }
+
+        JSONToken* token = &tokens->data[token_index];
+        if (token->type == JSONTokenType::COLON || token->type == JSONTokenType::COMMA) {
+            CTK_FATAL("invalid value token: '%.*s'", token->size, &json_file->data[token->index]);
+        }
+        if (element_token_indexes != NULL) {
+            element_token_indexes[element_count] = token_index;
+        }
+        element_count += 1;
+        token_index = token->type == JSONTokenType::OPEN_SQUARE_BRACKET ||
+                      token->type == JSONTokenType::OPEN_CURLY_BRACKET
+                      ? token->close_index + 1
+                      : token_index + 1;
+    }
+    return element_count;
+}
+
+// Counts the keys of the object whose open bracket is at open_index, skipping nested lists via their close bracket
+// index.
+uint32 CountObjectKeys(JSONToken* tokens, uint32 open_index) {
+    uint32 key_count = 0;
+    for (uint32 i = open_index + 1; i < tokens[open_index].close_index; i += 1) {
+        if (tokens[i].type == JSONTokenType::COLON) {
+            key_count += 1;
+        }
+        else if (tokens[i].type == JSONTokenType::OPEN_SQUARE_BRACKET ||
+                 tokens[i].type == JSONTokenType::OPEN_CURLY_BRACKET) {
+            i = tokens[i].close_index;
+        }
+    }
+    return key_count;
+}
+
+// Fatal errors can't be thrown across threads, so batch tasks catch them and flag their batch as failed instead. The
+// error itself has already been printed by CTK_FATAL().
+void CountJSONBatch(void* data) {
+    auto batch = (JSONParseBatch*)data;
+    try {
+        JSONToken* tokens = batch->tokens->data;
+        uint32 first = batch->element_token_indexes[batch->elements.start];
+        uint32 last  = batch->element_token_indexes[batch->elements.start + batch->elements.size - 1];
+        uint32 end   = tokens[last].type == JSONTokenType::OPEN_SQUARE_BRACKET ||
+                       tokens[last].type == JSONTokenType::OPEN_CURLY_BRACKET
+                       ? tokens[last].close_index + 1
+                       : last + 1;
+
+        uint32 value_count = 0;
+        for (uint32 i = first; i < end; i += 1) {
+            JSONToken* token = &tokens[i];
+            switch (token->type) {
+                case JSONTokenType::OPEN_SQUARE_BRACKET: {
+                    batch->list_count += 1;
+                    value_count += 1;
+                    break;
+                }
+                case JSONTokenType::OPEN_CURLY_BRACKET: {
+                    batch->list_count += 1;
+                    value_count += 1;
+
+                    // Each key takes at least a key, colon and value token, so only objects spanning enough tokens can
+                    // get a key table and need their keys counted.
+                    if (token->close_index - i > JSON_KEY_TABLE_MIN_KEYS * 3) {
+                        uint32 key_count = CountObjectKeys(tokens, i);
+                        if (key_count >= JSON_KEY_TABLE_MIN_KEYS) {
+                            batch->key_table_slot_count += GetKeyTableSlotCount(key_count);
+                        }
+                    }
+                    break;
+                }
+                case JSONTokenType::STRING: {
+                    batch->string_buffer_size += token->size;
+                    value_count += 1;
+                    break;
+                }
+                case JSONTokenType::COLON: {
+                    batch->key_count += 1;
+                    break;
+                }
+                case JSONTokenType::CLOSE_SQUARE_BRACKET:
+                case JSONTokenType::CLOSE_CURLY_BRACKET:
+                case JSONTokenType::COMMA: {
+                    break;
+                }
+                default: {
+                    value_count += 1;
+                    break;
+                }
+            }
+        }
+
+        // Every key is a string followed by a colon, and every value other than a key is a node.
+        if (value_count < batch->key_count + batch->elements.size) {
+            CTK_FATAL("found colons outside of objects in root array elements %u to %u", batch->elements.start,
+                      batch->elements.start + batch->elements.size - 1);
+        }
+        batch->node_count = value_count - batch->key_count - batch->elements.size;
+    }
+    catch (sint32 _) {
+        batch->failed = true;
+    }
+}
+
+void ParseJSONBatch(void* data) {
+    auto batch = (JSONParseBatch*)data;
+    try {
+        // Parse into a copy of json limited to batch's regions. Indexes and offsets start at the regions' starts, so
+        // the nodes, keys, key tables and strings parsed are already where they belong in json. Each large object
+        // has at least JSON_KEY_TABLE_MIN_KEYS keys, which bounds how many key tables batch can build.
+        JSON view = *batch->json;
+        view.nodes.count      = batch->node_base;
+        view.nodes.size       = batch->node_base + batch->node_count;
+        view.max_keys         = batch->key_base + batch->key_count;
+        view.key_tables.count = batch->key_table_base;
+        view.key_tables.size  = batch->key_table_base + batch->key_count / JSON_KEY_TABLE_MIN_KEYS;
+        JSONNodeParseState parse_state = {
+            .list_states          = batch->list_states,
+            .key_index            = batch->key_base,
+            .key_offset           = batch->string_base,
+            .value_offset         = batch->string_base + batch->string_buffer_size,
+            .key_table_slots      = &view.key_table_slots[batch->key_table_slot_base],
+            .key_table_slots_left = batch->key_table_slot_count,
+        };
+
+        // Elements are the root's children, so they're parsed into the start of nodes; their lists are parsed into
+        // batch's region.
+        for (uint32 i = batch->elements.start; i < batch->elements.start + batch->elements.size; i += 1) {
+            uint32 token_index = batch->element_token_indexes[i];
+            ParseValue(&view, batch->json_file, batch->tokens, &parse_state, &token_index, &view.nodes.data[i], i);
+        }
+        ParseQueuedLists(&view, batch->json_file, batch->tokens, &parse_state);
+        if (view.nodes.count != view.nodes.size) {
+            CTK_FATAL("parsed %u nodes in root array elements %u to %u: expected %u",
+                      view.nodes.count - batch->node_base,
+                      batch->elements.start,
+                      batch->elements.start + batch->elements.size - 1,
+                      batch->node_count);
+        }
+    }
+    catch (sint32 _) {
+        batch->failed = true;
+    }
+}
+
+// Runs func for each batch on thread_pool and waits for all of them. Returns false if any batch failed.
+bool RunJSONBatches(ThreadPool* thread_pool, Array<JSONParseBatch>* batches, Func<void, void*> func) {
+    for (uint32 i = 0; i < batches->count; i += 1) {
+        JSONParseBatch* batch = &batches->data[i];
+        batch->task = SubmitTask(thread_pool, batch, func);
+    }
+    bool failed = false;
+    for (uint32 i = 0; i < batches->count; i += 1) {
+        Wait(thread_pool, batches->data[i].task);
+        failed |= batches->data[i].failed;
+    }
+    return !failed;
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+// Same as LoadJSON(), but if the root is an array its elements are split into a batch per thread of thread_pool and
+// parsed in parallel. Tokenizing is still done on the calling thread, and single-thread pools just use ParseNodes().
+// Nodes are ordered breadth-first within each batch rather than across the whole file, which only affects iterating
+// json.nodes directly, not lookups.
+JSON LoadJSONParallel(Allocator* allocator, const char* path, ThreadPool* thread_pool) {
+    CTK_ASSERT(allocator != NULL);
+    CTK_ASSERT(allocator->Deallocate != NULL);
+    CTK_ASSERT(thread_pool != NULL && thread_pool->thread_count > 0);
+
+    JSON json = {};
+    json.allocator = allocator;
+
+    String json_file = ReadFile<char>(json.allocator, path);
+    if (json_file.count == 0) {
+        return json;
+    }
+
+    Array<JSONToken> tokens = ParseTokens(&json, &json_file);
+    if (tokens.count == 0) {
+        DestroyString(&json_file);
+        DestroyArray(&tokens);
+        return json;
+    }
+    if (tokens.data[0].type != JSONTokenType::OPEN_SQUARE_BRACKET) {
+        // Only arrays are split; objects' keys have to be parsed in order.
+        ParseNodes(&json, &json_file, &tokens);
+        DestroyString(&json_file);
+        DestroyArray(&tokens);
+        return json;
+    }
+
+    // A single batch would only add the count pass to ParseNodes(), so there's nothing to split.
+    uint32 element_count = FindRootElements(&json_file, &tokens, NULL);
+    if (element_count < 2 || thread_pool->thread_count == 1) {
+        ParseNodes(&json, &json_file, &tokens);
+        DestroyString(&json_file);
+        DestroyArray(&tokens);
+        return json;
+    }
+    auto element_token_indexes = CreateArrayFull<uint32>(allocator, element_count);
+    FindRootElements(&json_file, &tokens, element_token_indexes.data);
+
+    // Split elements into batches and count what each needs.
+    uint32 batch_count = Min(thread_pool->thread_count, element_token_indexes.count);
+    auto batch_ranges = CreateArrayFull<BatchRange>(allocator, batch_count);
+    GetBatchRanges(&batch_ranges, element_token_indexes.count);
+    auto batches = CreateArrayFull<JSONParseBatch>(allocator, batch_count);
+    for (uint32 i = 0; i < batch_count; i += 1) {
+        JSONParseBatch* batch = &batches.data[i];
+        batch->json                  = &json;
+        batch->json_file             = &json_file;
+        batch->tokens                = &tokens;
+        batch->element_token_indexes = element_token_indexes.data;
+        batch->elements              = batch_ranges.data[i];
+    }
+    bool counted = RunJSONBatches(thread_pool, &batches, CountJSONBatch);
+
+    // Give each batch its regions, with nodes starting after the root's children.
+    uint32 node_count           = element_token_indexes.count;
+    uint32 key_count            = 0;
+    uint32 string_buffer_size   = 0;
+    uint32 key_table_count      = 0;
+    uint32 key_table_slot_count = 0;
+    for (uint32 i = 0; counted && i < batch_count; i += 1) {
+        JSONParseBatch* batch = &batches.data[i];
+        batch->node_base           = node_count;
+        batch->key_base            = key_count;
+        batch->string_base         = string_buffer_size;
+        batch->key_table_base      = key_table_count;
+        batch->key_table_slot_base = key_table_slot_count;
+        batch->list_states         = CreateArray<JSONListState>(allocator, batch->list_count);
+        node_count           += batch->node_count;
+        key_count            += batch->key_count;
+        string_buffer_size   += batch->string_buffer_size;
+        key_table_count      += batch->key_count / JSON_KEY_TABLE_MIN_KEYS;
+        key_table_slot_count += batch->key_table_slot_count;
+    }
+
+    bool parsed = false;
+    if (counted) {
+        json.nodes.size         = node_count;
+        json.max_keys           = key_count;
+        json.string_buffer_size = string_buffer_size;
+        CreateNodeBuffers(&json);
+
+        // Allocators aren't thread-safe, so key table slots are allocated here for all batches rather than by each one.
+        json.key_table_slots = key_table_slot_count > 0 ? Allocate<uint32>(allocator, key_table_slot_count) : NULL;
+        json.root_node.type      = JSONNodeType::ARRAY;
+        json.root_node.list.size = element_token_indexes.count;
+        parsed = RunJSONBatches(thread_pool, &batches, ParseJSONBatch);
+        json.nodes.count      = node_count;
+        json.key_tables.count = key_table_count;
+    }
+
+    // Cleanup
+    for (uint32 i = 0; i < batch_count; i += 1) {
+        if (batches.data[i].list_states.allocator != NULL) {
+            DestroyArray(&batches.data[i].list_states);
+        }
+    }
+    DestroyArray(&batches);
+    DestroyArray(&batch_ranges);
+    DestroyArray(&element_token_indexes);
+    DestroyString(&json_file);
+    DestroyArray(&tokens);
+    if (!parsed) {
+        if (counted) {
+            DestroyJSON(&json);
+        }
+        CTK_FATAL("can't load JSON file \"%s\": failed to parse root array elements", path);
+    }
+
+    return json;
+}
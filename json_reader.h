@@ -0,0 +1,434 @@
+/// Data
+////////////////////////////////////////////////////////////
+// Reads up to size bytes of input into buffer, returning the number of bytes read; 0 means input has ended.
+using JSONReadFunc = Func<uint32, void*, char*, uint32>;
+
+enum struct JSONEventType {
+    BEGIN_OBJECT,
+    END_OBJECT,
+    BEGIN_ARRAY,
+    END_ARRAY,
+    KEY,
+    UINT32,
+    SINT32,
+    FLOAT32,
+    STRING,
+    BOOLEAN,
+    NULL_,
+};
+
+struct JSONEvent {
+    JSONEventType type;
+    uint32        depth; // Number of arrays and objects containing event's token.
+
+    // Key or string contents with escape sequences left in (see UnescapeJSONString()), or chars of number or literal.
+    // Points into reader's buffer, so it's only valid until the next call to NextEvent().
+    StringView text;
+    union {
+        uint32  num_uint32;
+        sint32  num_sint32;
+        float32 num_float32;
+        bool    boolean;
+    };
+};
+
+enum struct JSONReaderExpect {
+    ROOT,
+    KEY_OR_CLOSE,
+    COLON,
+    VALUE,
+    VALUE_OR_CLOSE,
+    COMMA_ITEM_OR_CLOSE,
+    END,
+};
+
+// Reads JSON one buffer of input at a time, so memory use is fixed by buffer_size and max_depth regardless of input
+// size. Unread chars of a token split across reads are moved to the front of buffer and the token is completed by the
+// next read, so a single token can't be larger than buffer_size.
+struct JSONReader {
+    Allocator*       allocator;
+    JSONReadFunc     read;
+    void*            read_data;
+    HANDLE           file;          // Only set for readers created by CreateJSONFileReader().
+    char*            buffer;
+    uint32           buffer_size;
+    uint32           index;         // Index of next unread char in buffer.
+    uint32           count;         // Number of chars read into buffer.
+    uint64           buffer_offset; // Offset of buffer's first char in input, for error messages.
+    bool             input_ended;
+    bool*            is_array_stack;
+    uint32           max_depth;
+    uint32           depth;
+    JSONReaderExpect expect;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+const char* JSONEventTypeName(JSONEventType type) {
+    constexpr const char* EVENT_TYPE_NAMES[] = {
+        "BEGIN_OBJECT",
+        "END_OBJECT",
+        "BEGIN_ARRAY",
+        "END_ARRAY",
+        "KEY",
+        "UINT32",
+        "SINT32",
+        "FLOAT32",
+        "STRING",
+        "BOOLEAN",
+        "NULL",
+    };
+    CTK_ASSERT((uint32)type < CTK_ARRAY_SIZE(EVENT_TYPE_NAMES));
+    return EVENT_TYPE_NAMES[(uint32)type];
+}
+
+uint32 ReadJSONFile(void* file, char* buffer, uint32 size) {
+    DWORD bytes_read = 0;
+    if (!::ReadFile((HANDLE)file, buffer, size, &bytes_read, NULL)) {
+        Win32Error e = {};
+        GetWin32Error(&e);
+        CTK_FATAL("ReadFile() failed while reading JSON: %.*s", e.message_length, e.message);
+    }
+    return bytes_read;
+}
+
+uint64 GetInputOffset(JSONReader* reader) {
+    return reader->buffer_offset + reader->index;
+}
+
+// Moves unread chars to the front of buffer and reads input into the space after them. Returns false if input has
+// ended.
+bool ReadMoreInput(JSONReader* reader) {
+    if (reader->input_ended) {
+        return false;
+    }
+
+    uint32 unread_count = reader->count - reader->index;
+    if (unread_count == reader->buffer_size) {
+        CTK_FATAL("can't read JSON token at byte %llu: token is larger than reader's %u byte buffer",
+                  GetInputOffset(reader), reader->buffer_size);
+    }
+    memmove(reader->buffer, &reader->buffer[reader->index], unread_count);
+    reader->buffer_offset += reader->index;
+    reader->index = 0;
+    reader->count = unread_count;
+
+    uint32 bytes_read = reader->read(reader->read_data, &reader->buffer[unread_count],
+                                     reader->buffer_size - unread_count);
+    reader->count += bytes_read;
+    reader->input_ended = bytes_read == 0;
+    return !reader->input_ended;
+}
+
+// Returns false if input ended before a non-whitespace char was found.
+bool SkipWhitespace(JSONReader* reader) {
+    while (true) {
+        for (; reader->index < reader->count; reader->index += 1) {
+            char c = reader->buffer[reader->index];
+            if (c != ' ' && c != '\t' && c != '\n' && c != '\r' && c != '\0') {
+                return true;
+            }
+        }
+        if (!ReadMoreInput(reader)) {
+            return false;
+        }
+    }
+}
+
+// Next unread char is a string's opening quotation mark. Returns string's contents without quotation marks.
+StringView ReadStringToken(JSONReader* reader) {
+    // Token size is tracked rather than an index into buffer, as reading more input moves the token.
+    uint32 size = 1;
+    while (true) {
+        while (reader->index + size < reader->count) {
+            char c = reader->buffer[reader->index + size];
+            if (c == '\"') {
+                StringView string = { .data = &reader->buffer[reader->index + 1], .size = size - 1 };
+                reader->index += size + 1;
+                return string;
+            }
+
+            // Skip escaped char, so escaped quotation marks don't end the string.
+            size += c == '\\' ? 2 : 1;
+        }
+        if (!ReadMoreInput(reader)) {
+            CTK_FATAL("reached end of input while reading string starting at byte %llu", GetInputOffset(reader));
+        }
+    }
+}
+
+// Returns chars of number or literal starting at next unread char.
+StringView ReadValueToken(JSONReader* reader) {
+    uint32 size = 0;
+    while (true) {
+        for (; reader->index + size < reader->count; size += 1) {
+            if (IsJSONDelimiter(reader->buffer[reader->index + size])) {
+                StringView value = { .data = &reader->buffer[reader->index], .size = size };
+                reader->index += size;
+                return value;
+            }
+        }
+        if (!ReadMoreInput(reader)) {
+            // End of input ends the token.
+            StringView value = { .data = &reader->buffer[reader->index], .size = size };
+            reader->index += size;
+            return value;
+        }
+    }
+}
+
+// Returns type of number in text, or NONE if text isn't a valid number.
+JSONTokenType GetNumberTokenType(StringView text) {
+    JSONTokenType type = JSONTokenType::UINT32;
+    uint32 i = 0;
+    if (i < text.size && text.data[i] == '-') {
+        type = JSONTokenType::SINT32;
+        i += 1;
+    }
+
+    uint32 digits_start = i;
+    while (i < text.size && IsDigit(text.data[i])) {
+        i += 1;
+    }
+    if (i == digits_start) {
+        return JSONTokenType::NONE;
+    }
+
+    if (i < text.size && text.data[i] == '.') {
+        type = JSONTokenType::FLOAT32;
+        i += 1;
+        while (i < text.size && IsDigit(text.data[i])) {
+            i += 1;
+        }
+    }
+
+    if (i < text.size && (text.data[i] == 'e' || text.data[i] == 'E')) {
+        type = JSONTokenType::FLOAT32;
+        i += 1;
+        if (i < text.size && (text.data[i] == '-' || text.data[i] == '+')) {
+            i += 1;
+        }
+
+        uint32 exponent_start = i;
+        while (i < text.size && IsDigit(text.data[i])) {
+            i += 1;
+        }
+        if (i == exponent_start) {
+            return JSONTokenType::NONE;
+        }
+    }
+
+    return i == text.size ? type : JSONTokenType::NONE;
+}
+
+// An object's next key may follow its open bracket or previous value without a comma.
+bool ExpectingKey(JSONReader* reader) {
+    return reader->expect == JSONReaderExpect::COMMA_ITEM_OR_CLOSE && !reader->is_array_stack[reader->depth - 1];
+}
+
+void CheckExpectingValue(JSONReader* reader, char c) {
+    if (reader->expect == JSONReaderExpect::ROOT && c != '{' && c != '[') {
+        CTK_FATAL("JSON must start with { or [: found '%c' at byte %llu", c, GetInputOffset(reader));
+    }
+    if (reader->expect == JSONReaderExpect::COLON) {
+        CTK_FATAL("expected colon after key: found '%c' at byte %llu", c, GetInputOffset(reader));
+    }
+    if (reader->expect == JSONReaderExpect::KEY_OR_CLOSE || ExpectingKey(reader)) {
+        CTK_FATAL("expected string key or '}': found '%c' at byte %llu", c, GetInputOffset(reader));
+    }
+    if (reader->expect != JSONReaderExpect::ROOT           && reader->expect != JSONReaderExpect::VALUE &&
+        reader->expect != JSONReaderExpect::VALUE_OR_CLOSE && reader->expect != JSONReaderExpect::COMMA_ITEM_OR_CLOSE) {
+        CTK_FATAL("unexpected value starting with '%c' at byte %llu", c, GetInputOffset(reader));
+    }
+}
+
+void EndValue(JSONReader* reader) {
+    reader->expect = reader->depth == 0 ? JSONReaderExpect::END : JSONReaderExpect::COMMA_ITEM_OR_CLOSE;
+}
+
+// Called before anything is opened or allocated, so invalid settings don't leak a file handle.
+void ValidateReader(uint32 buffer_size, uint32 max_depth) {
+    if (buffer_size == 0) {
+        CTK_FATAL("can't create JSON reader with buffer size of 0");
+    }
+    if (max_depth == 0) {
+        CTK_FATAL("can't create JSON reader with max depth of 0");
+    }
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+// read is called with read_data each time reader needs more input.
+JSONReader CreateJSONReader(Allocator* allocator, JSONReadFunc read, void* read_data, uint32 buffer_size,
+                            uint32 max_depth) {
+    CTK_ASSERT(allocator != NULL);
+    CTK_ASSERT(read != NULL);
+    ValidateReader(buffer_size, max_depth);
+
+    JSONReader reader = {};
+    reader.allocator      = allocator;
+    reader.read           = read;
+    reader.read_data      = read_data;
+    reader.file           = NULL;
+    reader.buffer         = AllocateNZ<char>(allocator, buffer_size);
+    reader.buffer_size    = buffer_size;
+    reader.is_array_stack = AllocateNZ<bool>(allocator, max_depth);
+    reader.max_depth      = max_depth;
+    reader.expect         = JSONReaderExpect::ROOT;
+    return reader;
+}
+
+JSONReader CreateJSONFileReader(Allocator* allocator, const char* path, uint32 buffer_size, uint32 max_depth) {
+    ValidateReader(buffer_size, max_depth);
+    OFSTRUCT file_info = {};
+    auto file = (HANDLE)OpenFile(path, &file_info, OF_READ);
+    if (file_info.nErrCode != ERROR_SUCCESS) {
+        Win32Error e = {};
+        GetWin32Error(&e);
+        CTK_FATAL("OpenFile() failed for \"%s\": %.*s", path, e.message_length, e.message);
+    }
+
+    JSONReader reader = CreateJSONReader(allocator, ReadJSONFile, file, buffer_size, max_depth);
+    reader.file = file;
+    return reader;
+}
+
+void DestroyJSONReader(JSONReader* reader) {
+    CTK_ASSERT(reader->allocator != NULL);
+
+    if (reader->file != NULL) {
+        CloseHandle(reader->file);
+    }
+    Deallocate(reader->allocator, reader->buffer);
+    Deallocate(reader->allocator, reader->is_array_stack);
+    *reader = {};
+}
+
+// Reads the next event into event. Returns false once the root array or object has ended and the rest of input is
+// whitespace (or a trailing comma), or if input is empty. Commas are optional, with the same grammar as LoadJSON().
+bool NextEvent(JSONReader* reader, JSONEvent* event) {
+    while (true) {
+        if (!SkipWhitespace(reader)) {
+            if (reader->expect != JSONReaderExpect::END && reader->expect != JSONReaderExpect::ROOT) {
+                CTK_FATAL("reached end of input at byte %llu with %u arrays or objects left open",
+                          GetInputOffset(reader), reader->depth);
+            }
+            return false;
+        }
+
+        *event = {};
+        event->depth = reader->depth;
+        char c = reader->buffer[reader->index];
+        switch (c) {
+            case '[':
+            case '{': {
+                CheckExpectingValue(reader, c);
+                if (reader->depth == reader->max_depth) {
+                    CTK_FATAL("can't read JSON nested deeper than reader's max depth of %u: found '%c' at byte %llu",
+                              reader->max_depth, c, GetInputOffset(reader));
+                }
+
+                bool is_array = c == '[';
+                reader->is_array_stack[reader->depth] = is_array;
+                reader->depth += 1;
+                reader->index += 1;
+                reader->expect = JSONReaderExpect::COMMA_ITEM_OR_CLOSE;
+                event->type = is_array ? JSONEventType::BEGIN_ARRAY : JSONEventType::BEGIN_OBJECT;
+                return true;
+            }
+            case ']':
+            case '}': {
+                // Checking the stack also catches closing an empty list with the wrong bracket.
+                bool is_array = c == ']';
+                if ((reader->expect != JSONReaderExpect::KEY_OR_CLOSE   &&
+                     reader->expect != JSONReaderExpect::VALUE_OR_CLOSE &&
+                     reader->expect != JSONReaderExpect::COMMA_ITEM_OR_CLOSE) ||
+                    reader->is_array_stack[reader->depth - 1] != is_array) {
+                    CTK_FATAL("unexpected close bracket '%c' at byte %llu", c, GetInputOffset(reader));
+                }
+
+                reader->depth -= 1;
+                reader->index += 1;
+                EndValue(reader);
+                event->type  = is_array ? JSONEventType::END_ARRAY : JSONEventType::END_OBJECT;
+                event->depth = reader->depth;
+                return true;
+            }
+            case ':': {
+                if (reader->expect != JSONReaderExpect::COLON) {
+                    CTK_FATAL("unexpected colon at byte %llu", GetInputOffset(reader));
+                }
+                reader->index += 1;
+                reader->expect = JSONReaderExpect::VALUE;
+                break;
+            }
+            case ',': {
+                // A list's items and close bracket may each follow one comma, and the root list may be followed by one.
+                if (reader->expect == JSONReaderExpect::COMMA_ITEM_OR_CLOSE) {
+                    reader->expect = reader->is_array_stack[reader->depth - 1] ? JSONReaderExpect::VALUE_OR_CLOSE :
+                                                                                 JSONReaderExpect::KEY_OR_CLOSE;
+                }
+                else if (reader->expect != JSONReaderExpect::END) {
+                    CTK_FATAL("unexpected comma at byte %llu", GetInputOffset(reader));
+                }
+                reader->index += 1;
+                break;
+            }
+            case '\"': {
+                if (reader->expect == JSONReaderExpect::KEY_OR_CLOSE || ExpectingKey(reader)) {
+                    event->type = JSONEventType::KEY;
+                    event->text = ReadStringToken(reader);
+                    reader->expect = JSONReaderExpect::COLON;
+                    return true;
+                }
+
+                CheckExpectingValue(reader, c);
+                event->type = JSONEventType::STRING;
+                event->text = ReadStringToken(reader);
+                EndValue(reader);
+                return true;
+            }
+            default: {
+                CheckExpectingValue(reader, c);
+                uint64 offset = GetInputOffset(reader);
+                event->text = ReadValueToken(reader);
+                if (StringsMatch(event->text.data, event->text.size, "true") ||
+                    StringsMatch(event->text.data, event->text.size, "false")) {
+                    event->type    = JSONEventType::BOOLEAN;
+                    event->boolean = event->text.size == 4;
+                }
+                else if (StringsMatch(event->text.data, event->text.size, "null")) {
+                    event->type = JSONEventType::NULL_;
+                }
+                else {
+                    JSONTokenType number_type = GetNumberTokenType(event->text);
+                    if (number_type == JSONTokenType::UINT32) {
+                        event->type       = JSONEventType::UINT32;
+                        event->num_uint32 = ToUInt32(event->text.data, event->text.size);
+                    }
+                    else if (number_type == JSONTokenType::SINT32) {
+                        event->type       = JSONEventType::SINT32;
+                        event->num_sint32 = ToSInt32(event->text.data, event->text.size);
+                    }
+                    else if (number_type == JSONTokenType::FLOAT32) {
+                        event->type        = JSONEventType::FLOAT32;
+                        event->num_float32 = ToFloat32(event->text.data, event->text.size);
+                    }
+                    else {
+                        CTK_FATAL("invalid value at byte %llu: '%.*s'", offset, event->text.size, event->text.data);
+                    }
+                }
+                EndValue(reader);
+                return true;
+            }
+        }
+    }
+}
+
+// Calls handle_event with data for each event, for callback-style reading.
+void ReadJSON(JSONReader* reader, Func<void, void*, JSONEvent*> handle_event, void* data) {
+    JSONEvent event = {};
+    while (NextEvent(reader, &event)) {
+        handle_event(data, &event);
+    }
+}
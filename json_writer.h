@@ -0,0 +1,554 @@
+/// Data
+////////////////////////////////////////////////////////////
+// Writes size bytes of output; called each time writer's buffer fills and when writer is flushed.
+using JSONWriteFunc = Func<void, void*, const char*, uint32>;
+
+// Smallest buffer a writer flushing to a JSONWriteFunc can have, so any number, literal or separator fits at once.
+constexpr uint32 JSON_WRITER_MIN_BUFFER_SIZE = 64;
+
+enum struct JSONWriteMode {
+    COMPACT, // No whitespace.
+    PRETTY,  // One key or value per line, indented 4 spaces per level.
+};
+
+enum struct JSONWriterExpect {
+    ROOT,
+    KEY_OR_CLOSE,
+    VALUE,
+    VALUE_OR_CLOSE,
+    END,
+};
+
+struct JSONWriterList {
+    bool is_array;
+    bool has_items;
+};
+
+// Writes JSON either to a String, which grows to fit, or through a fixed buffer that's passed to write each time it
+// fills, so memory use doesn't depend on output size. Calls are checked against the JSON written so far, so output is
+// always valid JSON in the dialect LoadJSON() reads.
+struct JSONWriter {
+    Allocator*       allocator;
+    String*          out;          // Only set for writers created with a String to write to.
+    JSONWriteFunc    write;
+    void*            write_data;
+    HANDLE           file;         // Only set for writers created by CreateJSONFileWriter().
+    String           buffer;       // Output waiting to be passed to write, for writers without out.
+    JSONWriteMode    mode;
+    JSONWriterList*  list_stack;
+    uint32           max_depth;
+    uint32           depth;
+    JSONWriterExpect expect;
+};
+
+/// Scalar Implementations
+////////////////////////////////////////////////////////////
+// Chars written as escape sequences are '"', '\\' and control chars; see WriteEscapedString(). Returns size if string
+// has none.
+uint32 Scalar_FindEscapeChar(const char* string, uint32 size) {
+    for (uint32 i = 0; i < size; i += 1) {
+        uint8 c = (uint8)string[i];
+        if (c == '\"' || c == '\\' || c < 0x20) {
+            return i;
+        }
+    }
+
+    return size;
+}
+
+/// SSE2 Implementations
+////////////////////////////////////////////////////////////
+uint32 SSE2_FindEscapeChar(const char* string, uint32 size) {
+    __m128i quote            = _mm_set1_epi8('\"');
+    __m128i backslash        = _mm_set1_epi8('\\');
+    __m128i max_control_char = _mm_set1_epi8(0x1F);
+    uint32 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i chars = _mm_loadu_si128((const __m128i*)&string[i]);
+
+        // Chars are control chars if unsigned min with 0x1F leaves them unchanged.
+        __m128i escape_chars = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, quote),
+                                                         _mm_cmpeq_epi8(chars, backslash)),
+                                            _mm_cmpeq_epi8(_mm_min_epu8(chars, max_control_char), chars));
+        uint32 mask = (uint32)_mm_movemask_epi8(escape_chars);
+        if (mask != 0) {
+            return i + CountTrailingZeros(mask);
+        }
+    }
+
+    return i + Scalar_FindEscapeChar(&string[i], size - i);
+}
+
+/// AVX2 Implementations
+////////////////////////////////////////////////////////////
+uint32 AVX2_FindEscapeChar(const char* string, uint32 size) {
+    __m256i quote            = _mm256_set1_epi8('\"');
+    __m256i backslash        = _mm256_set1_epi8('\\');
+    __m256i max_control_char = _mm256_set1_epi8(0x1F);
+    uint32 i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i chars = _mm256_loadu_si256((const __m256i*)&string[i]);
+        __m256i escape_chars = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chars, quote),
+                                                               _mm256_cmpeq_epi8(chars, backslash)),
+                                               _mm256_cmpeq_epi8(_mm256_min_epu8(chars, max_control_char), chars));
+        uint32 mask = (uint32)_mm256_movemask_epi8(escape_chars);
+        if (mask != 0) {
+            return i + CountTrailingZeros(mask);
+        }
+    }
+
+    return i + SSE2_FindEscapeChar(&string[i], size - i);
+}
+
+/// Utils
+////////////////////////////////////////////////////////////
+uint32 FindEscapeChar(const char* string, uint32 size) {
+    return HasAVX2() ? AVX2_FindEscapeChar(string, size) : SSE2_FindEscapeChar(string, size);
+}
+
+void WriteJSONFile(void* file, const char* chars, uint32 size) {
+    DWORD bytes_written = 0;
+    if (!::WriteFile((HANDLE)file, chars, size, &bytes_written, NULL)) {
+        Win32Error e = {};
+        GetWin32Error(&e);
+        CTK_FATAL("WriteFile() failed while writing JSON: %.*s", e.message_length, e.message);
+    }
+    if (bytes_written != size) {
+        CTK_FATAL("failed to write %u bytes of JSON: only wrote %u bytes", size, bytes_written);
+    }
+}
+
+String* GetOutput(JSONWriter* writer) {
+    return writer->out != NULL ? writer->out : &writer->buffer;
+}
+
+void FlushBuffer(JSONWriter* writer) {
+    if (writer->buffer.count > 0) {
+        writer->write(writer->write_data, writer->buffer.data, writer->buffer.count);
+        writer->buffer.count = 0;
+    }
+}
+
+// Returns space for size chars at the end of output, growing or flushing output first if there isn't enough. size
+// can't exceed JSON_WRITER_MIN_BUFFER_SIZE; the caller adds the number of chars it wrote to output's count.
+char* ReserveOutput(JSONWriter* writer, uint32 size) {
+    String* output = GetOutput(writer);
+    if (output->size - output->count < size) {
+        if (writer->out != NULL) {
+            ResizeNZ(output, Max(output->size * 2, output->count + size));
+        }
+        else {
+            FlushBuffer(writer);
+        }
+    }
+    return &output->data[output->count];
+}
+
+void WriteChars(JSONWriter* writer, const char* chars, uint32 size) {
+    String* output = GetOutput(writer);
+    if (writer->out != NULL) {
+        if (output->size - output->count < size) {
+            ResizeNZ(output, Max(output->size * 2, output->count + size));
+        }
+        memcpy(&output->data[output->count], chars, size);
+        output->count += size;
+        return;
+    }
+
+    // Fill buffer a piece at a time, flushing each time it fills.
+    while (size > 0) {
+        if (output->count == output->size) {
+            FlushBuffer(writer);
+        }
+        uint32 piece_size = Min(size, output->size - output->count);
+        memcpy(&output->data[output->count], chars, piece_size);
+        output->count += piece_size;
+        chars += piece_size;
+        size  -= piece_size;
+    }
+}
+
+void WriteChar(JSONWriter* writer, char c) {
+    *ReserveOutput(writer, 1) = c;
+    GetOutput(writer)->count += 1;
+}
+
+void WriteNewLine(JSONWriter* writer, uint32 depth) {
+    constexpr const char SPACES[] = "                                ";
+    constexpr uint32 SPACES_SIZE = CTK_ARRAY_SIZE(SPACES) - 1;
+
+    WriteChar(writer, '\n');
+    for (uint32 indent_size = depth * 4; indent_size > 0;) {
+        uint32 piece_size = Min(indent_size, SPACES_SIZE);
+        WriteChars(writer, SPACES, piece_size);
+        indent_size -= piece_size;
+    }
+}
+
+// Writes string in quotation marks, writing '"', '\\' and control chars as escape sequences. Control chars without a
+// short escape sequence are written as "\u00XX".
+void WriteEscapedString(JSONWriter* writer, const char* string, uint32 size) {
+    constexpr const char* HEX_DIGITS = "0123456789ABCDEF";
+
+    WriteChar(writer, '\"');
+    uint32 region_start = 0;
+    while (true) {
+        uint32 i = region_start + FindEscapeChar(&string[region_start], size - region_start);
+        WriteChars(writer, &string[region_start], i - region_start);
+        if (i == size) {
+            break;
+        }
+
+        char escape_char = 0;
+        switch (string[i]) {
+            case '\"': { escape_char = '\"'; break; }
+            case '\\': { escape_char = '\\'; break; }
+            case '\b': { escape_char = 'b';  break; }
+            case '\f': { escape_char = 'f';  break; }
+            case '\n': { escape_char = 'n';  break; }
+            case '\r': { escape_char = 'r';  break; }
+            case '\t': { escape_char = 't';  break; }
+        }
+        if (escape_char != 0) {
+            char* escape = ReserveOutput(writer, 2);
+            escape[0] = '\\';
+            escape[1] = escape_char;
+            GetOutput(writer)->count += 2;
+        }
+        else {
+            uint8 control_char = (uint8)string[i];
+            char* escape = ReserveOutput(writer, 6);
+            escape[0] = '\\';
+            escape[1] = 'u';
+            escape[2] = '0';
+            escape[3] = '0';
+            escape[4] = HEX_DIGITS[control_char >> 4];
+            escape[5] = HEX_DIGITS[control_char & 0xF];
+            GetOutput(writer)->count += 6;
+        }
+        region_start = i + 1;
+    }
+    WriteChar(writer, '\"');
+}
+
+void ValidateBufferedWriter(uint32 buffer_size, uint32 max_depth) {
+    if (buffer_size < JSON_WRITER_MIN_BUFFER_SIZE) {
+        CTK_FATAL("can't create JSON writer with buffer size of %u: min is %u", buffer_size,
+                  JSON_WRITER_MIN_BUFFER_SIZE);
+    }
+    if (max_depth == 0) {
+        CTK_FATAL("can't create JSON writer with max depth of 0");
+    }
+}
+
+// Checks a value can be written, then writes the separator and whitespace before it.
+void BeginValue(JSONWriter* writer, bool is_list) {
+    if (writer->expect == JSONWriterExpect::ROOT) {
+        if (!is_list) {
+            CTK_FATAL("can't write JSON value: root must be an array or object");
+        }
+        return;
+    }
+    if (writer->expect == JSONWriterExpect::KEY_OR_CLOSE) {
+        CTK_FATAL("can't write JSON value: expected key in object");
+    }
+    if (writer->expect == JSONWriterExpect::END) {
+        CTK_FATAL("can't write JSON value: root has already ended");
+    }
+
+    // Values in objects follow their key, which already wrote separators.
+    if (writer->expect == JSONWriterExpect::VALUE_OR_CLOSE) {
+        JSONWriterList* list = &writer->list_stack[writer->depth - 1];
+        if (list->has_items) {
+            WriteChar(writer, ',');
+        }
+        if (writer->mode == JSONWriteMode::PRETTY) {
+            WriteNewLine(writer, writer->depth);
+        }
+        list->has_items = true;
+    }
+}
+
+// Updates what writer expects next once a value, including a list, has been written.
+void FinishValue(JSONWriter* writer) {
+    if (writer->depth == 0) {
+        writer->expect = JSONWriterExpect::END;
+        if (writer->mode == JSONWriteMode::PRETTY) {
+            WriteChar(writer, '\n');
+        }
+    }
+    else {
+        writer->expect = writer->list_stack[writer->depth - 1].is_array ? JSONWriterExpect::VALUE_OR_CLOSE
+                                                                        : JSONWriterExpect::KEY_OR_CLOSE;
+    }
+}
+
+void BeginList(JSONWriter* writer, bool is_array) {
+    BeginValue(writer, true);
+    if (writer->depth == writer->max_depth) {
+        CTK_FATAL("can't write JSON nested deeper than writer's max depth of %u", writer->max_depth);
+    }
+
+    writer->list_stack[writer->depth] = { .is_array = is_array, .has_items = false };
+    writer->depth += 1;
+    writer->expect = is_array ? JSONWriterExpect::VALUE_OR_CLOSE : JSONWriterExpect::KEY_OR_CLOSE;
+    WriteChar(writer, is_array ? '[' : '{');
+}
+
+void EndList(JSONWriter* writer, bool is_array) {
+    JSONWriterExpect expect = is_array ? JSONWriterExpect::VALUE_OR_CLOSE : JSONWriterExpect::KEY_OR_CLOSE;
+    if (writer->expect != expect) {
+        CTK_FATAL("can't end JSON %s: no %s is open or a key is missing its value",
+                  is_array ? "array" : "object",
+                  is_array ? "array" : "object");
+    }
+
+    writer->depth -= 1;
+    if (writer->mode == JSONWriteMode::PRETTY && writer->list_stack[writer->depth].has_items) {
+        WriteNewLine(writer, writer->depth);
+    }
+    WriteChar(writer, is_array ? ']' : '}');
+    FinishValue(writer);
+}
+
+// Writes key's chars as-is when escape is false, for keys that are already escaped like those loaded by LoadJSON().
+void WriteKey(JSONWriter* writer, const char* key, uint32 key_size, bool escape) {
+    if (writer->expect != JSONWriterExpect::KEY_OR_CLOSE) {
+        CTK_FATAL("can't write JSON key \"%.*s\": not expecting a key", key_size, key);
+    }
+
+    JSONWriterList* list = &writer->list_stack[writer->depth - 1];
+    if (list->has_items) {
+        WriteChar(writer, ',');
+    }
+    if (writer->mode == JSONWriteMode::PRETTY) {
+        WriteNewLine(writer, writer->depth);
+    }
+    list->has_items = true;
+
+    if (escape) {
+        WriteEscapedString(writer, key, key_size);
+    }
+    else {
+        WriteChar(writer, '\"');
+        WriteChars(writer, key, key_size);
+        WriteChar(writer, '\"');
+    }
+
+    if (writer->mode == JSONWriteMode::PRETTY) {
+        WriteChars(writer, ": ", 2);
+    }
+    else {
+        WriteChar(writer, ':');
+    }
+    writer->expect = JSONWriterExpect::VALUE;
+}
+
+// Floats that format as integers get ".0" appended so they load back as FLOAT32 nodes rather than UINT32 or SINT32.
+uint32 FormatJSONFloat(char* buffer, float32 value) {
+    if (!isfinite(value)) {
+        CTK_FATAL("can't write %f as JSON: JSON has no infinity or NaN", value);
+    }
+
+    uint32 size = FormatFloat(buffer, value);
+    for (uint32 i = 0; i < size; i += 1) {
+        if (buffer[i] == '.' || buffer[i] == 'e') {
+            return size;
+        }
+    }
+    buffer[size]     = '.';
+    buffer[size + 1] = '0';
+    return size + 2;
+}
+
+void WriteNode(JSONWriter* writer, JSON* json, JSONNode* node);
+
+void WriteList(JSONWriter* writer, JSON* json, JSONNodeList* list, bool is_array) {
+    BeginList(writer, is_array);
+    for (uint32 child_index = 0; child_index < list->size; child_index += 1) {
+        JSONNode* child_node = &json->nodes.data[list->node_index + child_index];
+        if (!is_array) {
+            WriteKey(writer, child_node->key.data, child_node->key.size, false);
+        }
+        WriteNode(writer, json, child_node);
+    }
+    EndList(writer, is_array);
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+// write is called with write_data each time buffer_size bytes of output are ready, and on FlushJSONWriter().
+JSONWriter CreateJSONWriter(Allocator* allocator, JSONWriteFunc write, void* write_data, uint32 buffer_size,
+                            JSONWriteMode mode, uint32 max_depth) {
+    CTK_ASSERT(allocator != NULL);
+    CTK_ASSERT(write != NULL);
+    ValidateBufferedWriter(buffer_size, max_depth);
+
+    JSONWriter writer = {};
+    writer.allocator  = allocator;
+    writer.out        = NULL;
+    writer.write      = write;
+    writer.write_data = write_data;
+    writer.file       = NULL;
+    writer.buffer     = CreateString(allocator, buffer_size);
+    writer.mode       = mode;
+    writer.list_stack = AllocateNZ<JSONWriterList>(allocator, max_depth);
+    writer.max_depth  = max_depth;
+    writer.expect     = JSONWriterExpect::ROOT;
+    return writer;
+}
+
+// Appends output to out, growing it as needed.
+JSONWriter CreateJSONWriter(Allocator* allocator, String* out, JSONWriteMode mode, uint32 max_depth) {
+    CTK_ASSERT(allocator != NULL);
+    CTK_ASSERT(out != NULL && out->allocator != NULL);
+    if (max_depth == 0) {
+        CTK_FATAL("can't create JSON writer with max depth of 0");
+    }
+
+    JSONWriter writer = {};
+    writer.allocator  = allocator;
+    writer.out        = out;
+    writer.mode       = mode;
+    writer.list_stack = AllocateNZ<JSONWriterList>(allocator, max_depth);
+    writer.max_depth  = max_depth;
+    writer.expect     = JSONWriterExpect::ROOT;
+    return writer;
+}
+
+JSONWriter CreateJSONFileWriter(Allocator* allocator, const char* path, uint32 buffer_size, JSONWriteMode mode,
+                                uint32 max_depth) {
+    // Validate before the file is created so a fatal error can't leak its handle.
+    ValidateBufferedWriter(buffer_size, max_depth);
+    HANDLE file = ::CreateFile(path,
+                               GENERIC_WRITE,         // Access
+                               0,                     // Share Mode
+                               NULL,                  // Security Attributes
+                               CREATE_ALWAYS,         // Create Mode
+                               FILE_ATTRIBUTE_NORMAL, // File Attributes
+                               NULL);                 // Template File
+    if (file == INVALID_HANDLE_VALUE) {
+        Win32Error e = {};
+        GetWin32Error(&e);
+        CTK_FATAL("CreateFile() failed for \"%s\": %.*s", path, e.message_length, e.message);
+    }
+
+    JSONWriter writer = CreateJSONWriter(allocator, WriteJSONFile, file, buffer_size, mode, max_depth);
+    writer.file = file;
+    return writer;
+}
+
+// Passes buffered output to writer's write func; does nothing for writers writing to a String.
+void FlushJSONWriter(JSONWriter* writer) {
+    if (writer->out == NULL) {
+        FlushBuffer(writer);
+    }
+}
+
+// Flushes buffered output before destroying writer.
+void DestroyJSONWriter(JSONWriter* writer) {
+    CTK_ASSERT(writer->allocator != NULL);
+
+    FlushJSONWriter(writer);
+    if (writer->file != NULL) {
+        CloseHandle(writer->file);
+    }
+    if (writer->out == NULL) {
+        DestroyString(&writer->buffer);
+    }
+    Deallocate(writer->allocator, writer->list_stack);
+    *writer = {};
+}
+
+void BeginObject(JSONWriter* writer) {
+    BeginList(writer, false);
+}
+
+void EndObject(JSONWriter* writer) {
+    EndList(writer, false);
+}
+
+void BeginArray(JSONWriter* writer) {
+    BeginList(writer, true);
+}
+
+void EndArray(JSONWriter* writer) {
+    EndList(writer, true);
+}
+
+void WriteKey(JSONWriter* writer, const char* key, uint32 key_size) {
+    WriteKey(writer, key, key_size, true);
+}
+
+void WriteKey(JSONWriter* writer, const char* key) {
+    WriteKey(writer, key, StringSize(key), true);
+}
+
+void WriteUInt32(JSONWriter* writer, uint32 value) {
+    BeginValue(writer, false);
+    char* buffer = ReserveOutput(writer, FORMAT_MAX_NUMBER_SIZE);
+    GetOutput(writer)->count += FormatUInt(buffer, value);
+    FinishValue(writer);
+}
+
+void WriteSInt32(JSONWriter* writer, sint32 value) {
+    BeginValue(writer, false);
+    char* buffer = ReserveOutput(writer, FORMAT_MAX_NUMBER_SIZE);
+    GetOutput(writer)->count += FormatSInt(buffer, value);
+    FinishValue(writer);
+}
+
+void WriteFloat32(JSONWriter* writer, float32 value) {
+    BeginValue(writer, false);
+    char* buffer = ReserveOutput(writer, FORMAT_MAX_NUMBER_SIZE + 2);
+    GetOutput(writer)->count += FormatJSONFloat(buffer, value);
+    FinishValue(writer);
+}
+
+void WriteString(JSONWriter* writer, const char* string, uint32 size) {
+    BeginValue(writer, false);
+    WriteEscapedString(writer, string, size);
+    FinishValue(writer);
+}
+
+void WriteString(JSONWriter* writer, const char* string) {
+    WriteString(writer, string, StringSize(string));
+}
+
+void WriteBoolean(JSONWriter* writer, bool value) {
+    BeginValue(writer, false);
+    WriteChars(writer, value ? "true" : "false", value ? 4 : 5);
+    FinishValue(writer);
+}
+
+void WriteNull(JSONWriter* writer) {
+    BeginValue(writer, false);
+    WriteChars(writer, "null", 4);
+    FinishValue(writer);
+}
+
+// Writes node and all its children.
+void WriteNode(JSONWriter* writer, JSON* json, JSONNode* node) {
+    switch (node->type) {
+        case JSONNodeType::ARRAY:   { WriteList(writer, json, &node->list, true); break; }
+        case JSONNodeType::OBJECT:  { WriteList(writer, json, &node->list, false); break; }
+        case JSONNodeType::UINT32:  { WriteUInt32(writer, node->num_uint32); break; }
+        case JSONNodeType::SINT32:  { WriteSInt32(writer, node->num_sint32); break; }
+        case JSONNodeType::FLOAT32: { WriteFloat32(writer, node->num_float32); break; }
+        case JSONNodeType::STRING:  { WriteString(writer, node->string.data, node->string.size); break; }
+        case JSONNodeType::BOOLEAN: { WriteBoolean(writer, node->boolean); break; }
+        case JSONNodeType::NULL_:   { WriteNull(writer); break; }
+    }
+}
+
+void WriteJSON(JSONWriter* writer, JSON* json) {
+    WriteNode(writer, json, &json->root_node);
+}
+
+// Writes json to a new file at path, replacing any existing file. JSON from an empty file has a max_depth of 0 but
+// still has a root to write.
+void SaveJSON(JSON* json, const char* path, JSONWriteMode mode = JSONWriteMode::PRETTY) {
+    JSONWriter writer = CreateJSONFileWriter(json->allocator, path, Kilobyte32<64>(), mode, Max(json->max_depth, 1u));
+    WriteJSON(&writer, json);
+    DestroyJSONWriter(&writer);
+}
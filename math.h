@@ -86,6 +86,55 @@ CTK_CLAMP_FUNC(sint64)
 CTK_CLAMP_FUNC(float32)
 CTK_CLAMP_FUNC(float64)
 
+bool IsPowerOf2(uint32 val) {
+    return val > 0 && (val & (val - 1)) == 0;
+}
+
+uint32 CountTrailingZeros(uint32 val) {
+    CTK_ASSERT(val != 0);
+
+    unsigned long index = 0;
+    _BitScanForward(&index, val);
+    return (uint32)index;
+}
+
+uint32 CountTrailingZeros(uint64 val) {
+    CTK_ASSERT(val != 0);
+
+    unsigned long index = 0;
+    _BitScanForward64(&index, val);
+    return (uint32)index;
+}
+
+uint32 CountLeadingZeros(uint64 val) {
+    CTK_ASSERT(val != 0);
+
+    unsigned long index = 0;
+    _BitScanReverse64(&index, val);
+    return 63 - (uint32)index;
+}
+
+// Full 64x64 -> 128-bit multiply; returns low 64 bits of product and writes high 64 bits to high.
+uint64 Multiply128(uint64 a, uint64 b, uint64* high) {
+    return _umul128(a, b, high);
+}
+
+// Fallback for CPUs without POPCNT: sums bits in 2, 4 then 8-bit fields, then adds the 8 byte sums with a multiply.
+uint32 ScalarPopCount(uint64 val) {
+    val = val - ((val >> 1) & 0x5555555555555555ull);
+    val = (val & 0x3333333333333333ull) + ((val >> 2) & 0x3333333333333333ull);
+    val = (val + (val >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (uint32)((val * 0x0101010101010101ull) >> 56);
+}
+
+uint32 PopCount(uint32 val) {
+    return HasPOPCNT() ? (uint32)__popcnt(val) : ScalarPopCount(val);
+}
+
+uint32 PopCount(uint64 val) {
+    return HasPOPCNT() ? (uint32)__popcnt64(val) : ScalarPopCount(val);
+}
+
 float32 Log2(float32 val) {
     return log2f(val);
 }
@@ -197,6 +246,28 @@ float32 RandomRange(float32 min_val, float32 max_val) {
     return ((float32)rand() / (float32)(RAND_MAX)) * (max_val - min_val) + min_val;
 }
 
+// Returns a state for Random64(), seeded with the current time if seed is 0. seed is mixed with splitmix64, so small or
+// similar seeds still give unrelated, well-mixed states.
+uint64 RandomSeed64(uint64 seed = 0) {
+    uint64 state = (seed ? seed : (uint64)_time64(NULL)) + 0x9E3779B97F4A7C15;
+    state = (state ^ (state >> 30)) * 0xBF58476D1CE4E5B9;
+    state = (state ^ (state >> 27)) * 0x94D049BB133111EB;
+    state ^= state >> 31;
+
+    // xorshift64 never leaves a state of 0.
+    return state ? state : 1;
+}
+
+// xorshift64, for random values wider than rand() gives: rand() only has 15 bits of range on MSVC.
+uint64 Random64(uint64* state) {
+    CTK_ASSERT(*state != 0);
+
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
 /// Vec4
 ////////////////////////////////////////////////////////////
 template<typename Type>
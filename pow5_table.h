@@ -0,0 +1,1340 @@
+/// Data
+////////////////////////////////////////////////////////////
+constexpr sint32 POW5_128_MIN_EXPONENT = -342;
+constexpr sint32 POW5_128_MAX_EXPONENT = 308;
+
+// 128-bit approximations of 5^q for q in [POW5_128_MIN_EXPONENT, POW5_128_MAX_EXPONENT], normalized so the high bit is
+// set; stored as { high 64 bits, low 64 bits } pairs. Used by Eisel-Lemire float parsing in c_string.h.
+constexpr uint64 POW5_128[] = {
+    0xEEF453D6923BD65A, 0x113FAA2906A13B3F, // 5^-342
+    0x9558B4661B6565F8, 0x4AC7CA59A424C507, // 5^-341
+    0xBAAEE17FA23EBF76, 0x5D79BCF00D2DF649, // 5^-340
+    0xE95A99DF8ACE6F53, 0xF4D82C2C107973DC, // 5^-339
+    0x91D8A02BB6C10594, 0x79071B9B8A4BE869, // 5^-338
+    0xB64EC836A47146F9, 0x9748E2826CDEE284, // 5^-337
+    0xE3E27A444D8D98B7, 0xFD1B1B2308169B25, // 5^-336
+    0x8E6D8C6AB0787F72, 0xFE30F0F5E50E20F7, // 5^-335
+    0xB208EF855C969F4F, 0xBDBD2D335E51A935, // 5^-334
+    0xDE8B2B66B3BC4723, 0xAD2C788035E61382, // 5^-333
+    0x8B16FB203055AC76, 0x4C3BCB5021AFCC31, // 5^-332
+    0xADDCB9E83C6B1793, 0xDF4ABE242A1BBF3D, // 5^-331
+    0xD953E8624B85DD78, 0xD71D6DAD34A2AF0D, // 5^-330
+    0x87D4713D6F33AA6B, 0x8672648C40E5AD68, // 5^-329
+    0xA9C98D8CCB009506, 0x680EFDAF511F18C2, // 5^-328
+    0xD43BF0EFFDC0BA48, 0x0212BD1B2566DEF2, // 5^-327
+    0x84A57695FE98746D, 0x014BB630F7604B57, // 5^-326
+    0xA5CED43B7E3E9188, 0x419EA3BD35385E2D, // 5^-325
+    0xCF42894A5DCE35EA, 0x52064CAC828675B9, // 5^-324
+    0x818995CE7AA0E1B2, 0x7343EFEBD1940993, // 5^-323
+    0xA1EBFB4219491A1F, 0x1014EBE6C5F90BF8, // 5^-322
+    0xCA66FA129F9B60A6, 0xD41A26E077774EF6, // 5^-321
+    0xFD00B897478238D0, 0x8920B098955522B4, // 5^-320
+    0x9E20735E8CB16382, 0x55B46E5F5D5535B0, // 5^-319
+    0xC5A890362FDDBC62, 0xEB2189F734AA831D, // 5^-318
+    0xF712B443BBD52B7B, 0xA5E9EC7501D523E4, // 5^-317
+    0x9A6BB0AA55653B2D, 0x47B233C92125366E, // 5^-316
+    0xC1069CD4EABE89F8, 0x999EC0BB696E840A, // 5^-315
+    0xF148440A256E2C76, 0xC00670EA43CA250D, // 5^-314
+    0x96CD2A865764DBCA, 0x380406926A5E5728, // 5^-313
+    0xBC807527ED3E12BC, 0xC605083704F5ECF2, // 5^-312
+    0xEBA09271E88D976B, 0xF7864A44C633682E, // 5^-311
+    0x93445B8731587EA3, 0x7AB3EE6AFBE0211D, // 5^-310
+    0xB8157268FDAE9E4C, 0x5960EA05BAD82964, // 5^-309
+    0xE61ACF033D1A45DF, 0x6FB92487298E33BD, // 5^-308
+    0x8FD0C16206306BAB, 0xA5D3B6D479F8E056, // 5^-307
+    0xB3C4F1BA87BC8696, 0x8F48A4899877186C, // 5^-306
+    0xE0B62E2929ABA83C, 0x331ACDABFE94DE87, // 5^-305
+    0x8C71DCD9BA0B4925, 0x9FF0C08B7F1D0B14, // 5^-304
+    0xAF8E5410288E1B6F, 0x07ECF0AE5EE44DD9, // 5^-303
+    0xDB71E91432B1A24A, 0xC9E82CD9F69D6150, // 5^-302
+    0x892731AC9FAF056E, 0xBE311C083A225CD2, // 5^-301
+    0xAB70FE17C79AC6CA, 0x6DBD630A48AAF406, // 5^-300
+    0xD64D3D9DB981787D, 0x092CBBCCDAD5B108, // 5^-299
+    0x85F0468293F0EB4E, 0x25BBF56008C58EA5, // 5^-298
+    0xA76C582338ED2621, 0xAF2AF2B80AF6F24E, // 5^-297
+    0xD1476E2C07286FAA, 0x1AF5AF660DB4AEE1, // 5^-296
+    0x82CCA4DB847945CA, 0x50D98D9FC890ED4D, // 5^-295
+    0xA37FCE126597973C, 0xE50FF107BAB528A0, // 5^-294
+    0xCC5FC196FEFD7D0C, 0x1E53ED49A96272C8, // 5^-293
+    0xFF77B1FCBEBCDC4F, 0x25E8E89C13BB0F7A, // 5^-292
+    0x9FAACF3DF73609B1, 0x77B191618C54E9AC, // 5^-291
+    0xC795830D75038C1D, 0xD59DF5B9EF6A2417, // 5^-290
+    0xF97AE3D0D2446F25, 0x4B0573286B44AD1D, // 5^-289
+    0x9BECCE62836AC577, 0x4EE367F9430AEC32, // 5^-288
+    0xC2E801FB244576D5, 0x229C41F793CDA73F, // 5^-287
+    0xF3A20279ED56D48A, 0x6B43527578C1110F, // 5^-286
+    0x9845418C345644D6, 0x830A13896B78AAA9, // 5^-285
+    0xBE5691EF416BD60C, 0x23CC986BC656D553, // 5^-284
+    0xEDEC366B11C6CB8F, 0x2CBFBE86B7EC8AA8, // 5^-283
+    0x94B3A202EB1C3F39, 0x7BF7D71432F3D6A9, // 5^-282
+    0xB9E08A83A5E34F07, 0xDAF5CCD93FB0CC53, // 5^-281
+    0xE858AD248F5C22C9, 0xD1B3400F8F9CFF68, // 5^-280
+    0x91376C36D99995BE, 0x23100809B9C21FA1, // 5^-279
+    0xB58547448FFFFB2D, 0xABD40A0C2832A78A, // 5^-278
+    0xE2E69915B3FFF9F9, 0x16C90C8F323F516C, // 5^-277
+    0x8DD01FAD907FFC3B, 0xAE3DA7D97F6792E3, // 5^-276
+    0xB1442798F49FFB4A, 0x99CD11CFDF41779C, // 5^-275
+    0xDD95317F31C7FA1D, 0x40405643D711D583, // 5^-274
+    0x8A7D3EEF7F1CFC52, 0x482835EA666B2572, // 5^-273
+    0xAD1C8EAB5EE43B66, 0xDA3243650005EECF, // 5^-272
+    0xD863B256369D4A40, 0x90BED43E40076A82, // 5^-271
+    0x873E4F75E2224E68, 0x5A7744A6E804A291, // 5^-270
+    0xA90DE3535AAAE202, 0x711515D0A205CB36, // 5^-269
+    0xD3515C2831559A83, 0x0D5A5B44CA873E03, // 5^-268
+    0x8412D9991ED58091, 0xE858790AFE9486C2, // 5^-267
+    0xA5178FFF668AE0B6, 0x626E974DBE39A872, // 5^-266
+    0xCE5D73FF402D98E3, 0xFB0A3D212DC8128F, // 5^-265
+    0x80FA687F881C7F8E, 0x7CE66634BC9D0B99, // 5^-264
+    0xA139029F6A239F72, 0x1C1FFFC1EBC44E80, // 5^-263
+    0xC987434744AC874E, 0xA327FFB266B56220, // 5^-262
+    0xFBE9141915D7A922, 0x4BF1FF9F0062BAA8, // 5^-261
+    0x9D71AC8FADA6C9B5, 0x6F773FC3603DB4A9, // 5^-260
+    0xC4CE17B399107C22, 0xCB550FB4384D21D3, // 5^-259
+    0xF6019DA07F549B2B, 0x7E2A53A146606A48, // 5^-258
+    0x99C102844F94E0FB, 0x2EDA7444CBFC426D, // 5^-257
+    0xC0314325637A1939, 0xFA911155FEFB5308, // 5^-256
+    0xF03D93EEBC589F88, 0x793555AB7EBA27CA, // 5^-255
+    0x96267C7535B763B5, 0x4BC1558B2F3458DE, // 5^-254
+    0xBBB01B9283253CA2, 0x9EB1AAEDFB016F16, // 5^-253
+    0xEA9C227723EE8BCB, 0x465E15A979C1CADC, // 5^-252
+    0x92A1958A7675175F, 0x0BFACD89EC191EC9, // 5^-251
+    0xB749FAED14125D36, 0xCEF980EC671F667B, // 5^-250
+    0xE51C79A85916F484, 0x82B7E12780E7401A, // 5^-249
+    0x8F31CC0937AE58D2, 0xD1B2ECB8B0908810, // 5^-248
+    0xB2FE3F0B8599EF07, 0x861FA7E6DCB4AA15, // 5^-247
+    0xDFBDCECE67006AC9, 0x67A791E093E1D49A, // 5^-246
+    0x8BD6A141006042BD, 0xE0C8BB2C5C6D24E0, // 5^-245
+    0xAECC49914078536D, 0x58FAE9F773886E18, // 5^-244
+    0xDA7F5BF590966848, 0xAF39A475506A899E, // 5^-243
+    0x888F99797A5E012D, 0x6D8406C952429603, // 5^-242
+    0xAAB37FD7D8F58178, 0xC8E5087BA6D33B83, // 5^-241
+    0xD5605FCDCF32E1D6, 0xFB1E4A9A90880A64, // 5^-240
+    0x855C3BE0A17FCD26, 0x5CF2EEA09A55067F, // 5^-239
+    0xA6B34AD8C9DFC06F, 0xF42FAA48C0EA481E, // 5^-238
+    0xD0601D8EFC57B08B, 0xF13B94DAF124DA26, // 5^-237
+    0x823C12795DB6CE57, 0x76C53D08D6B70858, // 5^-236
+    0xA2CB1717B52481ED, 0x54768C4B0C64CA6E, // 5^-235
+    0xCB7DDCDDA26DA268, 0xA9942F5DCF7DFD09, // 5^-234
+    0xFE5D54150B090B02, 0xD3F93B35435D7C4C, // 5^-233
+    0x9EFA548D26E5A6E1, 0xC47BC5014A1A6DAF, // 5^-232
+    0xC6B8E9B0709F109A, 0x359AB6419CA1091B, // 5^-231
+    0xF867241C8CC6D4C0, 0xC30163D203C94B62, // 5^-230
+    0x9B407691D7FC44F8, 0x79E0DE63425DCF1D, // 5^-229
+    0xC21094364DFB5636, 0x985915FC12F542E4, // 5^-228
+    0xF294B943E17A2BC4, 0x3E6F5B7B17B2939D, // 5^-227
+    0x979CF3CA6CEC5B5A, 0xA705992CEECF9C42, // 5^-226
+    0xBD8430BD08277231, 0x50C6FF782A838353, // 5^-225
+    0xECE53CEC4A314EBD, 0xA4F8BF5635246428, // 5^-224
+    0x940F4613AE5ED136, 0x871B7795E136BE99, // 5^-223
+    0xB913179899F68584, 0x28E2557B59846E3F, // 5^-222
+    0xE757DD7EC07426E5, 0x331AEADA2FE589CF, // 5^-221
+    0x9096EA6F3848984F, 0x3FF0D2C85DEF7621, // 5^-220
+    0xB4BCA50B065ABE63, 0x0FED077A756B53A9, // 5^-219
+    0xE1EBCE4DC7F16DFB, 0xD3E8495912C62894, // 5^-218
+    0x8D3360F09CF6E4BD, 0x64712DD7ABBBD95C, // 5^-217
+    0xB080392CC4349DEC, 0xBD8D794D96AACFB3, // 5^-216
+    0xDCA04777F541C567, 0xECF0D7A0FC5583A0, // 5^-215
+    0x89E42CAAF9491B60, 0xF41686C49DB57244, // 5^-214
+    0xAC5D37D5B79B6239, 0x311C2875C522CED5, // 5^-213
+    0xD77485CB25823AC7, 0x7D633293366B828B, // 5^-212
+    0x86A8D39EF77164BC, 0xAE5DFF9C02033197, // 5^-211
+    0xA8530886B54DBDEB, 0xD9F57F830283FDFC, // 5^-210
+    0xD267CAA862A12D66, 0xD072DF63C324FD7B, // 5^-209
+    0x8380DEA93DA4BC60, 0x4247CB9E59F71E6D, // 5^-208
+    0xA46116538D0DEB78, 0x52D9BE85F074E608, // 5^-207
+    0xCD795BE870516656, 0x67902E276C921F8B, // 5^-206
+    0x806BD9714632DFF6, 0x00BA1CD8A3DB53B6, // 5^-205
+    0xA086CFCD97BF97F3, 0x80E8A40ECCD228A4, // 5^-204
+    0xC8A883C0FDAF7DF0, 0x6122CD128006B2CD, // 5^-203
+    0xFAD2A4B13D1B5D6C, 0x796B805720085F81, // 5^-202
+    0x9CC3A6EEC6311A63, 0xCBE3303674053BB0, // 5^-201
+    0xC3F490AA77BD60FC, 0xBEDBFC4411068A9C, // 5^-200
+    0xF4F1B4D515ACB93B, 0xEE92FB5515482D44, // 5^-199
+    0x991711052D8BF3C5, 0x751BDD152D4D1C4A, // 5^-198
+    0xBF5CD54678EEF0B6, 0xD262D45A78A0635D, // 5^-197
+    0xEF340A98172AACE4, 0x86FB897116C87C34, // 5^-196
+    0x9580869F0E7AAC0E, 0xD45D35E6AE3D4DA0, // 5^-195
+    0xBAE0A846D2195712, 0x8974836059CCA109, // 5^-194
+    0xE998D258869FACD7, 0x2BD1A438703FC94B, // 5^-193
+    0x91FF83775423CC06, 0x7B6306A34627DDCF, // 5^-192
+    0xB67F6455292CBF08, 0x1A3BC84C17B1D542, // 5^-191
+    0xE41F3D6A7377EECA, 0x20CABA5F1D9E4A93, // 5^-190
+    0x8E938662882AF53E, 0x547EB47B7282EE9C, // 5^-189
+    0xB23867FB2A35B28D, 0xE99E619A4F23AA43, // 5^-188
+    0xDEC681F9F4C31F31, 0x6405FA00E2EC94D4, // 5^-187
+    0x8B3C113C38F9F37E, 0xDE83BC408DD3DD04, // 5^-186
+    0xAE0B158B4738705E, 0x9624AB50B148D445, // 5^-185
+    0xD98DDAEE19068C76, 0x3BADD624DD9B0957, // 5^-184
+    0x87F8A8D4CFA417C9, 0xE54CA5D70A80E5D6, // 5^-183
+    0xA9F6D30A038D1DBC, 0x5E9FCF4CCD211F4C, // 5^-182
+    0xD47487CC8470652B, 0x7647C3200069671F, // 5^-181
+    0x84C8D4DFD2C63F3B, 0x29ECD9F40041E073, // 5^-180
+    0xA5FB0A17C777CF09, 0xF468107100525890, // 5^-179
+    0xCF79CC9DB955C2CC, 0x7182148D4066EEB4, // 5^-178
+    0x81AC1FE293D599BF, 0xC6F14CD848405530, // 5^-177
+    0xA21727DB38CB002F, 0xB8ADA00E5A506A7C, // 5^-176
+    0xCA9CF1D206FDC03B, 0xA6D90811F0E4851C, // 5^-175
+    0xFD442E4688BD304A, 0x908F4A166D1DA663, // 5^-174
+    0x9E4A9CEC15763E2E, 0x9A598E4E043287FE, // 5^-173
+    0xC5DD44271AD3CDBA, 0x40EFF1E1853F29FD, // 5^-172
+    0xF7549530E188C128, 0xD12BEE59E68EF47C, // 5^-171
+    0x9A94DD3E8CF578B9, 0x82BB74F8301958CE, // 5^-170
+    0xC13A148E3032D6E7, 0xE36A52363C1FAF01, // 5^-169
+    0xF18899B1BC3F8CA1, 0xDC44E6C3CB279AC1, // 5^-168
+    0x96F5600F15A7B7E5, 0x29AB103A5EF8C0B9, // 5^-167
+    0xBCB2B812DB11A5DE, 0x7415D448F6B6F0E7, // 5^-166
+    0xEBDF661791D60F56, 0x111B495B3464AD21, // 5^-165
+    0x936B9FCEBB25C995, 0xCAB10DD900BEEC34, // 5^-164
+    0xB84687C269EF3BFB, 0x3D5D514F40EEA742, // 5^-163
+    0xE65829B3046B0AFA, 0x0CB4A5A3112A5112, // 5^-162
+    0x8FF71A0FE2C2E6DC, 0x47F0E785EABA72AB, // 5^-161
+    0xB3F4E093DB73A093, 0x59ED216765690F56, // 5^-160
+    0xE0F218B8D25088B8, 0x306869C13EC3532C, // 5^-159
+    0x8C974F7383725573, 0x1E414218C73A13FB, // 5^-158
+    0xAFBD2350644EEACF, 0xE5D1929EF90898FA, // 5^-157
+    0xDBAC6C247D62A583, 0xDF45F746B74ABF39, // 5^-156
+    0x894BC396CE5DA772, 0x6B8BBA8C328EB783, // 5^-155
+    0xAB9EB47C81F5114F, 0x066EA92F3F326564, // 5^-154
+    0xD686619BA27255A2, 0xC80A537B0EFEFEBD, // 5^-153
+    0x8613FD0145877585, 0xBD06742CE95F5F36, // 5^-152
+    0xA798FC4196E952E7, 0x2C48113823B73704, // 5^-151
+    0xD17F3B51FCA3A7A0, 0xF75A15862CA504C5, // 5^-150
+    0x82EF85133DE648C4, 0x9A984D73DBE722FB, // 5^-149
+    0xA3AB66580D5FDAF5, 0xC13E60D0D2E0EBBA, // 5^-148
+    0xCC963FEE10B7D1B3, 0x318DF905079926A8, // 5^-147
+    0xFFBBCFE994E5C61F, 0xFDF17746497F7052, // 5^-146
+    0x9FD561F1FD0F9BD3, 0xFEB6EA8BEDEFA633, // 5^-145
+    0xC7CABA6E7C5382C8, 0xFE64A52EE96B8FC0, // 5^-144
+    0xF9BD690A1B68637B, 0x3DFDCE7AA3C673B0, // 5^-143
+    0x9C1661A651213E2D, 0x06BEA10CA65C084E, // 5^-142
+    0xC31BFA0FE5698DB8, 0x486E494FCFF30A62, // 5^-141
+    0xF3E2F893DEC3F126, 0x5A89DBA3C3EFCCFA, // 5^-140
+    0x986DDB5C6B3A76B7, 0xF89629465A75E01C, // 5^-139
+    0xBE89523386091465, 0xF6BBB397F1135823, // 5^-138
+    0xEE2BA6C0678B597F, 0x746AA07DED582E2C, // 5^-137
+    0x94DB483840B717EF, 0xA8C2A44EB4571CDC, // 5^-136
+    0xBA121A4650E4DDEB, 0x92F34D62616CE413, // 5^-135
+    0xE896A0D7E51E1566, 0x77B020BAF9C81D17, // 5^-134
+    0x915E2486EF32CD60, 0x0ACE1474DC1D122E, // 5^-133
+    0xB5B5ADA8AAFF80B8, 0x0D819992132456BA, // 5^-132
+    0xE3231912D5BF60E6, 0x10E1FFF697ED6C69, // 5^-131
+    0x8DF5EFABC5979C8F, 0xCA8D3FFA1EF463C1, // 5^-130
+    0xB1736B96B6FD83B3, 0xBD308FF8A6B17CB2, // 5^-129
+    0xDDD0467C64BCE4A0, 0xAC7CB3F6D05DDBDE, // 5^-128
+    0x8AA22C0DBEF60EE4, 0x6BCDF07A423AA96B, // 5^-127
+    0xAD4AB7112EB3929D, 0x86C16C98D2C953C6, // 5^-126
+    0xD89D64D57A607744, 0xE871C7BF077BA8B7, // 5^-125
+    0x87625F056C7C4A8B, 0x11471CD764AD4972, // 5^-124
+    0xA93AF6C6C79B5D2D, 0xD598E40D3DD89BCF, // 5^-123
+    0xD389B47879823479, 0x4AFF1D108D4EC2C3, // 5^-122
+    0x843610CB4BF160CB, 0xCEDF722A585139BA, // 5^-121
+    0xA54394FE1EEDB8FE, 0xC2974EB4EE658828, // 5^-120
+    0xCE947A3DA6A9273E, 0x733D226229FEEA32, // 5^-119
+    0x811CCC668829B887, 0x0806357D5A3F525F, // 5^-118
+    0xA163FF802A3426A8, 0xCA07C2DCB0CF26F7, // 5^-117
+    0xC9BCFF6034C13052, 0xFC89B393DD02F0B5, // 5^-116
+    0xFC2C3F3841F17C67, 0xBBAC2078D443ACE2, // 5^-115
+    0x9D9BA7832936EDC0, 0xD54B944B84AA4C0D, // 5^-114
+    0xC5029163F384A931, 0x0A9E795E65D4DF11, // 5^-113
+    0xF64335BCF065D37D, 0x4D4617B5FF4A16D5, // 5^-112
+    0x99EA0196163FA42E, 0x504BCED1BF8E4E45, // 5^-111
+    0xC06481FB9BCF8D39, 0xE45EC2862F71E1D6, // 5^-110
+    0xF07DA27A82C37088, 0x5D767327BB4E5A4C, // 5^-109
+    0x964E858C91BA2655, 0x3A6A07F8D510F86F, // 5^-108
+    0xBBE226EFB628AFEA, 0x890489F70A55368B, // 5^-107
+    0xEADAB0ABA3B2DBE5, 0x2B45AC74CCEA842E, // 5^-106
+    0x92C8AE6B464FC96F, 0x3B0B8BC90012929D, // 5^-105
+    0xB77ADA0617E3BBCB, 0x09CE6EBB40173744, // 5^-104
+    0xE55990879DDCAABD, 0xCC420A6A101D0515, // 5^-103
+    0x8F57FA54C2A9EAB6, 0x9FA946824A12232D, // 5^-102
+    0xB32DF8E9F3546564, 0x47939822DC96ABF9, // 5^-101
+    0xDFF9772470297EBD, 0x59787E2B93BC56F7, // 5^-100
+    0x8BFBEA76C619EF36, 0x57EB4EDB3C55B65A, // 5^-99
+    0xAEFAE51477A06B03, 0xEDE622920B6B23F1, // 5^-98
+    0xDAB99E59958885C4, 0xE95FAB368E45ECED, // 5^-97
+    0x88B402F7FD75539B, 0x11DBCB0218EBB414, // 5^-96
+    0xAAE103B5FCD2A881, 0xD652BDC29F26A119, // 5^-95
+    0xD59944A37C0752A2, 0x4BE76D3346F0495F, // 5^-94
+    0x857FCAE62D8493A5, 0x6F70A4400C562DDB, // 5^-93
+    0xA6DFBD9FB8E5B88E, 0xCB4CCD500F6BB952, // 5^-92
+    0xD097AD07A71F26B2, 0x7E2000A41346A7A7, // 5^-91
+    0x825ECC24C873782F, 0x8ED400668C0C28C8, // 5^-90
+    0xA2F67F2DFA90563B, 0x728900802F0F32FA, // 5^-89
+    0xCBB41EF979346BCA, 0x4F2B40A03AD2FFB9, // 5^-88
+    0xFEA126B7D78186BC, 0xE2F610C84987BFA8, // 5^-87
+    0x9F24B832E6B0F436, 0x0DD9CA7D2DF4D7C9, // 5^-86
+    0xC6EDE63FA05D3143, 0x91503D1C79720DBB, // 5^-85
+    0xF8A95FCF88747D94, 0x75A44C6397CE912A, // 5^-84
+    0x9B69DBE1B548CE7C, 0xC986AFBE3EE11ABA, // 5^-83
+    0xC24452DA229B021B, 0xFBE85BADCE996168, // 5^-82
+    0xF2D56790AB41C2A2, 0xFAE27299423FB9C3, // 5^-81
+    0x97C560BA6B0919A5, 0xDCCD879FC967D41A, // 5^-80
+    0xBDB6B8E905CB600F, 0x5400E987BBC1C920, // 5^-79
+    0xED246723473E3813, 0x290123E9AAB23B68, // 5^-78
+    0x9436C0760C86E30B, 0xF9A0B6720AAF6521, // 5^-77
+    0xB94470938FA89BCE, 0xF808E40E8D5B3E69, // 5^-76
+    0xE7958CB87392C2C2, 0xB60B1D1230B20E04, // 5^-75
+    0x90BD77F3483BB9B9, 0xB1C6F22B5E6F48C2, // 5^-74
+    0xB4ECD5F01A4AA828, 0x1E38AEB6360B1AF3, // 5^-73
+    0xE2280B6C20DD5232, 0x25C6DA63C38DE1B0, // 5^-72
+    0x8D590723948A535F, 0x579C487E5A38AD0E, // 5^-71
+    0xB0AF48EC79ACE837, 0x2D835A9DF0C6D851, // 5^-70
+    0xDCDB1B2798182244, 0xF8E431456CF88E65, // 5^-69
+    0x8A08F0F8BF0F156B, 0x1B8E9ECB641B58FF, // 5^-68
+    0xAC8B2D36EED2DAC5, 0xE272467E3D222F3F, // 5^-67
+    0xD7ADF884AA879177, 0x5B0ED81DCC6ABB0F, // 5^-66
+    0x86CCBB52EA94BAEA, 0x98E947129FC2B4E9, // 5^-65
+    0xA87FEA27A539E9A5, 0x3F2398D747B36224, // 5^-64
+    0xD29FE4B18E88640E, 0x8EEC7F0D19A03AAD, // 5^-63
+    0x83A3EEEEF9153E89, 0x1953CF68300424AC, // 5^-62
+    0xA48CEAAAB75A8E2B, 0x5FA8C3423C052DD7, // 5^-61
+    0xCDB02555653131B6, 0x3792F412CB06794D, // 5^-60
+    0x808E17555F3EBF11, 0xE2BBD88BBEE40BD0, // 5^-59
+    0xA0B19D2AB70E6ED6, 0x5B6ACEAEAE9D0EC4, // 5^-58
+    0xC8DE047564D20A8B, 0xF245825A5A445275, // 5^-57
+    0xFB158592BE068D2E, 0xEED6E2F0F0D56712, // 5^-56
+    0x9CED737BB6C4183D, 0x55464DD69685606B, // 5^-55
+    0xC428D05AA4751E4C, 0xAA97E14C3C26B886, // 5^-54
+    0xF53304714D9265DF, 0xD53DD99F4B3066A8, // 5^-53
+    0x993FE2C6D07B7FAB, 0xE546A8038EFE4029, // 5^-52
+    0xBF8FDB78849A5F96, 0xDE98520472BDD033, // 5^-51
+    0xEF73D256A5C0F77C, 0x963E66858F6D4440, // 5^-50
+    0x95A8637627989AAD, 0xDDE7001379A44AA8, // 5^-49
+    0xBB127C53B17EC159, 0x5560C018580D5D52, // 5^-48
+    0xE9D71B689DDE71AF, 0xAAB8F01E6E10B4A6, // 5^-47
+    0x9226712162AB070D, 0xCAB3961304CA70E8, // 5^-46
+    0xB6B00D69BB55C8D1, 0x3D607B97C5FD0D22, // 5^-45
+    0xE45C10C42A2B3B05, 0x8CB89A7DB77C506A, // 5^-44
+    0x8EB98A7A9A5B04E3, 0x77F3608E92ADB242, // 5^-43
+    0xB267ED1940F1C61C, 0x55F038B237591ED3, // 5^-42
+    0xDF01E85F912E37A3, 0x6B6C46DEC52F6688, // 5^-41
+    0x8B61313BBABCE2C6, 0x2323AC4B3B3DA015, // 5^-40
+    0xAE397D8AA96C1B77, 0xABEC975E0A0D081A, // 5^-39
+    0xD9C7DCED53C72255, 0x96E7BD358C904A21, // 5^-38
+    0x881CEA14545C7575, 0x7E50D64177DA2E54, // 5^-37
+    0xAA242499697392D2, 0xDDE50BD1D5D0B9E9, // 5^-36
+    0xD4AD2DBFC3D07787, 0x955E4EC64B44E864, // 5^-35
+    0x84EC3C97DA624AB4, 0xBD5AF13BEF0B113E, // 5^-34
+    0xA6274BBDD0FADD61, 0xECB1AD8AEACDD58E, // 5^-33
+    0xCFB11EAD453994BA, 0x67DE18EDA5814AF2, // 5^-32
+    0x81CEB32C4B43FCF4, 0x80EACF948770CED7, // 5^-31
+    0xA2425FF75E14FC31, 0xA1258379A94D028D, // 5^-30
+    0xCAD2F7F5359A3B3E, 0x096EE45813A04330, // 5^-29
+    0xFD87B5F28300CA0D, 0x8BCA9D6E188853FC, // 5^-28
+    0x9E74D1B791E07E48, 0x775EA264CF55347E, // 5^-27
+    0xC612062576589DDA, 0x95364AFE032A819E, // 5^-26
+    0xF79687AED3EEC551, 0x3A83DDBD83F52205, // 5^-25
+    0x9ABE14CD44753B52, 0xC4926A9672793543, // 5^-24
+    0xC16D9A0095928A27, 0x75B7053C0F178294, // 5^-23
+    0xF1C90080BAF72CB1, 0x5324C68B12DD6339, // 5^-22
+    0x971DA05074DA7BEE, 0xD3F6FC16EBCA5E04, // 5^-21
+    0xBCE5086492111AEA, 0x88F4BB1CA6BCF585, // 5^-20
+    0xEC1E4A7DB69561A5, 0x2B31E9E3D06C32E6, // 5^-19
+    0x9392EE8E921D5D07, 0x3AFF322E62439FD0, // 5^-18
+    0xB877AA3236A4B449, 0x09BEFEB9FAD487C3, // 5^-17
+    0xE69594BEC44DE15B, 0x4C2EBE687989A9B4, // 5^-16
+    0x901D7CF73AB0ACD9, 0x0F9D37014BF60A11, // 5^-15
+    0xB424DC35095CD80F, 0x538484C19EF38C95, // 5^-14
+    0xE12E13424BB40E13, 0x2865A5F206B06FBA, // 5^-13
+    0x8CBCCC096F5088CB, 0xF93F87B7442E45D4, // 5^-12
+    0xAFEBFF0BCB24AAFE, 0xF78F69A51539D749, // 5^-11
+    0xDBE6FECEBDEDD5BE, 0xB573440E5A884D1C, // 5^-10
+    0x89705F4136B4A597, 0x31680A88F8953031, // 5^-9
+    0xABCC77118461CEFC, 0xFDC20D2B36BA7C3E, // 5^-8
+    0xD6BF94D5E57A42BC, 0x3D32907604691B4D, // 5^-7
+    0x8637BD05AF6C69B5, 0xA63F9A49C2C1B110, // 5^-6
+    0xA7C5AC471B478423, 0x0FCF80DC33721D54, // 5^-5
+    0xD1B71758E219652B, 0xD3C36113404EA4A9, // 5^-4
+    0x83126E978D4FDF3B, 0x645A1CAC083126EA, // 5^-3
+    0xA3D70A3D70A3D70A, 0x3D70A3D70A3D70A4, // 5^-2
+    0xCCCCCCCCCCCCCCCC, 0xCCCCCCCCCCCCCCCD, // 5^-1
+    0x8000000000000000, 0x0000000000000000, // 5^0
+    0xA000000000000000, 0x0000000000000000, // 5^1
+    0xC800000000000000, 0x0000000000000000, // 5^2
+    0xFA00000000000000, 0x0000000000000000, // 5^3
+    0x9C40000000000000, 0x0000000000000000, // 5^4
+    0xC350000000000000, 0x0000000000000000, // 5^5
+    0xF424000000000000, 0x0000000000000000, // 5^6
+    0x9896800000000000, 0x0000000000000000, // 5^7
+    0xBEBC200000000000, 0x0000000000000000, // 5^8
+    0xEE6B280000000000, 0x0000000000000000, // 5^9
+    0x9502F90000000000, 0x0000000000000000, // 5^10
+    0xBA43B74000000000, 0x0000000000000000, // 5^11
+    0xE8D4A51000000000, 0x0000000000000000, // 5^12
+    0x9184E72A00000000, 0x0000000000000000, // 5^13
+    0xB5E620F480000000, 0x0000000000000000, // 5^14
+    0xE35FA931A0000000, 0x0000000000000000, // 5^15
+    0x8E1BC9BF04000000, 0x0000000000000000, // 5^16
+    0xB1A2BC2EC5000000, 0x0000000000000000, // 5^17
+    0xDE0B6B3A76400000, 0x0000000000000000, // 5^18
+    0x8AC7230489E80000, 0x0000000000000000, // 5^19
+    0xAD78EBC5AC620000, 0x0000000000000000, // 5^20
+    0xD8D726B7177A8000, 0x0000000000000000, // 5^21
+    0x878678326EAC9000, 0x0000000000000000, // 5^22
+    0xA968163F0A57B400, 0x0000000000000000, // 5^23
+    0xD3C21BCECCEDA100, 0x0000000000000000, // 5^24
+    0x84595161401484A0, 0x0000000000000000, // 5^25
+    0xA56FA5B99019A5C8, 0x0000000000000000, // 5^26
+    0xCECB8F27F4200F3A, 0x0000000000000000, // 5^27
+    0x813F3978F8940984, 0x4000000000000000, // 5^28
+    0xA18F07D736B90BE5, 0x5000000000000000, // 5^29
+    0xC9F2C9CD04674EDE, 0xA400000000000000, // 5^30
+    0xFC6F7C4045812296, 0x4D00000000000000, // 5^31
+    0x9DC5ADA82B70B59D, 0xF020000000000000, // 5^32
+    0xC5371912364CE305, 0x6C28000000000000, // 5^33
+    0xF684DF56C3E01BC6, 0xC732000000000000, // 5^34
+    0x9A130B963A6C115C, 0x3C7F400000000000, // 5^35
+    0xC097CE7BC90715B3, 0x4B9F100000000000, // 5^36
+    0xF0BDC21ABB48DB20, 0x1E86D40000000000, // 5^37
+    0x96769950B50D88F4, 0x1314448000000000, // 5^38
+    0xBC143FA4E250EB31, 0x17D955A000000000, // 5^39
+    0xEB194F8E1AE525FD, 0x5DCFAB0800000000, // 5^40
+    0x92EFD1B8D0CF37BE, 0x5AA1CAE500000000, // 5^41
+    0xB7ABC627050305AD, 0xF14A3D9E40000000, // 5^42
+    0xE596B7B0C643C719, 0x6D9CCD05D0000000, // 5^43
+    0x8F7E32CE7BEA5C6F, 0xE4820023A2000000, // 5^44
+    0xB35DBF821AE4F38B, 0xDDA2802C8A800000, // 5^45
+    0xE0352F62A19E306E, 0xD50B2037AD200000, // 5^46
+    0x8C213D9DA502DE45, 0x4526F422CC340000, // 5^47
+    0xAF298D050E4395D6, 0x9670B12B7F410000, // 5^48
+    0xDAF3F04651D47B4C, 0x3C0CDD765F114000, // 5^49
+    0x88D8762BF324CD0F, 0xA5880A69FB6AC800, // 5^50
+    0xAB0E93B6EFEE0053, 0x8EEA0D047A457A00, // 5^51
+    0xD5D238A4ABE98068, 0x72A4904598D6D880, // 5^52
+    0x85A36366EB71F041, 0x47A6DA2B7F864750, // 5^53
+    0xA70C3C40A64E6C51, 0x999090B65F67D924, // 5^54
+    0xD0CF4B50CFE20765, 0xFFF4B4E3F741CF6D, // 5^55
+    0x82818F1281ED449F, 0xBFF8F10E7A8921A4, // 5^56
+    0xA321F2D7226895C7, 0xAFF72D52192B6A0D, // 5^57
+    0xCBEA6F8CEB02BB39, 0x9BF4F8A69F764490, // 5^58
+    0xFEE50B7025C36A08, 0x02F236D04753D5B4, // 5^59
+    0x9F4F2726179A2245, 0x01D762422C946590, // 5^60
+    0xC722F0EF9D80AAD6, 0x424D3AD2B7B97EF5, // 5^61
+    0xF8EBAD2B84E0D58B, 0xD2E0898765A7DEB2, // 5^62
+    0x9B934C3B330C8577, 0x63CC55F49F88EB2F, // 5^63
+    0xC2781F49FFCFA6D5, 0x3CBF6B71C76B25FB, // 5^64
+    0xF316271C7FC3908A, 0x8BEF464E3945EF7A, // 5^65
+    0x97EDD871CFDA3A56, 0x97758BF0E3CBB5AC, // 5^66
+    0xBDE94E8E43D0C8EC, 0x3D52EEED1CBEA317, // 5^67
+    0xED63A231D4C4FB27, 0x4CA7AAA863EE4BDD, // 5^68
+    0x945E455F24FB1CF8, 0x8FE8CAA93E74EF6A, // 5^69
+    0xB975D6B6EE39E436, 0xB3E2FD538E122B44, // 5^70
+    0xE7D34C64A9C85D44, 0x60DBBCA87196B616, // 5^71
+    0x90E40FBEEA1D3A4A, 0xBC8955E946FE31CD, // 5^72
+    0xB51D13AEA4A488DD, 0x6BABAB6398BDBE41, // 5^73
+    0xE264589A4DCDAB14, 0xC696963C7EED2DD1, // 5^74
+    0x8D7EB76070A08AEC, 0xFC1E1DE5CF543CA2, // 5^75
+    0xB0DE65388CC8ADA8, 0x3B25A55F43294BCB, // 5^76
+    0xDD15FE86AFFAD912, 0x49EF0EB713F39EBE, // 5^77
+    0x8A2DBF142DFCC7AB, 0x6E3569326C784337, // 5^78
+    0xACB92ED9397BF996, 0x49C2C37F07965404, // 5^79
+    0xD7E77A8F87DAF7FB, 0xDC33745EC97BE906, // 5^80
+    0x86F0AC99B4E8DAFD, 0x69A028BB3DED71A3, // 5^81
+    0xA8ACD7C0222311BC, 0xC40832EA0D68CE0C, // 5^82
+    0xD2D80DB02AABD62B, 0xF50A3FA490C30190, // 5^83
+    0x83C7088E1AAB65DB, 0x792667C6DA79E0FA, // 5^84
+    0xA4B8CAB1A1563F52, 0x577001B891185938, // 5^85
+    0xCDE6FD5E09ABCF26, 0xED4C0226B55E6F86, // 5^86
+    0x80B05E5AC60B6178, 0x544F8158315B05B4, // 5^87
+    0xA0DC75F1778E39D6, 0x696361AE3DB1C721, // 5^88
+    0xC913936DD571C84C, 0x03BC3A19CD1E38E9, // 5^89
+    0xFB5878494ACE3A5F, 0x04AB48A04065C723, // 5^90
+    0x9D174B2DCEC0E47B, 0x62EB0D64283F9C76, // 5^91
+    0xC45D1DF942711D9A, 0x3BA5D0BD324F8394, // 5^92
+    0xF5746577930D6500, 0xCA8F44EC7EE36479, // 5^93
+    0x9968BF6ABBE85F20, 0x7E998B13CF4E1ECB, // 5^94
+    0xBFC2EF456AE276E8, 0x9E3FEDD8C321A67E, // 5^95
+    0xEFB3AB16C59B14A2, 0xC5CFE94EF3EA101E, // 5^96
+    0x95D04AEE3B80ECE5, 0xBBA1F1D158724A12, // 5^97
+    0xBB445DA9CA61281F, 0x2A8A6E45AE8EDC97, // 5^98
+    0xEA1575143CF97226, 0xF52D09D71A3293BD, // 5^99
+    0x924D692CA61BE758, 0x593C2626705F9C56, // 5^100
+    0xB6E0C377CFA2E12E, 0x6F8B2FB00C77836C, // 5^101
+    0xE498F455C38B997A, 0x0B6DFB9C0F956447, // 5^102
+    0x8EDF98B59A373FEC, 0x4724BD4189BD5EAC, // 5^103
+    0xB2977EE300C50FE7, 0x58EDEC91EC2CB657, // 5^104
+    0xDF3D5E9BC0F653E1, 0x2F2967B66737E3ED, // 5^105
+    0x8B865B215899F46C, 0xBD79E0D20082EE74, // 5^106
+    0xAE67F1E9AEC07187, 0xECD8590680A3AA11, // 5^107
+    0xDA01EE641A708DE9, 0xE80E6F4820CC9495, // 5^108
+    0x884134FE908658B2, 0x3109058D147FDCDD, // 5^109
+    0xAA51823E34A7EEDE, 0xBD4B46F0599FD415, // 5^110
+    0xD4E5E2CDC1D1EA96, 0x6C9E18AC7007C91A, // 5^111
+    0x850FADC09923329E, 0x03E2CF6BC604DDB0, // 5^112
+    0xA6539930BF6BFF45, 0x84DB8346B786151C, // 5^113
+    0xCFE87F7CEF46FF16, 0xE612641865679A63, // 5^114
+    0x81F14FAE158C5F6E, 0x4FCB7E8F3F60C07E, // 5^115
+    0xA26DA3999AEF7749, 0xE3BE5E330F38F09D, // 5^116
+    0xCB090C8001AB551C, 0x5CADF5BFD3072CC5, // 5^117
+    0xFDCB4FA002162A63, 0x73D9732FC7C8F7F6, // 5^118
+    0x9E9F11C4014DDA7E, 0x2867E7FDDCDD9AFA, // 5^119
+    0xC646D63501A1511D, 0xB281E1FD541501B8, // 5^120
+    0xF7D88BC24209A565, 0x1F225A7CA91A4226, // 5^121
+    0x9AE757596946075F, 0x3375788DE9B06958, // 5^122
+    0xC1A12D2FC3978937, 0x0052D6B1641C83AE, // 5^123
+    0xF209787BB47D6B84, 0xC0678C5DBD23A49A, // 5^124
+    0x9745EB4D50CE6332, 0xF840B7BA963646E0, // 5^125
+    0xBD176620A501FBFF, 0xB650E5A93BC3D898, // 5^126
+    0xEC5D3FA8CE427AFF, 0xA3E51F138AB4CEBE, // 5^127
+    0x93BA47C980E98CDF, 0xC66F336C36B10137, // 5^128
+    0xB8A8D9BBE123F017, 0xB80B0047445D4184, // 5^129
+    0xE6D3102AD96CEC1D, 0xA60DC059157491E5, // 5^130
+    0x9043EA1AC7E41392, 0x87C89837AD68DB2F, // 5^131
+    0xB454E4A179DD1877, 0x29BABE4598C311FB, // 5^132
+    0xE16A1DC9D8545E94, 0xF4296DD6FEF3D67A, // 5^133
+    0x8CE2529E2734BB1D, 0x1899E4A65F58660C, // 5^134
+    0xB01AE745B101E9E4, 0x5EC05DCFF72E7F8F, // 5^135
+    0xDC21A1171D42645D, 0x76707543F4FA1F73, // 5^136
+    0x899504AE72497EBA, 0x6A06494A791C53A8, // 5^137
+    0xABFA45DA0EDBDE69, 0x0487DB9D17636892, // 5^138
+    0xD6F8D7509292D603, 0x45A9D2845D3C42B6, // 5^139
+    0x865B86925B9BC5C2, 0x0B8A2392BA45A9B2, // 5^140
+    0xA7F26836F282B732, 0x8E6CAC7768D7141E, // 5^141
+    0xD1EF0244AF2364FF, 0x3207D795430CD926, // 5^142
+    0x8335616AED761F1F, 0x7F44E6BD49E807B8, // 5^143
+    0xA402B9C5A8D3A6E7, 0x5F16206C9C6209A6, // 5^144
+    0xCD036837130890A1, 0x36DBA887C37A8C0F, // 5^145
+    0x802221226BE55A64, 0xC2494954DA2C9789, // 5^146
+    0xA02AA96B06DEB0FD, 0xF2DB9BAA10B7BD6C, // 5^147
+    0xC83553C5C8965D3D, 0x6F92829494E5ACC7, // 5^148
+    0xFA42A8B73ABBF48C, 0xCB772339BA1F17F9, // 5^149
+    0x9C69A97284B578D7, 0xFF2A760414536EFB, // 5^150
+    0xC38413CF25E2D70D, 0xFEF5138519684ABA, // 5^151
+    0xF46518C2EF5B8CD1, 0x7EB258665FC25D69, // 5^152
+    0x98BF2F79D5993802, 0xEF2F773FFBD97A61, // 5^153
+    0xBEEEFB584AFF8603, 0xAAFB550FFACFD8FA, // 5^154
+    0xEEAABA2E5DBF6784, 0x95BA2A53F983CF38, // 5^155
+    0x952AB45CFA97A0B2, 0xDD945A747BF26183, // 5^156
+    0xBA756174393D88DF, 0x94F971119AEEF9E4, // 5^157
+    0xE912B9D1478CEB17, 0x7A37CD5601AAB85D, // 5^158
+    0x91ABB422CCB812EE, 0xAC62E055C10AB33A, // 5^159
+    0xB616A12B7FE617AA, 0x577B986B314D6009, // 5^160
+    0xE39C49765FDF9D94, 0xED5A7E85FDA0B80B, // 5^161
+    0x8E41ADE9FBEBC27D, 0x14588F13BE847307, // 5^162
+    0xB1D219647AE6B31C, 0x596EB2D8AE258FC8, // 5^163
+    0xDE469FBD99A05FE3, 0x6FCA5F8ED9AEF3BB, // 5^164
+    0x8AEC23D680043BEE, 0x25DE7BB9480D5854, // 5^165
+    0xADA72CCC20054AE9, 0xAF561AA79A10AE6A, // 5^166
+    0xD910F7FF28069DA4, 0x1B2BA1518094DA04, // 5^167
+    0x87AA9AFF79042286, 0x90FB44D2F05D0842, // 5^168
+    0xA99541BF57452B28, 0x353A1607AC744A53, // 5^169
+    0xD3FA922F2D1675F2, 0x42889B8997915CE8, // 5^170
+    0x847C9B5D7C2E09B7, 0x69956135FEBADA11, // 5^171
+    0xA59BC234DB398C25, 0x43FAB9837E699095, // 5^172
+    0xCF02B2C21207EF2E, 0x94F967E45E03F4BB, // 5^173
+    0x8161AFB94B44F57D, 0x1D1BE0EEBAC278F5, // 5^174
+    0xA1BA1BA79E1632DC, 0x6462D92A69731732, // 5^175
+    0xCA28A291859BBF93, 0x7D7B8F7503CFDCFE, // 5^176
+    0xFCB2CB35E702AF78, 0x5CDA735244C3D43E, // 5^177
+    0x9DEFBF01B061ADAB, 0x3A0888136AFA64A7, // 5^178
+    0xC56BAEC21C7A1916, 0x088AAA1845B8FDD0, // 5^179
+    0xF6C69A72A3989F5B, 0x8AAD549E57273D45, // 5^180
+    0x9A3C2087A63F6399, 0x36AC54E2F678864B, // 5^181
+    0xC0CB28A98FCF3C7F, 0x84576A1BB416A7DD, // 5^182
+    0xF0FDF2D3F3C30B9F, 0x656D44A2A11C51D5, // 5^183
+    0x969EB7C47859E743, 0x9F644AE5A4B1B325, // 5^184
+    0xBC4665B596706114, 0x873D5D9F0DDE1FEE, // 5^185
+    0xEB57FF22FC0C7959, 0xA90CB506D155A7EA, // 5^186
+    0x9316FF75DD87CBD8, 0x09A7F12442D588F2, // 5^187
+    0xB7DCBF5354E9BECE, 0x0C11ED6D538AEB2F, // 5^188
+    0xE5D3EF282A242E81, 0x8F1668C8A86DA5FA, // 5^189
+    0x8FA475791A569D10, 0xF96E017D694487BC, // 5^190
+    0xB38D92D760EC4455, 0x37C981DCC395A9AC, // 5^191
+    0xE070F78D3927556A, 0x85BBE253F47B1417, // 5^192
+    0x8C469AB843B89562, 0x93956D7478CCEC8E, // 5^193
+    0xAF58416654A6BABB, 0x387AC8D1970027B2, // 5^194
+    0xDB2E51BFE9D0696A, 0x06997B05FCC0319E, // 5^195
+    0x88FCF317F22241E2, 0x441FECE3BDF81F03, // 5^196
+    0xAB3C2FDDEEAAD25A, 0xD527E81CAD7626C3, // 5^197
+    0xD60B3BD56A5586F1, 0x8A71E223D8D3B074, // 5^198
+    0x85C7056562757456, 0xF6872D5667844E49, // 5^199
+    0xA738C6BEBB12D16C, 0xB428F8AC016561DB, // 5^200
+    0xD106F86E69D785C7, 0xE13336D701BEBA52, // 5^201
+    0x82A45B450226B39C, 0xECC0024661173473, // 5^202
+    0xA34D721642B06084, 0x27F002D7F95D0190, // 5^203
+    0xCC20CE9BD35C78A5, 0x31EC038DF7B441F4, // 5^204
+    0xFF290242C83396CE, 0x7E67047175A15271, // 5^205
+    0x9F79A169BD203E41, 0x0F0062C6E984D386, // 5^206
+    0xC75809C42C684DD1, 0x52C07B78A3E60868, // 5^207
+    0xF92E0C3537826145, 0xA7709A56CCDF8A82, // 5^208
+    0x9BBCC7A142B17CCB, 0x88A66076400BB691, // 5^209
+    0xC2ABF989935DDBFE, 0x6ACFF893D00EA435, // 5^210
+    0xF356F7EBF83552FE, 0x0583F6B8C4124D43, // 5^211
+    0x98165AF37B2153DE, 0xC3727A337A8B704A, // 5^212
+    0xBE1BF1B059E9A8D6, 0x744F18C0592E4C5C, // 5^213
+    0xEDA2EE1C7064130C, 0x1162DEF06F79DF73, // 5^214
+    0x9485D4D1C63E8BE7, 0x8ADDCB5645AC2BA8, // 5^215
+    0xB9A74A0637CE2EE1, 0x6D953E2BD7173692, // 5^216
+    0xE8111C87C5C1BA99, 0xC8FA8DB6CCDD0437, // 5^217
+    0x910AB1D4DB9914A0, 0x1D9C9892400A22A2, // 5^218
+    0xB54D5E4A127F59C8, 0x2503BEB6D00CAB4B, // 5^219
+    0xE2A0B5DC971F303A, 0x2E44AE64840FD61D, // 5^220
+    0x8DA471A9DE737E24, 0x5CEAECFED289E5D2, // 5^221
+    0xB10D8E1456105DAD, 0x7425A83E872C5F47, // 5^222
+    0xDD50F1996B947518, 0xD12F124E28F77719, // 5^223
+    0x8A5296FFE33CC92F, 0x82BD6B70D99AAA6F, // 5^224
+    0xACE73CBFDC0BFB7B, 0x636CC64D1001550B, // 5^225
+    0xD8210BEFD30EFA5A, 0x3C47F7E05401AA4E, // 5^226
+    0x8714A775E3E95C78, 0x65ACFAEC34810A71, // 5^227
+    0xA8D9D1535CE3B396, 0x7F1839A741A14D0D, // 5^228
+    0xD31045A8341CA07C, 0x1EDE48111209A050, // 5^229
+    0x83EA2B892091E44D, 0x934AED0AAB460432, // 5^230
+    0xA4E4B66B68B65D60, 0xF81DA84D5617853F, // 5^231
+    0xCE1DE40642E3F4B9, 0x36251260AB9D668E, // 5^232
+    0x80D2AE83E9CE78F3, 0xC1D72B7C6B426019, // 5^233
+    0xA1075A24E4421730, 0xB24CF65B8612F81F, // 5^234
+    0xC94930AE1D529CFC, 0xDEE033F26797B627, // 5^235
+    0xFB9B7CD9A4A7443C, 0x169840EF017DA3B1, // 5^236
+    0x9D412E0806E88AA5, 0x8E1F289560EE864E, // 5^237
+    0xC491798A08A2AD4E, 0xF1A6F2BAB92A27E2, // 5^238
+    0xF5B5D7EC8ACB58A2, 0xAE10AF696774B1DB, // 5^239
+    0x9991A6F3D6BF1765, 0xACCA6DA1E0A8EF29, // 5^240
+    0xBFF610B0CC6EDD3F, 0x17FD090A58D32AF3, // 5^241
+    0xEFF394DCFF8A948E, 0xDDFC4B4CEF07F5B0, // 5^242
+    0x95F83D0A1FB69CD9, 0x4ABDAF101564F98E, // 5^243
+    0xBB764C4CA7A4440F, 0x9D6D1AD41ABE37F1, // 5^244
+    0xEA53DF5FD18D5513, 0x84C86189216DC5ED, // 5^245
+    0x92746B9BE2F8552C, 0x32FD3CF5B4E49BB4, // 5^246
+    0xB7118682DBB66A77, 0x3FBC8C33221DC2A1, // 5^247
+    0xE4D5E82392A40515, 0x0FABAF3FEAA5334A, // 5^248
+    0x8F05B1163BA6832D, 0x29CB4D87F2A7400E, // 5^249
+    0xB2C71D5BCA9023F8, 0x743E20E9EF511012, // 5^250
+    0xDF78E4B2BD342CF6, 0x914DA9246B255416, // 5^251
+    0x8BAB8EEFB6409C1A, 0x1AD089B6C2F7548E, // 5^252
+    0xAE9672ABA3D0C320, 0xA184AC2473B529B1, // 5^253
+    0xDA3C0F568CC4F3E8, 0xC9E5D72D90A2741E, // 5^254
+    0x8865899617FB1871, 0x7E2FA67C7A658892, // 5^255
+    0xAA7EEBFB9DF9DE8D, 0xDDBB901B98FEEAB7, // 5^256
+    0xD51EA6FA85785631, 0x552A74227F3EA565, // 5^257
+    0x8533285C936B35DE, 0xD53A88958F87275F, // 5^258
+    0xA67FF273B8460356, 0x8A892ABAF368F137, // 5^259
+    0xD01FEF10A657842C, 0x2D2B7569B0432D85, // 5^260
+    0x8213F56A67F6B29B, 0x9C3B29620E29FC73, // 5^261
+    0xA298F2C501F45F42, 0x8349F3BA91B47B8F, // 5^262
+    0xCB3F2F7642717713, 0x241C70A936219A73, // 5^263
+    0xFE0EFB53D30DD4D7, 0xED238CD383AA0110, // 5^264
+    0x9EC95D1463E8A506, 0xF4363804324A40AA, // 5^265
+    0xC67BB4597CE2CE48, 0xB143C6053EDCD0D5, // 5^266
+    0xF81AA16FDC1B81DA, 0xDD94B7868E94050A, // 5^267
+    0x9B10A4E5E9913128, 0xCA7CF2B4191C8326, // 5^268
+    0xC1D4CE1F63F57D72, 0xFD1C2F611F63A3F0, // 5^269
+    0xF24A01A73CF2DCCF, 0xBC633B39673C8CEC, // 5^270
+    0x976E41088617CA01, 0xD5BE0503E085D813, // 5^271
+    0xBD49D14AA79DBC82, 0x4B2D8644D8A74E18, // 5^272
+    0xEC9C459D51852BA2, 0xDDF8E7D60ED1219E, // 5^273
+    0x93E1AB8252F33B45, 0xCABB90E5C942B503, // 5^274
+    0xB8DA1662E7B00A17, 0x3D6A751F3B936243, // 5^275
+    0xE7109BFBA19C0C9D, 0x0CC512670A783AD4, // 5^276
+    0x906A617D450187E2, 0x27FB2B80668B24C5, // 5^277
+    0xB484F9DC9641E9DA, 0xB1F9F660802DEDF6, // 5^278
+    0xE1A63853BBD26451, 0x5E7873F8A0396973, // 5^279
+    0x8D07E33455637EB2, 0xDB0B487B6423E1E8, // 5^280
+    0xB049DC016ABC5E5F, 0x91CE1A9A3D2CDA62, // 5^281
+    0xDC5C5301C56B75F7, 0x7641A140CC7810FB, // 5^282
+    0x89B9B3E11B6329BA, 0xA9E904C87FCB0A9D, // 5^283
+    0xAC2820D9623BF429, 0x546345FA9FBDCD44, // 5^284
+    0xD732290FBACAF133, 0xA97C177947AD4095, // 5^285
+    0x867F59A9D4BED6C0, 0x49ED8EABCCCC485D, // 5^286
+    0xA81F301449EE8C70, 0x5C68F256BFFF5A74, // 5^287
+    0xD226FC195C6A2F8C, 0x73832EEC6FFF3111, // 5^288
+    0x83585D8FD9C25DB7, 0xC831FD53C5FF7EAB, // 5^289
+    0xA42E74F3D032F525, 0xBA3E7CA8B77F5E55, // 5^290
+    0xCD3A1230C43FB26F, 0x28CE1BD2E55F35EB, // 5^291
+    0x80444B5E7AA7CF85, 0x7980D163CF5B81B3, // 5^292
+    0xA0555E361951C366, 0xD7E105BCC332621F, // 5^293
+    0xC86AB5C39FA63440, 0x8DD9472BF3FEFAA7, // 5^294
+    0xFA856334878FC150, 0xB14F98F6F0FEB951, // 5^295
+    0x9C935E00D4B9D8D2, 0x6ED1BF9A569F33D3, // 5^296
+    0xC3B8358109E84F07, 0x0A862F80EC4700C8, // 5^297
+    0xF4A642E14C6262C8, 0xCD27BB612758C0FA, // 5^298
+    0x98E7E9CCCFBD7DBD, 0x8038D51CB897789C, // 5^299
+    0xBF21E44003ACDD2C, 0xE0470A63E6BD56C3, // 5^300
+    0xEEEA5D5004981478, 0x1858CCFCE06CAC74, // 5^301
+    0x95527A5202DF0CCB, 0x0F37801E0C43EBC8, // 5^302
+    0xBAA718E68396CFFD, 0xD30560258F54E6BA, // 5^303
+    0xE950DF20247C83FD, 0x47C6B82EF32A2069, // 5^304
+    0x91D28B7416CDD27E, 0x4CDC331D57FA5441, // 5^305
+    0xB6472E511C81471D, 0xE0133FE4ADF8E952, // 5^306
+    0xE3D8F9E563A198E5, 0x58180FDDD97723A6, // 5^307
+    0x8E679C2F5E44FF8F, 0x570F09EAA7EA7648, // 5^308
+};
+
+// Ryu float formatting tables ("Ryu: Fast Float-to-String Conversion", Adams 2018), stored as { low 64 bits, high 64
+// bits } pairs. POW5_INV_SPLIT[q] is 2^(bit length of 5^q - 1 + POW5_INV_BIT_COUNT) / 5^q rounded up, and POW5_SPLIT[q]
+// is 5^q truncated to POW5_BIT_COUNT bits. Used by shortest float formatting in format.h.
+constexpr sint32 POW5_INV_BIT_COUNT = 125;
+constexpr sint32 POW5_BIT_COUNT     = 125;
+
+constexpr uint64 POW5_INV_SPLIT[][2] = {
+    { 0x0000000000000001, 0x2000000000000000 }, // 5^-0
+    { 0x999999999999999A, 0x1999999999999999 }, // 5^-1
+    { 0x47AE147AE147AE15, 0x147AE147AE147AE1 }, // 5^-2
+    { 0x6C8B4395810624DE, 0x10624DD2F1A9FBE7 }, // 5^-3
+    { 0x7A786C226809D496, 0x1A36E2EB1C432CA5 }, // 5^-4
+    { 0x61F9F01B866E43AB, 0x14F8B588E368F084 }, // 5^-5
+    { 0xB4C7F34938583622, 0x10C6F7A0B5ED8D36 }, // 5^-6
+    { 0x87A6520EC08D236A, 0x1AD7F29ABCAF4857 }, // 5^-7
+    { 0x9FB841A566D74F88, 0x15798EE2308C39DF }, // 5^-8
+    { 0xE62D01511F12A607, 0x112E0BE826D694B2 }, // 5^-9
+    { 0xD6AE6881CB5109A4, 0x1B7CDFD9D7BDBAB7 }, // 5^-10
+    { 0xDEF1ED34A2A73AEA, 0x15FD7FE17964955F }, // 5^-11
+    { 0x7F27F0F6E885C8BB, 0x119799812DEA1119 }, // 5^-12
+    { 0x650CB4BE40D60DF8, 0x1C25C268497681C2 }, // 5^-13
+    { 0xEA70909833DE7193, 0x16849B86A12B9B01 }, // 5^-14
+    { 0x21F3A6E0297EC143, 0x1203AF9EE756159B }, // 5^-15
+    { 0x6985D7CD0F313537, 0x1CD2B297D889BC2B }, // 5^-16
+    { 0x2137DFD73F5A90F9, 0x170EF54646D49689 }, // 5^-17
+    { 0xE75FE645CC4873FA, 0x12725DD1D243ABA0 }, // 5^-18
+    { 0xA5663D3C7A0D865D, 0x1D83C94FB6D2AC34 }, // 5^-19
+    { 0x511E976394D79EB1, 0x179CA10C9242235D }, // 5^-20
+    { 0xDA7EDF82DD794BC1, 0x12E3B40A0E9B4F7D }, // 5^-21
+    { 0x2A6498D1625BAC68, 0x1E392010175EE596 }, // 5^-22
+    { 0xEEB6E0A781E2F053, 0x182DB34012B25144 }, // 5^-23
+    { 0x58924D52CE4F26A9, 0x1357C299A88EA76A }, // 5^-24
+    { 0x27507BB7B07EA441, 0x1EF2D0F5DA7DD8AA }, // 5^-25
+    { 0x52A6C95FC0655034, 0x18C240C4AECB13BB }, // 5^-26
+    { 0x0EEBD44C99EAA690, 0x13CE9A36F23C0FC9 }, // 5^-27
+    { 0xB17953ADC3110A80, 0x1FB0F6BE50601941 }, // 5^-28
+    { 0xC12DDC8B02740867, 0x195A5EFEA6B34767 }, // 5^-29
+    { 0x3424B06F3529A052, 0x14484BFEEBC29F86 }, // 5^-30
+    { 0x901D59F290EE19DB, 0x1039D66589687F9E }, // 5^-31
+    { 0x4CFBC31DB4B0295F, 0x19F623D5A8A73297 }, // 5^-32
+    { 0x3D9635B15D59BAB2, 0x14C4E977BA1F5BAC }, // 5^-33
+    { 0x97AB5E277DE16228, 0x109D8792FB4C4956 }, // 5^-34
+    { 0xF2ABC9D8C9689D0D, 0x1A95A5B7F87A0EF0 }, // 5^-35
+    { 0x5BBCA17A3ABA173E, 0x154484932D2E725A }, // 5^-36
+    { 0xAFCA1AC82EFB45CB, 0x11039D428A8B8EAE }, // 5^-37
+    { 0xB2DCF7A6B1920945, 0x1B38FB9DAA78E44A }, // 5^-38
+    { 0xF57D92EBC141A104, 0x15C72FB1552D836E }, // 5^-39
+    { 0xC46475896767B403, 0x116C262777579C58 }, // 5^-40
+    { 0x6D6D88DBD8A5ECD2, 0x1BE03D0BF225C6F4 }, // 5^-41
+    { 0x8ABE071646EB23DB, 0x164CFDA3281E38C3 }, // 5^-42
+    { 0x6EFE6C11D255B649, 0x11D7314F534B609C }, // 5^-43
+    { 0xB197134FB6EF8A0E, 0x1C8B821885456760 }, // 5^-44
+    { 0x27AC0F72F8BFA1A5, 0x16D601AD376AB91A }, // 5^-45
+    { 0xB95672C260994E1E, 0x1244CE242C5560E1 }, // 5^-46
+    { 0xF5571E03CDC21695, 0x1D3AE36D13BBCE35 }, // 5^-47
+    { 0x2AAC18030B01ABAB, 0x17624F8A762FD82B }, // 5^-48
+    { 0xBBBCE0026F348956, 0x12B50C6EC4F31355 }, // 5^-49
+    { 0x92C7CCD0B1EDA889, 0x1DEE7A4AD4B81EEF }, // 5^-50
+    { 0xDBD30A408E57BA07, 0x17F1FB6F10934BF2 }, // 5^-51
+    { 0x7CA8D50071DFC806, 0x1327FC58DA0F6FF5 }, // 5^-52
+    { 0xFAA7BB33E9660CD6, 0x1EA6608E29B24CBB }, // 5^-53
+    { 0x9552FC298784D711, 0x18851A0B548EA3C9 }, // 5^-54
+    { 0xAAA8C9BAD2D0AC0E, 0x139DAE6F76D88307 }, // 5^-55
+    { 0xDDDADC5E1E1AACE3, 0x1F62B0B257C0D1A5 }, // 5^-56
+    { 0x7E48B04B4B488A4F, 0x191BC08EAC9A4151 }, // 5^-57
+    { 0xCB6D59D5D5D3A1D9, 0x141633A556E1CDDA }, // 5^-58
+    { 0x3C577B1177DC817B, 0x1011C2EAABE7D7E2 }, // 5^-59
+    { 0xC6F25E825960CF2A, 0x19B604AAACA62636 }, // 5^-60
+    { 0x6BF518684780A5BB, 0x14919D5556EB51C5 }, // 5^-61
+    { 0x232A79ED06008496, 0x10747DDDDF22A7D1 }, // 5^-62
+    { 0xD1DD8FE1A3340756, 0x1A53FC9631D10C81 }, // 5^-63
+    { 0xA7E4731AE8F66C45, 0x150FFD44F4A73D34 }, // 5^-64
+    { 0x531D28E253F8569E, 0x10D9976A5D52975D }, // 5^-65
+    { 0xEB61DB03B98D5762, 0x1AF5BF109550F22E }, // 5^-66
+    { 0xBC4E48CFC7A445E8, 0x159165A6DDDA5B58 }, // 5^-67
+    { 0x6371D3D96C836B20, 0x11411E1F17E1E2AD }, // 5^-68
+    { 0x9F1C8628AD9F11CD, 0x1B9B6364F3030448 }, // 5^-69
+    { 0xE5B06B53BE18DB0B, 0x1615E91D8F359D06 }, // 5^-70
+    { 0xEAF3890FCB4715A2, 0x11AB20E472914A6B }, // 5^-71
+    { 0x44B8DB4C7871BC37, 0x1C45016D841BAA46 }, // 5^-72
+    { 0x03C715D6C6C1635F, 0x169D9ABE03495505 }, // 5^-73
+    { 0x3638DE456BCDE919, 0x1217AEFE69077737 }, // 5^-74
+    { 0x56C163A2461641C1, 0x1CF2B1970E725858 }, // 5^-75
+    { 0xDF011C81D1AB67CE, 0x17288E1271F51379 }, // 5^-76
+    { 0x7F3416CE4155ECA5, 0x1286D80EC190DC61 }, // 5^-77
+    { 0x6520247D3556476E, 0x1DA48CE468E7C702 }, // 5^-78
+    { 0xEA801D30F7783925, 0x17B6D71D20B96C01 }, // 5^-79
+    { 0xBB99B0F3F92CFA84, 0x12F8AC174D612334 }, // 5^-80
+    { 0x5F5C4E532847F739, 0x1E5AACF215683854 }, // 5^-81
+    { 0x7F7D0B75B9D32C2E, 0x18488A5B44536043 }, // 5^-82
+    { 0x9930D5F7C7DC2358, 0x136D3B7C36A919CF }, // 5^-83
+    { 0x8EB4898C72F9D226, 0x1F152BF9F10E8FB2 }, // 5^-84
+    { 0x722A07A38F2E41B8, 0x18DDBCC7F40BA628 }, // 5^-85
+    { 0xC1BB394FA5BE9AFA, 0x13E497065CD61E86 }, // 5^-86
+    { 0x9C5EC2190930F7F6, 0x1FD424D6FAF030D7 }, // 5^-87
+    { 0x49E56814075A5FF8, 0x197683DF2F268D79 }, // 5^-88
+    { 0x6E51201005E1E660, 0x145ECFE5BF520AC7 }, // 5^-89
+    { 0xF1DA800CD181851A, 0x104BD984990E6F05 }, // 5^-90
+    { 0x4FC400148268D4F5, 0x1A12F5A0F4E3E4D6 }, // 5^-91
+    { 0xD96999AA01ED772B, 0x14DBF7B3F71CB711 }, // 5^-92
+    { 0xADEE1488018AC5BC, 0x10AFF95CC5B09274 }, // 5^-93
+    { 0x497CEDA668DE092C, 0x1AB328946F80EA54 }, // 5^-94
+    { 0x3ACA57B853E4D424, 0x155C2076BF9A5510 }, // 5^-95
+    { 0x623B7960431D7683, 0x1116805EFFAEAA73 }, // 5^-96
+    { 0x9D2BF566D1C8BD9E, 0x1B5733CB32B110B8 }, // 5^-97
+    { 0x7DBCC452416D647F, 0x15DF5CA28EF40D60 }, // 5^-98
+    { 0xCAFD69DB678AB6CC, 0x117F7D4ED8C33DE6 }, // 5^-99
+    { 0xAB2F0FC572778ADF, 0x1BFF2EE48E052FD7 }, // 5^-100
+    { 0x88F273045B92D580, 0x1665BF1D3E6A8CAC }, // 5^-101
+    { 0xD3F528D049424466, 0x11EAFF4A98553D56 }, // 5^-102
+    { 0xB988414D4203A0A3, 0x1CAB3210F3BB9557 }, // 5^-103
+    { 0x6139CDD76802E6E9, 0x16EF5B40C2FC7779 }, // 5^-104
+    { 0xE761717920025254, 0x125915CD68C9F92D }, // 5^-105
+    { 0xA568B58E999D5086, 0x1D5B561574765B7C }, // 5^-106
+    { 0x5120913EE14AA6D2, 0x177C44DDF6C515FD }, // 5^-107
+    { 0xA74D40FF1AA21F0E, 0x12C9D0B1923744CA }, // 5^-108
+    { 0x0BAECE64F769CB4A, 0x1E0FB44F50586E11 }, // 5^-109
+    { 0x3C8BD850C5EE3C3B, 0x180C903F7379F1A7 }, // 5^-110
+    { 0xCA0979DA37F1C9C9, 0x133D4032C2C7F485 }, // 5^-111
+    { 0xA9A8C2F6BFE942DB, 0x1EC866B79E0CBA6F }, // 5^-112
+    { 0x2153CF2BCCBA9BE3, 0x18A0522C7E709526 }, // 5^-113
+    { 0x1AA9728970954982, 0x13B374F06526DDB8 }, // 5^-114
+    { 0xF775840F1A88759D, 0x1F8587E7083E2F8C }, // 5^-115
+    { 0x5F9136727BA05E17, 0x19379FEC0698260A }, // 5^-116
+    { 0x1940F85B9619E4DF, 0x142C7FF0054684D5 }, // 5^-117
+    { 0xE100C6AFAB47EA4C, 0x1023998CD1053710 }, // 5^-118
+    { 0xCE67A44C453FDD47, 0x19D28F47B4D524E7 }, // 5^-119
+    { 0xD852E9D69DCCB106, 0x14A8729FC3DDB71F }, // 5^-120
+    { 0x79DBEE454B0A2738, 0x1086C219697E2C19 }, // 5^-121
+    { 0x295FE3A211A9D859, 0x1A71368F0F30468F }, // 5^-122
+    { 0xBAB31C81A7BB137A, 0x15275ED8D8F36BA5 }, // 5^-123
+    { 0x6228E39AEC95A92F, 0x10EC4BE0AD8F8951 }, // 5^-124
+    { 0x9D0E38F7E0EF7517, 0x1B13AC9AAF4C0EE8 }, // 5^-125
+    { 0xB0D82D931A592A79, 0x15A956E225D67253 }, // 5^-126
+    { 0x8D79BE0F4847552E, 0x11544581B7DEC1DC }, // 5^-127
+    { 0x158F967EDA0BBB7C, 0x1BBA08CF8C979C94 }, // 5^-128
+    { 0x77A611FF14D62F97, 0x162E6D72D6DFB076 }, // 5^-129
+    { 0xF951A7FF43DE8C79, 0x11BEBDF578B2F391 }, // 5^-130
+    { 0xC21C3FFED2FDAD8E, 0x1C6463225AB7EC1C }, // 5^-131
+    { 0x01B0333242648AD8, 0x16B6B5B5155FF017 }, // 5^-132
+    { 0x0159C28E9B83A246, 0x122BC490DDE659AC }, // 5^-133
+    { 0xCEF604175F3903A3, 0x1D12D41AFCA3C2AC }, // 5^-134
+    { 0x725E69AC4C2D9C83, 0x17424348CA1C9BBD }, // 5^-135
+    { 0xF5185489D68AE39C, 0x129B69070816E2FD }, // 5^-136
+    { 0xEE8D540FBDAB05C6, 0x1DC574D80CF16B2F }, // 5^-137
+    { 0xBED77672FE226B05, 0x17D12A4670C1228C }, // 5^-138
+    { 0xFF12C528CB4EBC04, 0x130DBB6B8D674ED6 }, // 5^-139
+    { 0xCB513B74787DF9A0, 0x1E7C5F127BD87E24 }, // 5^-140
+    { 0x090DC929F9FE614D, 0x18637F41FCAD31B7 }, // 5^-141
+    { 0xA0D7D42194CB810A, 0x1382CC34CA2427C5 }, // 5^-142
+    { 0x67BFB9CF5478CE77, 0x1F37AD21436D0C6F }, // 5^-143
+    { 0x1FCC94A5DD2D71F9, 0x18F9574DCF8A7059 }, // 5^-144
+    { 0x7FD6DD517DBDF4C7, 0x13FAAC3E3FA1F37A }, // 5^-145
+    { 0xFFBE2EE8C92FEE0B, 0x1FF779FD329CB8C3 }, // 5^-146
+    { 0x6631BF20A0F324D6, 0x1992C7FDC216FA36 }, // 5^-147
+    { 0xB827CC1A1A5C1D78, 0x14756CCB01ABFB5E }, // 5^-148
+    { 0x935309AE7B7CE460, 0x105DF0A267BCC918 }, // 5^-149
+    { 0x1EEB42B0C594A099, 0x1A2FE76A3F9474F4 }, // 5^-150
+    { 0xE58902270476E6E1, 0x14F31F8832DD2A5C }, // 5^-151
+    { 0xB7A0CE859D2BEBE7, 0x10C27FA028B0EEB0 }, // 5^-152
+    { 0x59014A6F61DFDFD8, 0x1AD0CC33744E4AB4 }, // 5^-153
+    { 0xE0CDD525E7E64CAD, 0x1573D68F903EA229 }, // 5^-154
+    { 0x4D7177518651D6F1, 0x11297872D9CBB4EE }, // 5^-155
+    { 0x7BE8BEE8D6E957E8, 0x1B758D848FAC54B0 }, // 5^-156
+    { 0xFCBA3253DF211320, 0x15F7A46A0C89DD59 }, // 5^-157
+    { 0x63C8284318E74280, 0x1192E9EE706E4AAE }, // 5^-158
+    { 0x060D0D3827D86A66, 0x1C1E43171A4A1117 }, // 5^-159
+    { 0x6B3DA42CECAD21EB, 0x167E9C127B6E7412 }, // 5^-160
+    { 0x88FE1CF0BD574E56, 0x11FEE341FC585CDB }, // 5^-161
+    { 0x419694B462254A23, 0x1CCB0536608D615F }, // 5^-162
+    { 0x67ABAA29E81DD4E9, 0x1708D0F84D3DE77F }, // 5^-163
+    { 0xB95621BB2017DD87, 0x126D73F9D764B932 }, // 5^-164
+    { 0xC223692B668C95A5, 0x1D7BECC2F23AC1EA }, // 5^-165
+    { 0xCE82BA891ED6DE1D, 0x179657025B6234BB }, // 5^-166
+    { 0xA53562074BDF1818, 0x12DEAC01E2B4F6FC }, // 5^-167
+    { 0x3B889CD87964F359, 0x1E3113363787F194 }, // 5^-168
+    { 0xFC6D4A46C783F5E1, 0x18274291C6065ADC }, // 5^-169
+    { 0x30576E9F06032B1A, 0x13529BA7D19EAF17 }, // 5^-170
+    { 0x1A257DCB3CD1DE90, 0x1EEA92A61C311825 }, // 5^-171
+    { 0x481DFE3C30A7E540, 0x18BBA884E35A79B7 }, // 5^-172
+    { 0xD34B31C9C0865100, 0x13C9539D82AEC7C5 }, // 5^-173
+    { 0x5211E942CDA3B4CD, 0x1FA885C8D117A609 }, // 5^-174
+    { 0x74DB21023E1C90A4, 0x19539E3A40DFB807 }, // 5^-175
+    { 0xF715B401CB4A0D50, 0x1442E4FB67196005 }, // 5^-176
+    { 0xF8DE299B09080AA7, 0x103583FC527AB337 }, // 5^-177
+    { 0x8E304291A80CDDD7, 0x19EF3993B72AB859 }, // 5^-178
+    { 0x3E8D020E200A4B13, 0x14BF6142F8EEF9E1 }, // 5^-179
+    { 0x653D9B3E80083C0F, 0x10991A9BFA58C7E7 }, // 5^-180
+    { 0x6EC8F864000D2CE4, 0x1A8E90F9908E0CA5 }, // 5^-181
+    { 0x8BD3F9E999A423EA, 0x153EDA614071A3B7 }, // 5^-182
+    { 0x3CA994BAE1501CBB, 0x10FF151A99F482F9 }, // 5^-183
+    { 0xC775BAC49BB3612B, 0x1B31BB5DC320D18E }, // 5^-184
+    { 0xD2C4956A16291A89, 0x15C162B168E70E0B }, // 5^-185
+    { 0xDBD0778811BA7BA1, 0x11678227871F3E6F }, // 5^-186
+    { 0x2C80BF401C5D929B, 0x1BD8D03F3E9863E6 }, // 5^-187
+    { 0xBD33CC3349E47549, 0x16470CFF6546B651 }, // 5^-188
+    { 0xCA8FD68F6E505DD4, 0x11D270CC51055EA7 }, // 5^-189
+    { 0x4419574BE3B3C953, 0x1C83E7AD4E6EFDD9 }, // 5^-190
+    { 0x0347790982F63AA9, 0x16CFEC8AA52597E1 }, // 5^-191
+    { 0xCF6C60D468C4FBBA, 0x123FF06EEA847980 }, // 5^-192
+    { 0xE57A34870E07F92A, 0x1D331A4B10D3F59A }, // 5^-193
+    { 0x512E906C0B399422, 0x175C1508DA432AE2 }, // 5^-194
+    { 0xDA8BA6BCD5C7A9B5, 0x12B010D3E1CF5581 }, // 5^-195
+    { 0x90DF712E22D90F87, 0x1DE6815302E5559C }, // 5^-196
+    { 0xDA4C5A8B4F140C6C, 0x17EB9AA8CF1DDE16 }, // 5^-197
+    { 0xAEA37BA2A5A9A38A, 0x1322E220A5B17E78 }, // 5^-198
+    { 0x7DD25F6AA2A905A9, 0x1E9E369AA2B59727 }, // 5^-199
+    { 0x97DB7F888220D154, 0x187E92154EF7AC1F }, // 5^-200
+    { 0x797C6606CE80A777, 0x139874DDD8C6234C }, // 5^-201
+    { 0x8F2D700AE4010BF1, 0x1F5A549627A36BAD }, // 5^-202
+    { 0x0C2459A25000D65A, 0x191510781FB5EFBE }, // 5^-203
+    { 0x701D1481D99A4515, 0x1410D9F9B2F7F2FE }, // 5^-204
+    { 0xC017439B147B6A77, 0x100D7B2E28C65BFE }, // 5^-205
+    { 0xCCF205C4ED9243F2, 0x19AF2B7D0E0A2CCA }, // 5^-206
+    { 0x0A5B37D0BE0E9CC2, 0x148C22CA71A1BD6F }, // 5^-207
+    { 0x0848F973CB3EE3CE, 0x10701BD527B4978C }, // 5^-208
+    { 0xDA0E5BEC78649FB0, 0x1A4CF9550C5425AC }, // 5^-209
+    { 0x7B3EAFF060507FC0, 0x150A6110D6A9B7BD }, // 5^-210
+    { 0x95CBBFF380406633, 0x10D51A73DEEE2C97 }, // 5^-211
+    { 0xEFAC665266CD7052, 0x1AEE90B964B04758 }, // 5^-212
+    { 0x2623850EB8A459DB, 0x158BA6FAB6F36C47 }, // 5^-213
+    { 0x1E82D0D893B6AE49, 0x113C85955F29236C }, // 5^-214
+    { 0xFD9E1AF41F8AB075, 0x1B9408EEFEA838AC }, // 5^-215
+    { 0x97B1AF29B2D559F7, 0x16100725988693BD }, // 5^-216
+    { 0xAC8E25BAF5777B2C, 0x11A66C1E139EDC97 }, // 5^-217
+    { 0x7A7D092B2258C513, 0x1C3D79C9B8FE2DBF }, // 5^-218
+    { 0x61FDA0EF4EAD6A76, 0x169794A160CB57CC }, // 5^-219
+    { 0xE7FE1A590BBDEEC5, 0x1212DD4DE7091309 }, // 5^-220
+    { 0xA6635D5B45FCB13A, 0x1CEAFBAFD80E84DC }, // 5^-221
+    { 0x851C4AAF6B308DC8, 0x172262F3133ED0B0 }, // 5^-222
+    { 0xD0E36EF2BC26D7D4, 0x1281E8C275CBDA26 }, // 5^-223
+    { 0xB49F17EAC6A48C86, 0x1D9CA79D894629D7 }, // 5^-224
+    { 0x2A18DFEF0550706B, 0x17B08617A104EE46 }, // 5^-225
+    { 0x54E0B3259DD9F389, 0x12F39E794D9D8B6B }, // 5^-226
+    { 0x87CDEB6F62F65274, 0x1E5297287C2F4578 }, // 5^-227
+    { 0xD30B22BF825EA85D, 0x18421286C9BF6AC6 }, // 5^-228
+    { 0x0F3C1BCC684BB9E4, 0x13680ED23AFF889F }, // 5^-229
+    { 0x18602C7A4079296D, 0x1F0CE4839198DA98 }, // 5^-230
+    { 0x46B356C833942124, 0x18D71D360E13E213 }, // 5^-231
+    { 0x388F78A029434DB6, 0x13DF4A91A4DCB4DC }, // 5^-232
+    { 0x5A7F2766A86BAF8A, 0x1FCBAA82A1612160 }, // 5^-233
+    { 0x153285EBB9EFBFA2, 0x196FBB9BB44DB44D }, // 5^-234
+    { 0xAA8ED189618C994E, 0x145962E2F6A4903D }, // 5^-235
+    { 0xEED8A7A11AD6E10C, 0x1047824F2BB6D9CA }, // 5^-236
+    { 0x7E27729B5E249B45, 0x1A0C03B1DF8AF611 }, // 5^-237
+    { 0xFE85F549181D4904, 0x14D6695B193BF80D }, // 5^-238
+    { 0xCB9E5DD4134AA0D0, 0x10AB877C142FF9A4 }, // 5^-239
+    { 0xDF63C9535211014D, 0x1AAC0BF9B9E65C3A }, // 5^-240
+    { 0x191CA10F74DA6771, 0x15566FFAFB1EB02F }, // 5^-241
+    { 0xADB080D92A4852C1, 0x1111F32F2F4BC025 }, // 5^-242
+    { 0x15E7348EAA0D5134, 0x1B4FEB7EB212CD09 }, // 5^-243
+    { 0xAB1F5D3EEE710DC4, 0x15D98932280F0A6D }, // 5^-244
+    { 0xBC1917658B8DA49D, 0x117AD428200C0857 }, // 5^-245
+    { 0x2CF4F23C127C3A94, 0x1BF7B9D9CCE00D59 }, // 5^-246
+    { 0xF0C3F4FCDB969543, 0x165FC7E170B33DE0 }, // 5^-247
+    { 0x5A365D9716121103, 0x11E6398126F5CB1A }, // 5^-248
+    { 0x9056FC24F01CE804, 0x1CA38F350B22DE90 }, // 5^-249
+    { 0xD9DF301D8CE3ECD0, 0x16E93F5DA2824BA6 }, // 5^-250
+    { 0xE17F59B13D8323DA, 0x125432B14ECEA2EB }, // 5^-251
+    { 0x68CBC2B52F38395C, 0x1D53844EE47DD179 }, // 5^-252
+    { 0x53D6355DBF602DE3, 0x177603725064A794 }, // 5^-253
+    { 0xA9782AB165E68B1C, 0x12C4CF8EA6B6EC76 }, // 5^-254
+    { 0x0F26AAB56FD744FA, 0x1E07B27DD78B13F1 }, // 5^-255
+    { 0x3F52222ABFDF6A62, 0x18062864AC6F4327 }, // 5^-256
+    { 0x65DB4E88997F884E, 0x1338205089F29C1F }, // 5^-257
+    { 0x6FC54A7428CC0D4A, 0x1EC033B40FEA9365 }, // 5^-258
+    { 0x596AA1F68709A43B, 0x1899C2F673220F84 }, // 5^-259
+    { 0xADEEE7F86C07B696, 0x13AE3591F5B4D936 }, // 5^-260
+    { 0x497E3FF3E00C5756, 0x1F7D228322BAF524 }, // 5^-261
+    { 0xD464FFF64CD6AC45, 0x1930E868E89590E9 }, // 5^-262
+    { 0x4383FFF83D7889D1, 0x14272053ED4473EE }, // 5^-263
+    { 0xCF9CCCC69793A174, 0x101F4D0FF1038FF1 }, // 5^-264
+    { 0x7F6147A425B90252, 0x19CBAE7FE805B31C }, // 5^-265
+    { 0xCC4DD2E9B7C7350F, 0x14A2F1FFECD15C16 }, // 5^-266
+    { 0x3D0B0F215FD290D9, 0x10825B3323DAB012 }, // 5^-267
+    { 0x61AB4B689950E7C1, 0x1A6A2B85062AB350 }, // 5^-268
+    { 0x4E22A2BA1440B967, 0x1521BC6A6B555C40 }, // 5^-269
+    { 0x0B4EE894DD009453, 0x10E7C9EEBC4449CD }, // 5^-270
+    { 0x1217DA87C800ED51, 0x1B0C764AC6D3A948 }, // 5^-271
+    { 0xDB46486CA000BDDA, 0x15A391D56BDC876C }, // 5^-272
+    { 0x490506BD4CCD64AF, 0x114FA7DDEFE39F8A }, // 5^-273
+    { 0xA8080AC87AE23AB1, 0x1BB2A62FE638FF43 }, // 5^-274
+    { 0x5339A239FBE82EF4, 0x162884F31E93FF69 }, // 5^-275
+    { 0x75C7B4FB2FECF25D, 0x11BA03F5B20FFF87 }, // 5^-276
+    { 0x22D92191E647EA2E, 0x1C5CD322B67FFF3F }, // 5^-277
+    { 0xB57A8141850654F2, 0x16B0A8E891FFFF65 }, // 5^-278
+    { 0xC4620101373843F5, 0x1226ED86DB3332B7 }, // 5^-279
+    { 0x3A366801F1F39FEE, 0x1D0B15A491EB8459 }, // 5^-280
+    { 0xFB5EB99B27F6198B, 0x173C115074BC69E0 }, // 5^-281
+    { 0x2F7EFAE2865E7AD6, 0x129674405D6387E7 }, // 5^-282
+    { 0xE597F7D0D6FD9156, 0x1DBD86CD6238D971 }, // 5^-283
+    { 0x8479930D78CADAAB, 0x17CAD23DE82D7AC1 }, // 5^-284
+    { 0xD06142712D6F1556, 0x1308A831868AC89A }, // 5^-285
+    { 0x4D686A4EAF182222, 0x1E74404F3DAADA91 }, // 5^-286
+    { 0xA453883EF279B4E8, 0x185D003F6488AEDA }, // 5^-287
+    { 0xE9DC6CFF28615D87, 0x137D99CC506D58AE }, // 5^-288
+    { 0xA960AE650D6895A4, 0x1F2F5C7A1A488DE4 }, // 5^-289
+    { 0xBAB3BEB73DED4483, 0x18F2B061AEA07183 }, // 5^-290
+    { 0x2EF6322C318A9D36, 0x13F559E7BEE6C136 }, // 5^-291
+    { 0xE4BD1D13827761F0, 0x1FEEF63F97D79B89 }, // 5^-292
+    { 0x83CA7DA9352C4E5A, 0x198BF832DFDFAFA1 }, // 5^-293
+    { 0x9CA1FE20F756A515, 0x146FF9C24CB2F2E7 }, // 5^-294
+    { 0x4A1B31B3F9121DAA, 0x1059949B708F28B9 }, // 5^-295
+    { 0x435EB5ECC1B695DD, 0x1A28EDC580E50DF5 }, // 5^-296
+    { 0x35E55E57015EDE4A, 0x14ED8B04671DA4C4 }, // 5^-297
+    { 0xC4B77EAC0118B1D5, 0x10BE08D0527E1D69 }, // 5^-298
+    { 0xA12597799B5AB622, 0x1AC9A7B3B7302F0F }, // 5^-299
+    { 0x4DB7AC6149155E81, 0x156E1FC2F8F358D9 }, // 5^-300
+    { 0xD7C6238107444B9B, 0x1124E63593F5E0AD }, // 5^-301
+    { 0x593D059B3ED3AC2B, 0x1B6E3D2286563449 }, // 5^-302
+    { 0xE0FD9E15CBDC89BC, 0x15F1CA820511C36D }, // 5^-303
+    { 0xB3FE18116FE3A163, 0x118E3B9B37416924 }, // 5^-304
+    { 0x866359B57FD29BD1, 0x1C16C5C525357507 }, // 5^-305
+    { 0xD1E91491330EE30E, 0x16789E3750F790D2 }, // 5^-306
+    { 0x74BA76DA8F3F1C0B, 0x11FA182C40C60D75 }, // 5^-307
+    { 0xEDF72490E531C678, 0x1CC359E067A348BB }, // 5^-308
+    { 0x8B2C1D40B75B052D, 0x1702AE4D1FB5D3C9 }, // 5^-309
+    { 0x6F567DCD5F7C0424, 0x12688B70E62B0FD4 }, // 5^-310
+    { 0x7EF0C94898C66D06, 0x1D74124E3D11B2ED }, // 5^-311
+    { 0x98C0A106E09EBD9F, 0x17900EA4FDA7C257 }, // 5^-312
+    { 0x470080D24D4BCAE6, 0x12D9A550CAEC9B79 }, // 5^-313
+    { 0xD800CE1D487944A2, 0x1E29088144ADC58E }, // 5^-314
+    { 0x1333D8176D2DD082, 0x1820D39A9D57D13F }, // 5^-315
+    { 0xA8F646792424A6CE, 0x134D76154AACA765 }, // 5^-316
+    { 0x74BD3D8EA03AA47D, 0x1EE25688777AA56F }, // 5^-317
+    { 0x5D64313EE6955064, 0x18B51206C5FBB78C }, // 5^-318
+    { 0x4AB68DCBEBAAA6B7, 0x13C40E6BD1962C70 }, // 5^-319
+    { 0x1124161312AAA457, 0x1FA01712E8F0471A }, // 5^-320
+    { 0xDA8344DC0EEEE9DF, 0x194CDF4253F36C14 }, // 5^-321
+    { 0xE2029D7CD8BF2180, 0x143D7F6843292343 }, // 5^-322
+    { 0x4E687DFD7A328133, 0x103132B9CF541C36 }, // 5^-323
+    { 0x4A40C9959050CEB8, 0x19E851294BB9C6BD }, // 5^-324
+    { 0x0833D477A6A70BC6, 0x14B9DA876FC7D231 }, // 5^-325
+    { 0xA02976C61EEC096B, 0x1094AED2BFD30E8D }, // 5^-326
+    { 0x004257A364ACDBDF, 0x1A877E1DFFB81749 }, // 5^-327
+    { 0xCD01DFB5EA23E319, 0x153931B1996012A0 }, // 5^-328
+    { 0x70CE4C91881CB5AE, 0x10FA8E27ADE6754D }, // 5^-329
+    { 0x1AE3ADB5A69455E2, 0x1B2A7D0C4970BBAF }, // 5^-330
+    { 0x7BE957C4854377E8, 0x15BB973D078D62F2 }, // 5^-331
+    { 0xC987796A0435F987, 0x1162DF64060AB58E }, // 5^-332
+    { 0x75A58F1006BCC271, 0x1BD1656CD67788E4 }, // 5^-333
+    { 0xF7B7A5A66BCA3527, 0x16411DF0AB92D3E9 }, // 5^-334
+    { 0x5FC61E1EBCA1C41F, 0x11CDB18D560F0FEE }, // 5^-335
+    { 0xFFA363646102D365, 0x1C7C4F4889B1B316 }, // 5^-336
+    { 0x32E91C504D9BDC51, 0x16C9D906D48E28DF }, // 5^-337
+    { 0x8F20E37371497D0E, 0x123B140576D820B2 }, // 5^-338
+    { 0x7E9B0585820F2E7C, 0x1D2B533BF159CDEA }, // 5^-339
+    { 0xCBAF379E01A5BECA, 0x1755DC2FF447D7EE }, // 5^-340
+    { 0x0958F94B348498A1, 0x12AB168CC36CACBF }, // 5^-341
+};
+
+constexpr uint64 POW5_SPLIT[][2] = {
+    { 0x0000000000000000, 0x1000000000000000 }, // 5^0
+    { 0x0000000000000000, 0x1400000000000000 }, // 5^1
+    { 0x0000000000000000, 0x1900000000000000 }, // 5^2
+    { 0x0000000000000000, 0x1F40000000000000 }, // 5^3
+    { 0x0000000000000000, 0x1388000000000000 }, // 5^4
+    { 0x0000000000000000, 0x186A000000000000 }, // 5^5
+    { 0x0000000000000000, 0x1E84800000000000 }, // 5^6
+    { 0x0000000000000000, 0x1312D00000000000 }, // 5^7
+    { 0x0000000000000000, 0x17D7840000000000 }, // 5^8
+    { 0x0000000000000000, 0x1DCD650000000000 }, // 5^9
+    { 0x0000000000000000, 0x12A05F2000000000 }, // 5^10
+    { 0x0000000000000000, 0x174876E800000000 }, // 5^11
+    { 0x0000000000000000, 0x1D1A94A200000000 }, // 5^12
+    { 0x0000000000000000, 0x12309CE540000000 }, // 5^13
+    { 0x0000000000000000, 0x16BCC41E90000000 }, // 5^14
+    { 0x0000000000000000, 0x1C6BF52634000000 }, // 5^15
+    { 0x0000000000000000, 0x11C37937E0800000 }, // 5^16
+    { 0x0000000000000000, 0x16345785D8A00000 }, // 5^17
+    { 0x0000000000000000, 0x1BC16D674EC80000 }, // 5^18
+    { 0x0000000000000000, 0x1158E460913D0000 }, // 5^19
+    { 0x0000000000000000, 0x15AF1D78B58C4000 }, // 5^20
+    { 0x0000000000000000, 0x1B1AE4D6E2EF5000 }, // 5^21
+    { 0x0000000000000000, 0x10F0CF064DD59200 }, // 5^22
+    { 0x0000000000000000, 0x152D02C7E14AF680 }, // 5^23
+    { 0x0000000000000000, 0x1A784379D99DB420 }, // 5^24
+    { 0x0000000000000000, 0x108B2A2C28029094 }, // 5^25
+    { 0x0000000000000000, 0x14ADF4B7320334B9 }, // 5^26
+    { 0x4000000000000000, 0x19D971E4FE8401E7 }, // 5^27
+    { 0x8800000000000000, 0x1027E72F1F128130 }, // 5^28
+    { 0xAA00000000000000, 0x1431E0FAE6D7217C }, // 5^29
+    { 0xD480000000000000, 0x193E5939A08CE9DB }, // 5^30
+    { 0xC9A0000000000000, 0x1F8DEF8808B02452 }, // 5^31
+    { 0xBE04000000000000, 0x13B8B5B5056E16B3 }, // 5^32
+    { 0xAD85000000000000, 0x18A6E32246C99C60 }, // 5^33
+    { 0xD8E6400000000000, 0x1ED09BEAD87C0378 }, // 5^34
+    { 0x878FE80000000000, 0x13426172C74D822B }, // 5^35
+    { 0x6973E20000000000, 0x1812F9CF7920E2B6 }, // 5^36
+    { 0x03D0DA8000000000, 0x1E17B84357691B64 }, // 5^37
+    { 0x8262889000000000, 0x12CED32A16A1B11E }, // 5^38
+    { 0x22FB2AB400000000, 0x178287F49C4A1D66 }, // 5^39
+    { 0xABB9F56100000000, 0x1D6329F1C35CA4BF }, // 5^40
+    { 0xCB54395CA0000000, 0x125DFA371A19E6F7 }, // 5^41
+    { 0xBE2947B3C8000000, 0x16F578C4E0A060B5 }, // 5^42
+    { 0x2DB399A0BA000000, 0x1CB2D6F618C878E3 }, // 5^43
+    { 0xFC90400474400000, 0x11EFC659CF7D4B8D }, // 5^44
+    { 0x7BB4500591500000, 0x166BB7F0435C9E71 }, // 5^45
+    { 0xDAA16406F5A40000, 0x1C06A5EC5433C60D }, // 5^46
+    { 0xA8A4DE8459868000, 0x118427B3B4A05BC8 }, // 5^47
+    { 0xD2CE16256FE82000, 0x15E531A0A1C872BA }, // 5^48
+    { 0x87819BAECBE22800, 0x1B5E7E08CA3A8F69 }, // 5^49
+    { 0xF4B1014D3F6D5900, 0x111B0EC57E6499A1 }, // 5^50
+    { 0x71DD41A08F48AF40, 0x1561D276DDFDC00A }, // 5^51
+    { 0x0E549208B31ADB10, 0x1ABA4714957D300D }, // 5^52
+    { 0x28F4DB456FF0C8EA, 0x10B46C6CDD6E3E08 }, // 5^53
+    { 0x33321216CBECFB24, 0x14E1878814C9CD8A }, // 5^54
+    { 0xBFFE969C7EE839ED, 0x1A19E96A19FC40EC }, // 5^55
+    { 0xF7FF1E21CF512434, 0x105031E2503DA893 }, // 5^56
+    { 0xF5FEE5AA43256D41, 0x14643E5AE44D12B8 }, // 5^57
+    { 0x337E9F14D3EEC892, 0x197D4DF19D605767 }, // 5^58
+    { 0x005E46DA08EA7AB6, 0x1FDCA16E04B86D41 }, // 5^59
+    { 0xA03AEC4845928CB2, 0x13E9E4E4C2F34448 }, // 5^60
+    { 0xC849A75A56F72FDE, 0x18E45E1DF3B0155A }, // 5^61
+    { 0x7A5C1130ECB4FBD6, 0x1F1D75A5709C1AB1 }, // 5^62
+    { 0xEC798ABE93F11D65, 0x13726987666190AE }, // 5^63
+    { 0xA797ED6E38ED64BF, 0x184F03E93FF9F4DA }, // 5^64
+    { 0x517DE8C9C728BDEF, 0x1E62C4E38FF87211 }, // 5^65
+    { 0xD2EEB17E1C7976B5, 0x12FDBB0E39FB474A }, // 5^66
+    { 0x87AA5DDDA397D462, 0x17BD29D1C87A191D }, // 5^67
+    { 0xE994F5550C7DC97B, 0x1DAC74463A989F64 }, // 5^68
+    { 0x11FD195527CE9DED, 0x128BC8ABE49F639F }, // 5^69
+    { 0xD67C5FAA71C24568, 0x172EBAD6DDC73C86 }, // 5^70
+    { 0x8C1B77950E32D6C2, 0x1CFA698C95390BA8 }, // 5^71
+    { 0x57912ABD28DFC639, 0x121C81F7DD43A749 }, // 5^72
+    { 0xAD75756C7317B7C8, 0x16A3A275D494911B }, // 5^73
+    { 0x98D2D2C78FDDA5BA, 0x1C4C8B1349B9B562 }, // 5^74
+    { 0x9F83C3BCB9EA8794, 0x11AFD6EC0E14115D }, // 5^75
+    { 0x0764B4ABE8652979, 0x161BCCA7119915B5 }, // 5^76
+    { 0x493DE1D6E27E73D7, 0x1BA2BFD0D5FF5B22 }, // 5^77
+    { 0x6DC6AD264D8F0866, 0x1145B7E285BF98F5 }, // 5^78
+    { 0xC938586FE0F2CA80, 0x159725DB272F7F32 }, // 5^79
+    { 0x7B866E8BD92F7D20, 0x1AFCEF51F0FB5EFF }, // 5^80
+    { 0xAD34051767BDAE34, 0x10DE1593369D1B5F }, // 5^81
+    { 0x9881065D41AD19C1, 0x15159AF804446237 }, // 5^82
+    { 0x7EA147F492186032, 0x1A5B01B605557AC5 }, // 5^83
+    { 0x6F24CCF8DB4F3C1F, 0x1078E111C3556CBB }, // 5^84
+    { 0x4AEE003712230B27, 0x14971956342AC7EA }, // 5^85
+    { 0xDDA98044D6ABCDF0, 0x19BCDFABC13579E4 }, // 5^86
+    { 0x0A89F02B062B60B6, 0x10160BCB58C16C2F }, // 5^87
+    { 0xCD2C6C35C7B638E4, 0x141B8EBE2EF1C73A }, // 5^88
+    { 0x8077874339A3C71D, 0x1922726DBAAE3909 }, // 5^89
+    { 0xE0956914080CB8E4, 0x1F6B0F092959C74B }, // 5^90
+    { 0x6C5D61AC8507F38E, 0x13A2E965B9D81C8F }, // 5^91
+    { 0x4774BA17A649F072, 0x188BA3BF284E23B3 }, // 5^92
+    { 0x1951E89D8FDC6C8F, 0x1EAE8CAEF261ACA0 }, // 5^93
+    { 0x0FD3316279E9C3D9, 0x132D17ED577D0BE4 }, // 5^94
+    { 0x13C7FDBB186434CF, 0x17F85DE8AD5C4EDD }, // 5^95
+    { 0x58B9FD29DE7D4203, 0x1DF67562D8B36294 }, // 5^96
+    { 0xB7743E3A2B0E4942, 0x12BA095DC7701D9C }, // 5^97
+    { 0xE5514DC8B5D1DB92, 0x17688BB5394C2503 }, // 5^98
+    { 0xDEA5A13AE3465277, 0x1D42AEA2879F2E44 }, // 5^99
+    { 0x0B2784C4CE0BF38A, 0x1249AD2594C37CEB }, // 5^100
+    { 0xCDF165F6018EF06D, 0x16DC186EF9F45C25 }, // 5^101
+    { 0x416DBF7381F2AC88, 0x1C931E8AB871732F }, // 5^102
+    { 0x88E497A83137ABD5, 0x11DBF316B346E7FD }, // 5^103
+    { 0xEB1DBD923D8596CA, 0x1652EFDC6018A1FC }, // 5^104
+    { 0x25E52CF6CCE6FC7D, 0x1BE7ABD3781ECA7C }, // 5^105
+    { 0x97AF3C1A40105DCE, 0x1170CB642B133E8D }, // 5^106
+    { 0xFD9B0B20D0147542, 0x15CCFE3D35D80E30 }, // 5^107
+    { 0x3D01CDE904199292, 0x1B403DCC834E11BD }, // 5^108
+    { 0x462120B1A28FFB9B, 0x1108269FD210CB16 }, // 5^109
+    { 0xD7A968DE0B33FA82, 0x154A3047C694FDDB }, // 5^110
+    { 0xCD93C3158E00F923, 0x1A9CBC59B83A3D52 }, // 5^111
+    { 0xC07C59ED78C09BB6, 0x10A1F5B813246653 }, // 5^112
+    { 0xB09B7068D6F0C2A3, 0x14CA732617ED7FE8 }, // 5^113
+    { 0xDCC24C830CACF34C, 0x19FD0FEF9DE8DFE2 }, // 5^114
+    { 0xC9F96FD1E7EC180F, 0x103E29F5C2B18BED }, // 5^115
+    { 0x3C77CBC661E71E13, 0x144DB473335DEEE9 }, // 5^116
+    { 0x8B95BEB7FA60E598, 0x1961219000356AA3 }, // 5^117
+    { 0x6E7B2E65F8F91EFE, 0x1FB969F40042C54C }, // 5^118
+    { 0xC50CFCFFBB9BB35F, 0x13D3E2388029BB4F }, // 5^119
+    { 0xB6503C3FAA82A037, 0x18C8DAC6A0342A23 }, // 5^120
+    { 0xA3E44B4F95234844, 0x1EFB1178484134AC }, // 5^121
+    { 0xE66EAF11BD360D2B, 0x135CEAEB2D28C0EB }, // 5^122
+    { 0xE00A5AD62C839075, 0x183425A5F872F126 }, // 5^123
+    { 0x980CF18BB7A47493, 0x1E412F0F768FAD70 }, // 5^124
+    { 0x5F0816F752C6C8DC, 0x12E8BD69AA19CC66 }, // 5^125
+    { 0xF6CA1CB527787B13, 0x17A2ECC414A03F7F }, // 5^126
+    { 0xF47CA3E2715699D7, 0x1D8BA7F519C84F5F }, // 5^127
+    { 0xF8CDE66D86D62026, 0x127748F9301D319B }, // 5^128
+    { 0xF7016008E88BA830, 0x17151B377C247E02 }, // 5^129
+    { 0xB4C1B80B22AE923C, 0x1CDA62055B2D9D83 }, // 5^130
+    { 0x50F91306F5AD1B65, 0x12087D4358FC8272 }, // 5^131
+    { 0xE53757C8B318623F, 0x168A9C942F3BA30E }, // 5^132
+    { 0x9E852DBADFDE7ACF, 0x1C2D43B93B0A8BD2 }, // 5^133
+    { 0xA3133C94CBEB0CC1, 0x119C4A53C4E69763 }, // 5^134
+    { 0x8BD80BB9FEE5CFF1, 0x16035CE8B6203D3C }, // 5^135
+    { 0xAECE0EA87E9F43EE, 0x1B843422E3A84C8B }, // 5^136
+    { 0x4D40C9294F238A75, 0x1132A095CE492FD7 }, // 5^137
+    { 0x2090FB73A2EC6D12, 0x157F48BB41DB7BCD }, // 5^138
+    { 0x68B53A508BA78856, 0x1ADF1AEA12525AC0 }, // 5^139
+    { 0x417144725748B536, 0x10CB70D24B7378B8 }, // 5^140
+    { 0x51CD958EED1AE283, 0x14FE4D06DE5056E6 }, // 5^141
+    { 0xE640FAF2A8619B24, 0x1A3DE04895E46C9F }, // 5^142
+    { 0xEFE89CD7A93D00F7, 0x1066AC2D5DAEC3E3 }, // 5^143
+    { 0xEBE2C40D938C4134, 0x14805738B51A74DC }, // 5^144
+    { 0x26DB7510F86F5181, 0x19A06D06E2611214 }, // 5^145
+    { 0x9849292A9B4592F1, 0x100444244D7CAB4C }, // 5^146
+    { 0xBE5B73754216F7AD, 0x1405552D60DBD61F }, // 5^147
+    { 0xADF25052929CB598, 0x1906AA78B912CBA7 }, // 5^148
+    { 0x996EE4673743E2FF, 0x1F485516E7577E91 }, // 5^149
+    { 0xFFE54EC0828A6DDF, 0x138D352E5096AF1A }, // 5^150
+    { 0xBFDEA270A32D0957, 0x18708279E4BC5AE1 }, // 5^151
+    { 0x2FD64B0CCBF84BAD, 0x1E8CA3185DEB719A }, // 5^152
+    { 0x5DE5EEE7FF7B2F4C, 0x1317E5EF3AB32700 }, // 5^153
+    { 0x755F6AA1FF59FB1F, 0x17DDDF6B095FF0C0 }, // 5^154
+    { 0x92B7454A7F3079E7, 0x1DD55745CBB7ECF0 }, // 5^155
+    { 0x5BB28B4E8F7E4C30, 0x12A5568B9F52F416 }, // 5^156
+    { 0xF29F2E22335DDF3C, 0x174EAC2E8727B11B }, // 5^157
+    { 0xEF46F9AAC035570B, 0x1D22573A28F19D62 }, // 5^158
+    { 0xD58C5C0AB8215667, 0x123576845997025D }, // 5^159
+    { 0x4AEF730D6629AC01, 0x16C2D4256FFCC2F5 }, // 5^160
+    { 0x9DAB4FD0BFB41701, 0x1C73892ECBFBF3B2 }, // 5^161
+    { 0xA28B11E277D08E60, 0x11C835BD3F7D784F }, // 5^162
+    { 0x8B2DD65B15C4B1F9, 0x163A432C8F5CD663 }, // 5^163
+    { 0x6DF94BF1DB35DE77, 0x1BC8D3F7B3340BFC }, // 5^164
+    { 0xC4BBCF772901AB0A, 0x115D847AD000877D }, // 5^165
+    { 0x35EAC354F34215CD, 0x15B4E5998400A95D }, // 5^166
+    { 0x8365742A30129B40, 0x1B221EFFE500D3B4 }, // 5^167
+    { 0xD21F689A5E0BA108, 0x10F5535FEF208450 }, // 5^168
+    { 0x06A742C0F58E894A, 0x1532A837EAE8A565 }, // 5^169
+    { 0x4851137132F22B9D, 0x1A7F5245E5A2CEBE }, // 5^170
+    { 0xED32AC26BFD75B42, 0x108F936BAF85C136 }, // 5^171
+    { 0xA87F57306FCD3212, 0x14B378469B673184 }, // 5^172
+    { 0xD29F2CFC8BC07E97, 0x19E056584240FDE5 }, // 5^173
+    { 0xA3A37C1DD7584F1E, 0x102C35F729689EAF }, // 5^174
+    { 0x8C8C5B254D2E62E6, 0x14374374F3C2C65B }, // 5^175
+    { 0x6FAF71EEA079FB9F, 0x1945145230B377F2 }, // 5^176
+    { 0x0B9B4E6A48987A87, 0x1F965966BCE055EF }, // 5^177
+    { 0x674111026D5F4C94, 0x13BDF7E0360C35B5 }, // 5^178
+    { 0xC111554308B71FBA, 0x18AD75D8438F4322 }, // 5^179
+    { 0x7155AA93CAE4E7A8, 0x1ED8D34E547313EB }, // 5^180
+    { 0x26D58A9C5ECF10C9, 0x13478410F4C7EC73 }, // 5^181
+    { 0xF08AED437682D4FB, 0x1819651531F9E78F }, // 5^182
+    { 0xECADA89454238A3A, 0x1E1FBE5A7E786173 }, // 5^183
+    { 0x73EC895CB4963664, 0x12D3D6F88F0B3CE8 }, // 5^184
+    { 0x90E7ABB3E1BBC3FD, 0x1788CCB6B2CE0C22 }, // 5^185
+    { 0x352196A0DA2AB4FD, 0x1D6AFFE45F818F2B }, // 5^186
+    { 0x0134FE24885AB11E, 0x1262DFEEBBB0F97B }, // 5^187
+    { 0xC1823DADAA715D65, 0x16FB97EA6A9D37D9 }, // 5^188
+    { 0x31E2CD19150DB4BF, 0x1CBA7DE5054485D0 }, // 5^189
+    { 0x1F2DC02FAD2890F7, 0x11F48EAF234AD3A2 }, // 5^190
+    { 0xA6F9303B9872B535, 0x1671B25AEC1D888A }, // 5^191
+    { 0x50B77C4A7E8F6282, 0x1C0E1EF1A724EAAD }, // 5^192
+    { 0x5272ADAE8F199D91, 0x1188D357087712AC }, // 5^193
+    { 0x670F591A32E004F6, 0x15EB082CCA94D757 }, // 5^194
+    { 0x40D32F60BF980633, 0x1B65CA37FD3A0D2D }, // 5^195
+    { 0x4883FD9C77BF03E0, 0x111F9E62FE44483C }, // 5^196
+    { 0x5AA4FD0395AEC4D8, 0x156785FBBDD55A4B }, // 5^197
+    { 0x314E3C447B1A760E, 0x1AC1677AAD4AB0DE }, // 5^198
+    { 0xDED0E5AACCF089C9, 0x10B8E0ACAC4EAE8A }, // 5^199
+    { 0x96851F15802CAC3B, 0x14E718D7D7625A2D }, // 5^200
+    { 0xFC2666DAE037D74A, 0x1A20DF0DCD3AF0B8 }, // 5^201
+    { 0x9D980048CC22E68E, 0x10548B68A044D673 }, // 5^202
+    { 0x84FE005AFF2BA032, 0x1469AE42C8560C10 }, // 5^203
+    { 0xA63D8071BEF6883E, 0x198419D37A6B8F14 }, // 5^204
+    { 0xCFCCE08E2EB42A4E, 0x1FE52048590672D9 }, // 5^205
+    { 0x21E00C58DD309A70, 0x13EF342D37A407C8 }, // 5^206
+    { 0x2A580F6F147CC10D, 0x18EB0138858D09BA }, // 5^207
+    { 0xB4EE134AD99BF150, 0x1F25C186A6F04C28 }, // 5^208
+    { 0x7114CC0EC80176D2, 0x137798F428562F99 }, // 5^209
+    { 0xCD59FF127A01D486, 0x18557F31326BBB7F }, // 5^210
+    { 0xC0B07ED7188249A8, 0x1E6ADEFD7F06AA5F }, // 5^211
+    { 0xD86E4F466F516E09, 0x1302CB5E6F642A7B }, // 5^212
+    { 0xCE89E3180B25C98B, 0x17C37E360B3D351A }, // 5^213
+    { 0x822C5BDE0DEF3BEE, 0x1DB45DC38E0C8261 }, // 5^214
+    { 0xF15BB96AC8B58575, 0x1290BA9A38C7D17C }, // 5^215
+    { 0x2DB2A7C57AE2E6D2, 0x1734E940C6F9C5DC }, // 5^216
+    { 0x391F51B6D99BA086, 0x1D022390F8B83753 }, // 5^217
+    { 0x03B3931248014454, 0x1221563A9B732294 }, // 5^218
+    { 0x04A077D6DA019569, 0x16A9ABC9424FEB39 }, // 5^219
+    { 0x45C895CC9081FAC3, 0x1C5416BB92E3E607 }, // 5^220
+    { 0x8B9D5D9FDA513CBA, 0x11B48E353BCE6FC4 }, // 5^221
+    { 0xAE84B507D0E58BE8, 0x1621B1C28AC20BB5 }, // 5^222
+    { 0x1A25E249C51EEEE3, 0x1BAA1E332D728EA3 }, // 5^223
+    { 0xF057AD6E1B33554D, 0x114A52DFFC679925 }, // 5^224
+    { 0x6C6D98C9A2002AA1, 0x159CE797FB817F6F }, // 5^225
+    { 0x4788FEFC0A803549, 0x1B04217DFA61DF4B }, // 5^226
+    { 0x0CB59F5D8690214E, 0x10E294EEBC7D2B8F }, // 5^227
+    { 0xCFE30734E83429A1, 0x151B3A2A6B9C7672 }, // 5^228
+    { 0x83DBC9022241340A, 0x1A6208B50683940F }, // 5^229
+    { 0xB2695DA15568C086, 0x107D457124123C89 }, // 5^230
+    { 0x1F03B509AAC2F0A7, 0x149C96CD6D16CBAC }, // 5^231
+    { 0x26C4A24C1573ACD1, 0x19C3BC80C85C7E97 }, // 5^232
+    { 0x783AE56F8D684C03, 0x101A55D07D39CF1E }, // 5^233
+    { 0x16499ECB70C25F03, 0x1420EB449C8842E6 }, // 5^234
+    { 0x9BDC067E4CF2F6C4, 0x19292615C3AA539F }, // 5^235
+    { 0x82D3081DE02FB476, 0x1F736F9B3494E887 }, // 5^236
+    { 0xB1C3E512AC1DD0C9, 0x13A825C100DD1154 }, // 5^237
+    { 0xDE34DE57572544FC, 0x18922F31411455A9 }, // 5^238
+    { 0x55C215ED2CEE963B, 0x1EB6BAFD91596B14 }, // 5^239
+    { 0xB5994DB43C151DE5, 0x133234DE7AD7E2EC }, // 5^240
+    { 0xE2FFA1214B1A655E, 0x17FEC216198DDBA7 }, // 5^241
+    { 0xDBBF89699DE0FEB6, 0x1DFE729B9FF15291 }, // 5^242
+    { 0x2957B5E202AC9F31, 0x12BF07A143F6D39B }, // 5^243
+    { 0xF3ADA35A8357C6FE, 0x176EC98994F48881 }, // 5^244
+    { 0x70990C31242DB8BD, 0x1D4A7BEBFA31AAA2 }, // 5^245
+    { 0x865FA79EB69C9376, 0x124E8D737C5F0AA5 }, // 5^246
+    { 0xE7F791866443B854, 0x16E230D05B76CD4E }, // 5^247
+    { 0xA1F575E7FD54A669, 0x1C9ABD04725480A2 }, // 5^248
+    { 0xA53969B0FE54E801, 0x11E0B622C774D065 }, // 5^249
+    { 0x0E87C41D3DEA2202, 0x1658E3AB7952047F }, // 5^250
+    { 0xD229B5248D64AA82, 0x1BEF1C9657A6859E }, // 5^251
+    { 0x435A1136D85EEA91, 0x117571DDF6C81383 }, // 5^252
+    { 0x143095848E76A536, 0x15D2CE55747A1864 }, // 5^253
+    { 0x193CBAE5B2144E83, 0x1B4781EAD1989E7D }, // 5^254
+    { 0x2FC5F4CF8F4CB112, 0x110CB132C2FF630E }, // 5^255
+    { 0xBBB77203731FDD56, 0x154FDD7F73BF3BD1 }, // 5^256
+    { 0x2AA54E844FE7D4AC, 0x1AA3D4DF50AF0AC6 }, // 5^257
+    { 0xDAA75112B1F0E4EB, 0x10A6650B926D66BB }, // 5^258
+    { 0xD15125575E6D1E26, 0x14CFFE4E7708C06A }, // 5^259
+    { 0x85A56EAD360865B0, 0x1A03FDE214CAF085 }, // 5^260
+    { 0x7387652C41C53F8E, 0x10427EAD4CFED653 }, // 5^261
+    { 0x50693E7752368F71, 0x14531E58A03E8BE8 }, // 5^262
+    { 0x64838E1526C4334E, 0x1967E5EEC84E2EE2 }, // 5^263
+    { 0xFDA4719A70754022, 0x1FC1DF6A7A61BA9A }, // 5^264
+    { 0xDE86C70086494815, 0x13D92BA28C7D14A0 }, // 5^265
+    { 0x162878C0A7DB9A1A, 0x18CF768B2F9C59C9 }, // 5^266
+    { 0x5BB296F0D1D280A1, 0x1F03542DFB83703B }, // 5^267
+    { 0x194F9E5683239064, 0x1362149CBD322625 }, // 5^268
+    { 0x5FA385EC23EC747E, 0x183A99C3EC7EAFAE }, // 5^269
+    { 0xF78C67672CE7919D, 0x1E494034E79E5B99 }, // 5^270
+    { 0x3AB7C0A07C10BB02, 0x12EDC82110C2F940 }, // 5^271
+    { 0x4965B0C89B14E9C3, 0x17A93A2954F3B790 }, // 5^272
+    { 0x5BBF1CFAC1DA2433, 0x1D9388B3AA30A574 }, // 5^273
+    { 0xB957721CB92856A0, 0x127C35704A5E6768 }, // 5^274
+    { 0xE7AD4EA3E7726C48, 0x171B42CC5CF60142 }, // 5^275
+    { 0xA198A24CE14F075A, 0x1CE2137F74338193 }, // 5^276
+    { 0x44FF65700CD16498, 0x120D4C2FA8A030FC }, // 5^277
+    { 0x563F3ECC1005BDBE, 0x16909F3B92C83D3B }, // 5^278
+    { 0x2BCF0E7F14072D2E, 0x1C34C70A777A4C8A }, // 5^279
+    { 0x5B61690F6C847C3D, 0x11A0FC668AAC6FD6 }, // 5^280
+    { 0xF239C35347A59B4C, 0x16093B802D578BCB }, // 5^281
+    { 0xEEC83428198F021F, 0x1B8B8A6038AD6EBE }, // 5^282
+    { 0x553D20990FF96153, 0x1137367C236C6537 }, // 5^283
+    { 0x2A8C68BF53F7B9A8, 0x1585041B2C477E85 }, // 5^284
+    { 0x752F82EF28F5A812, 0x1AE64521F7595E26 }, // 5^285
+    { 0x093DB1D57999890B, 0x10CFEB353A97DAD8 }, // 5^286
+    { 0x0B8D1E4AD7FFEB4E, 0x1503E602893DD18E }, // 5^287
+    { 0x8E7065DD8DFFE622, 0x1A44DF832B8D45F1 }, // 5^288
+    { 0xF9063FAA78BFEFD5, 0x106B0BB1FB384BB6 }, // 5^289
+    { 0xB747CF9516EFEBCA, 0x1485CE9E7A065EA4 }, // 5^290
+    { 0xE519C37A5CABE6BD, 0x19A742461887F64D }, // 5^291
+    { 0xAF301A2C79EB7036, 0x1008896BCF54F9F0 }, // 5^292
+    { 0xDAFC20B798664C43, 0x140AABC6C32A386C }, // 5^293
+    { 0x11BB28E57E7FDF54, 0x190D56B873F4C688 }, // 5^294
+    { 0x1629F31EDE1FD72A, 0x1F50AC6690F1F82A }, // 5^295
+    { 0x4DDA37F34AD3E67A, 0x13926BC01A973B1A }, // 5^296
+    { 0xE150C5F01D88E019, 0x187706B0213D09E0 }, // 5^297
+    { 0x19A4F76C24EB181F, 0x1E94C85C298C4C59 }, // 5^298
+    { 0xB0071AA39712EF13, 0x131CFD3999F7AFB7 }, // 5^299
+    { 0x9C08E14C7CD7AAD8, 0x17E43C8800759BA5 }, // 5^300
+    { 0x030B199F9C0D958E, 0x1DDD4BAA0093028F }, // 5^301
+    { 0x61E6F003C1887D79, 0x12AA4F4A405BE199 }, // 5^302
+    { 0xBA60AC04B1EA9CD7, 0x1754E31CD072D9FF }, // 5^303
+    { 0xA8F8D705DE65440D, 0x1D2A1BE4048F907F }, // 5^304
+    { 0xC99B8663AAFF4A88, 0x123A516E82D9BA4F }, // 5^305
+    { 0xBC0267FC95BF1D2A, 0x16C8E5CA239028E3 }, // 5^306
+    { 0xAB0301FBBB2EE474, 0x1C7B1F3CAC74331C }, // 5^307
+    { 0xEAE1E13D54FD4EC9, 0x11CCF385EBC89FF1 }, // 5^308
+    { 0x659A598CAA3CA27B, 0x1640306766BAC7EE }, // 5^309
+    { 0xFF00EFEFD4CBCB1A, 0x1BD03C81406979E9 }, // 5^310
+    { 0x3F6095F5E4FF5EF0, 0x116225D0C841EC32 }, // 5^311
+    { 0xCF38BB735E3F36AC, 0x15BAAF44FA52673E }, // 5^312
+    { 0x8306EA5035CF0457, 0x1B295B1638E7010E }, // 5^313
+    { 0x11E4527221A162B6, 0x10F9D8EDE39060A9 }, // 5^314
+    { 0x565D670EAA09BB64, 0x15384F295C7478D3 }, // 5^315
+    { 0x2BF4C0D2548C2A3D, 0x1A8662F3B3919708 }, // 5^316
+    { 0x1B78F88374D79A66, 0x1093FDD8503AFE65 }, // 5^317
+    { 0x625736A4520D8100, 0x14B8FD4E6449BDFE }, // 5^318
+    { 0xFAED044D6690E140, 0x19E73CA1FD5C2D7D }, // 5^319
+    { 0xBCD422B0601A8CC8, 0x103085E53E599C6E }, // 5^320
+    { 0x6C092B5C78212FFA, 0x143CA75E8DF0038A }, // 5^321
+    { 0x070B763396297BF8, 0x194BD136316C046D }, // 5^322
+    { 0x48CE53C07BB3DAF6, 0x1F9EC583BDC70588 }, // 5^323
+    { 0x2D80F4584D5068DA, 0x13C33B72569C6375 }, // 5^324
+    { 0x78E1316E60A48310, 0x18B40A4EEC437C52 }, // 5^325
+};
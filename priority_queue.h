@@ -0,0 +1,231 @@
+/// Data
+////////////////////////////////////////////////////////////
+template<typename Type>
+struct PriorityQueueHnd {
+    uint32 id;
+};
+
+// 4-ary min-heap: Compare(a, b) returns true if a should be popped before b. A node's 4 children are adjacent, so
+// sifting down touches fewer cache lines than a binary heap and the tree is half as deep.
+//
+// Each element has a handle for DecreaseKey(). hnd_ids maps heap index -> handle id, and positions maps handle id ->
+// heap index (or next free handle id for unused handles). Handles are valid until their element is popped.
+template<typename Type>
+struct PriorityQueue {
+    Allocator*               allocator;
+    Type*                    data;
+    uint32*                  hnd_ids;
+    uint32*                  positions;
+    uint32                   size;
+    uint32                   count;
+    uint32                   next_free_hnd_id;
+    Func<bool, Type*, Type*> Compare;
+};
+
+constexpr uint32 PRIORITY_QUEUE_ARITY       = 4;
+constexpr uint32 PRIORITY_QUEUE_NO_FREE_HND = UINT32_MAX;
+
+/// Utils
+////////////////////////////////////////////////////////////
+uint32 GetHeapParent(uint32 index) {
+    return (index - 1) / PRIORITY_QUEUE_ARITY;
+}
+
+uint32 GetHeapFirstChild(uint32 index) {
+    return (index * PRIORITY_QUEUE_ARITY) + 1;
+}
+
+template<typename Type>
+void Place(PriorityQueue<Type>* queue, uint32 index, Type elem, uint32 hnd_id) {
+    queue->data[index]       = elem;
+    queue->hnd_ids[index]    = hnd_id;
+    queue->positions[hnd_id] = index;
+}
+
+// Moves a hole up from index instead of swapping, so each level costs one copy.
+template<typename Type>
+void SiftUp(PriorityQueue<Type>* queue, uint32 index) {
+    Type   elem   = queue->data[index];
+    uint32 hnd_id = queue->hnd_ids[index];
+    while (index > 0) {
+        uint32 parent = GetHeapParent(index);
+        if (!queue->Compare(&elem, &queue->data[parent])) {
+            break;
+        }
+        Place(queue, index, queue->data[parent], queue->hnd_ids[parent]);
+        index = parent;
+    }
+    Place(queue, index, elem, hnd_id);
+}
+
+template<typename Type>
+void SiftDown(PriorityQueue<Type>* queue, uint32 index) {
+    Type   elem   = queue->data[index];
+    uint32 hnd_id = queue->hnd_ids[index];
+    while (true) {
+        uint32 first_child = GetHeapFirstChild(index);
+        if (first_child >= queue->count) {
+            break;
+        }
+
+        uint32 last_child = Min(first_child + PRIORITY_QUEUE_ARITY, queue->count);
+        uint32 best_child = first_child;
+        for (uint32 child = first_child + 1; child < last_child; child += 1) {
+            if (queue->Compare(&queue->data[child], &queue->data[best_child])) {
+                best_child = child;
+            }
+        }
+
+        if (!queue->Compare(&queue->data[best_child], &elem)) {
+            break;
+        }
+        Place(queue, index, queue->data[best_child], queue->hnd_ids[best_child]);
+        index = best_child;
+    }
+    Place(queue, index, elem, hnd_id);
+}
+
+template<typename Type>
+void Resize(PriorityQueue<Type>* queue, uint32 new_size) {
+    CTK_ASSERT(new_size >= queue->count);
+
+    uint32 old_size = queue->size;
+    queue->data      = ReallocateNZ(queue->allocator, queue->data,      new_size);
+    queue->hnd_ids   = ReallocateNZ(queue->allocator, queue->hnd_ids,   new_size);
+    queue->positions = ReallocateNZ(queue->allocator, queue->positions, new_size);
+
+    // Link new handle ids into free list.
+    for (uint32 id = old_size; id < new_size; id += 1) {
+        queue->positions[id] = id + 1 < new_size ? id + 1 : queue->next_free_hnd_id;
+    }
+    if (new_size > old_size) {
+        queue->next_free_hnd_id = old_size;
+    }
+    queue->size = new_size;
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+template<typename Type>
+PriorityQueue<Type> CreatePriorityQueue(Allocator* allocator, uint32 size, Func<bool, Type*, Type*> Compare) {
+    CTK_ASSERT(size > 0);
+
+    PriorityQueue<Type> queue = {};
+    queue.allocator        = allocator;
+    queue.data             = AllocateNZ<Type>(allocator, size);
+    queue.hnd_ids          = AllocateNZ<uint32>(allocator, size);
+    queue.positions        = AllocateNZ<uint32>(allocator, size);
+    queue.size             = size;
+    queue.count            = 0;
+    queue.next_free_hnd_id = 0;
+    queue.Compare          = Compare;
+    for (uint32 id = 0; id < size; id += 1) {
+        queue.positions[id] = id + 1 < size ? id + 1 : PRIORITY_QUEUE_NO_FREE_HND;
+    }
+    return queue;
+}
+
+// Builds heap from array elements in O(n) (bottom-up heapify). Element at array index i gets handle id i.
+template<typename Type>
+PriorityQueue<Type> CreatePriorityQueue(Allocator* allocator, Array<Type>* array, Func<bool, Type*, Type*> Compare) {
+    PriorityQueue<Type> queue = CreatePriorityQueue(allocator, Max(array->count, 1u), Compare);
+    memcpy(queue.data, array->data, array->count * sizeof(Type));
+    for (uint32 i = 0; i < array->count; i += 1) {
+        queue.hnd_ids[i]   = i;
+        queue.positions[i] = i;
+    }
+    queue.count            = array->count;
+    queue.next_free_hnd_id = array->count < queue.size ? array->count : PRIORITY_QUEUE_NO_FREE_HND;
+
+    if (queue.count > 1) {
+        for (sint32 i = (sint32)GetHeapParent(queue.count - 1); i >= 0; i -= 1) {
+            SiftDown(&queue, (uint32)i);
+        }
+    }
+
+    return queue;
+}
+
+template<typename Type>
+void DestroyPriorityQueue(PriorityQueue<Type>* queue) {
+    CTK_ASSERT(queue->allocator != NULL);
+
+    Deallocate(queue->allocator, queue->data);
+    Deallocate(queue->allocator, queue->hnd_ids);
+    Deallocate(queue->allocator, queue->positions);
+    *queue = {};
+}
+
+// Grows queue if full.
+template<typename Type>
+PriorityQueueHnd<Type> Push(PriorityQueue<Type>* queue, Type elem) {
+    if (queue->count == queue->size) {
+        Resize(queue, queue->size * 2);
+    }
+
+    uint32 hnd_id = queue->next_free_hnd_id;
+    queue->next_free_hnd_id = queue->positions[hnd_id];
+
+    uint32 index = queue->count;
+    queue->count += 1;
+    Place(queue, index, elem, hnd_id);
+    SiftUp(queue, index);
+
+    return { hnd_id };
+}
+
+template<typename Type>
+Type Top(PriorityQueue<Type>* queue) {
+    if (queue->count == 0) {
+        CTK_FATAL("can't get top element of priority queue: queue is empty");
+    }
+
+    return queue->data[0];
+}
+
+template<typename Type>
+Type Pop(PriorityQueue<Type>* queue) {
+    if (queue->count == 0) {
+        CTK_FATAL("can't pop element from priority queue: queue is empty");
+    }
+
+    Type top = queue->data[0];
+    uint32 top_hnd_id = queue->hnd_ids[0];
+
+    queue->count -= 1;
+    if (queue->count > 0) {
+        Place(queue, 0, queue->data[queue->count], queue->hnd_ids[queue->count]);
+        SiftDown(queue, 0);
+    }
+
+    queue->positions[top_hnd_id] = queue->next_free_hnd_id;
+    queue->next_free_hnd_id = top_hnd_id;
+
+    return top;
+}
+
+template<typename Type>
+Type Get(PriorityQueue<Type>* queue, PriorityQueueHnd<Type> hnd) {
+    CTK_ASSERT(hnd.id < queue->size);
+    CTK_ASSERT(queue->positions[hnd.id] < queue->count && queue->hnd_ids[queue->positions[hnd.id]] == hnd.id);
+
+    return queue->data[queue->positions[hnd.id]];
+}
+
+// Replaces element for hnd with elem, which should be popped no later than the element it replaces.
+template<typename Type>
+void DecreaseKey(PriorityQueue<Type>* queue, PriorityQueueHnd<Type> hnd, Type elem) {
+    CTK_ASSERT(hnd.id < queue->size);
+
+    uint32 index = queue->positions[hnd.id];
+    if (index >= queue->count || queue->hnd_ids[index] != hnd.id) {
+        CTK_FATAL("can't decrease key for priority queue handle %u: handle's element has been popped", hnd.id);
+    }
+
+    if (queue->Compare(&queue->data[index], &elem) && !queue->Compare(&elem, &queue->data[index])) {
+        CTK_FATAL("can't decrease key for priority queue handle %u: new element has lower priority", hnd.id);
+    }
+
+    queue->data[index] = elem;
+    SiftUp(queue, index);
+}
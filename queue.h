@@ -0,0 +1,303 @@
+/// Data
+////////////////////////////////////////////////////////////
+
+// Single-producer/single-consumer ring. head is only written by the producer and tail is only written by the consumer;
+// each side caches the other side's last seen index so it only touches the shared cache line when the cached value
+// says the queue is full/empty.
+template<typename Type>
+struct SPSCQueue {
+    alignas(CACHE_LINE_SIZE) volatile uint32 head;
+    uint32                                   cached_tail;
+
+    alignas(CACHE_LINE_SIZE) volatile uint32 tail;
+    uint32                                   cached_head;
+
+    alignas(CACHE_LINE_SIZE) Type* data;
+    uint32                         size;
+    uint32                         mask;
+    Allocator*                     allocator;
+};
+
+template<typename Type>
+struct MPMCCell {
+    volatile uint32 sequence;
+    Type            data;
+};
+
+// Bounded multi-producer/multi-consumer queue (Vyukov). Each cell's sequence number tells producers whether the cell is
+// free for the current lap and consumers whether it has been published, so each push/pop is a single CAS on its index.
+template<typename Type>
+struct MPMCQueue {
+    alignas(CACHE_LINE_SIZE) MPMCCell<Type>* cells;
+    uint32                                   size;
+    uint32                                   mask;
+    Allocator*                               allocator;
+
+    alignas(CACHE_LINE_SIZE) volatile uint32 enqueue_pos;
+    alignas(CACHE_LINE_SIZE) volatile uint32 dequeue_pos;
+};
+
+/// SPSCQueue Interface
+////////////////////////////////////////////////////////////
+template<typename Type>
+SPSCQueue<Type> CreateSPSCQueue(Allocator* allocator, uint32 size) {
+    if (!IsPowerOf2(size) || size > (1u << 31)) {
+        CTK_FATAL("can't create SPSC queue of size %u: size must be a power of 2 no greater than 2^31", size);
+    }
+
+    SPSCQueue<Type> queue = {};
+    queue.data      = Allocate<Type>(allocator, size);
+    queue.size      = size;
+    queue.mask      = size - 1;
+    queue.allocator = allocator;
+    return queue;
+}
+
+template<typename Type>
+void DestroySPSCQueue(SPSCQueue<Type>* queue) {
+    Deallocate(queue->allocator, queue->data);
+    *queue = {};
+}
+
+// Producer
+template<typename Type>
+bool TryPush(SPSCQueue<Type>* queue, Type elem) {
+    uint32 head = queue->head;
+    if (head - queue->cached_tail == queue->size) {
+        queue->cached_tail = AtomicLoad(&queue->tail);
+        if (head - queue->cached_tail == queue->size) {
+            return false;
+        }
+    }
+
+    queue->data[head & queue->mask] = elem;
+    AtomicStore(&queue->head, head + 1);
+    return true;
+}
+
+// Producer; pushes as many elems as there is space for and publishes them all at once. Returns number pushed.
+template<typename Type>
+uint32 TryPushRange(SPSCQueue<Type>* queue, const Type* elems, uint32 elem_count) {
+    uint32 head = queue->head;
+    uint32 free_count = queue->size - (head - queue->cached_tail);
+    if (free_count < elem_count) {
+        queue->cached_tail = AtomicLoad(&queue->tail);
+        free_count = queue->size - (head - queue->cached_tail);
+    }
+
+    uint32 push_count = Min(elem_count, free_count);
+    if (push_count == 0) {
+        return 0;
+    }
+
+    // Copy in up to 2 regions if range wraps around end of buffer.
+    uint32 start       = head & queue->mask;
+    uint32 first_count = Min(push_count, queue->size - start);
+    memcpy(&queue->data[start], elems, first_count * sizeof(Type));
+    memcpy(queue->data, elems + first_count, (push_count - first_count) * sizeof(Type));
+
+    AtomicStore(&queue->head, head + push_count);
+    return push_count;
+}
+
+// Consumer
+template<typename Type>
+bool TryPop(SPSCQueue<Type>* queue, Type* elem) {
+    uint32 tail = queue->tail;
+    if (tail == queue->cached_head) {
+        queue->cached_head = AtomicLoad(&queue->head);
+        if (tail == queue->cached_head) {
+            return false;
+        }
+    }
+
+    *elem = queue->data[tail & queue->mask];
+    AtomicStore(&queue->tail, tail + 1);
+    return true;
+}
+
+// Consumer; pops as many elems as are available up to max_count and releases their slots all at once. Returns number
+// popped.
+template<typename Type>
+uint32 TryPopRange(SPSCQueue<Type>* queue, Type* elems, uint32 max_count) {
+    uint32 tail = queue->tail;
+    uint32 available_count = queue->cached_head - tail;
+    if (available_count < max_count) {
+        queue->cached_head = AtomicLoad(&queue->head);
+        available_count = queue->cached_head - tail;
+    }
+
+    uint32 pop_count = Min(max_count, available_count);
+    if (pop_count == 0) {
+        return 0;
+    }
+
+    uint32 start       = tail & queue->mask;
+    uint32 first_count = Min(pop_count, queue->size - start);
+    memcpy(elems, &queue->data[start], first_count * sizeof(Type));
+    memcpy(elems + first_count, queue->data, (pop_count - first_count) * sizeof(Type));
+
+    AtomicStore(&queue->tail, tail + pop_count);
+    return pop_count;
+}
+
+template<typename Type>
+void Push(SPSCQueue<Type>* queue, Type elem) {
+    Backoff backoff = {};
+    while (!TryPush(queue, elem)) {
+        Spin(&backoff);
+    }
+}
+
+template<typename Type>
+void PushRange(SPSCQueue<Type>* queue, const Type* elems, uint32 elem_count) {
+    Backoff backoff = {};
+    while (elem_count > 0) {
+        uint32 push_count = TryPushRange(queue, elems, elem_count);
+        if (push_count == 0) {
+            Spin(&backoff);
+            continue;
+        }
+        Reset(&backoff);
+        elems      += push_count;
+        elem_count -= push_count;
+    }
+}
+
+template<typename Type>
+Type Pop(SPSCQueue<Type>* queue) {
+    Type elem;
+    Backoff backoff = {};
+    while (!TryPop(queue, &elem)) {
+        Spin(&backoff);
+    }
+    return elem;
+}
+
+// Blocks until at least 1 elem is available; returns number popped.
+template<typename Type>
+uint32 PopRange(SPSCQueue<Type>* queue, Type* elems, uint32 max_count) {
+    CTK_ASSERT(max_count > 0);
+
+    Backoff backoff = {};
+    uint32 pop_count = 0;
+    while ((pop_count = TryPopRange(queue, elems, max_count)) == 0) {
+        Spin(&backoff);
+    }
+    return pop_count;
+}
+
+// Approximate when called concurrently with push/pop operations.
+template<typename Type>
+uint32 GetCount(SPSCQueue<Type>* queue) {
+    return AtomicLoad(&queue->head) - AtomicLoad(&queue->tail);
+}
+
+/// MPMCQueue Interface
+////////////////////////////////////////////////////////////
+template<typename Type>
+MPMCQueue<Type> CreateMPMCQueue(Allocator* allocator, uint32 size) {
+    if (!IsPowerOf2(size) || size < 2 || size > (1u << 31)) {
+        CTK_FATAL("can't create MPMC queue of size %u: size must be a power of 2 between 2 and 2^31", size);
+    }
+
+    MPMCQueue<Type> queue = {};
+    queue.cells       = Allocate<MPMCCell<Type>>(allocator, size);
+    queue.size        = size;
+    queue.mask        = size - 1;
+    queue.allocator   = allocator;
+    queue.enqueue_pos = 0;
+    queue.dequeue_pos = 0;
+
+    // Cell i is free for the producer whose enqueue position is i.
+    for (uint32 i = 0; i < size; i += 1) {
+        queue.cells[i].sequence = i;
+    }
+
+    return queue;
+}
+
+template<typename Type>
+void DestroyMPMCQueue(MPMCQueue<Type>* queue) {
+    Deallocate(queue->allocator, queue->cells);
+    *queue = {};
+}
+
+template<typename Type>
+bool TryPush(MPMCQueue<Type>* queue, Type elem) {
+    MPMCCell<Type>* cell = NULL;
+    uint32 pos = AtomicLoad(&queue->enqueue_pos);
+    for (;;) {
+        cell = &queue->cells[pos & queue->mask];
+        sint32 diff = (sint32)(AtomicLoad(&cell->sequence) - pos);
+        if (diff == 0) {
+            // Cell is free for this lap; claim it.
+            uint32 prev_pos = AtomicCompareExchange(&queue->enqueue_pos, pos + 1, pos);
+            if (prev_pos == pos) {
+                break;
+            }
+            pos = prev_pos;
+        }
+        else if (diff < 0) {
+            // Cell still holds an elem from the previous lap; queue is full.
+            return false;
+        }
+        else {
+            // Another producer claimed pos; retry at latest position.
+            pos = AtomicLoad(&queue->enqueue_pos);
+        }
+    }
+
+    cell->data = elem;
+    AtomicStore(&cell->sequence, pos + 1);
+    return true;
+}
+
+template<typename Type>
+bool TryPop(MPMCQueue<Type>* queue, Type* elem) {
+    MPMCCell<Type>* cell = NULL;
+    uint32 pos = AtomicLoad(&queue->dequeue_pos);
+    for (;;) {
+        cell = &queue->cells[pos & queue->mask];
+        sint32 diff = (sint32)(AtomicLoad(&cell->sequence) - (pos + 1));
+        if (diff == 0) {
+            // Cell has been published for this lap; claim it.
+            uint32 prev_pos = AtomicCompareExchange(&queue->dequeue_pos, pos + 1, pos);
+            if (prev_pos == pos) {
+                break;
+            }
+            pos = prev_pos;
+        }
+        else if (diff < 0) {
+            // Cell hasn't been published yet; queue is empty.
+            return false;
+        }
+        else {
+            pos = AtomicLoad(&queue->dequeue_pos);
+        }
+    }
+
+    *elem = cell->data;
+
+    // Free cell for the producer on the next lap.
+    AtomicStore(&cell->sequence, pos + queue->mask + 1);
+    return true;
+}
+
+template<typename Type>
+void Push(MPMCQueue<Type>* queue, Type elem) {
+    Backoff backoff = {};
+    while (!TryPush(queue, elem)) {
+        Spin(&backoff);
+    }
+}
+
+template<typename Type>
+Type Pop(MPMCQueue<Type>* queue) {
+    Type elem;
+    Backoff backoff = {};
+    while (!TryPop(queue, &elem)) {
+        Spin(&backoff);
+    }
+    return elem;
+}
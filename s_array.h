@@ -0,0 +1,222 @@
+/// Data
+////////////////////////////////////////////////////////////
+
+// Stores up to inline_size elements inline and only allocates from allocator once it overflows. Once spilled, elements
+// stay in allocated memory until the array is destroyed.
+template<typename Type, uint32 inline_size>
+struct SArray {
+    Allocator* allocator;
+    uint32     size;
+    uint32     count;
+    union {
+        Type  inline_data[inline_size];
+        Type* data;
+    };
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+template<typename Type, uint32 inline_size>
+bool IsInline(SArray<Type, inline_size>* array) {
+    return array->size == inline_size;
+}
+
+template<typename Type, uint32 inline_size>
+Type* GetData(SArray<Type, inline_size>* array) {
+    return IsInline(array) ? array->inline_data : array->data;
+}
+
+template<typename Type, uint32 inline_size>
+void Grow(SArray<Type, inline_size>* array, uint32 min_size) {
+    if (min_size <= array->size) {
+        return;
+    }
+
+    if (array->allocator == NULL) {
+        CTK_FATAL("can't grow small array beyond inline size of %u: array has no allocator", inline_size);
+    }
+
+    uint32 new_size = Max(array->size * 2, min_size);
+    if (IsInline(array)) {
+        // Spill inline elements to allocated memory. Copy out first since data shares space with inline_data.
+        Type* new_data = AllocateNZ<Type>(array->allocator, new_size);
+        memcpy(new_data, array->inline_data, array->count * sizeof(Type));
+        array->data = new_data;
+    }
+    else {
+        array->data = ReallocateNZ(array->allocator, array->data, new_size);
+    }
+    array->size = new_size;
+}
+
+/// CTK_ITER Interface
+////////////////////////////////////////////////////////////
+template<typename Type, uint32 inline_size>
+Type* IterStart(SArray<Type, inline_size>* array) {
+    return GetData(array);
+}
+
+template<typename Type, uint32 inline_size>
+Type* IterEnd(SArray<Type, inline_size>* array) {
+    return GetData(array) + array->count;
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+template<typename Type, uint32 inline_size>
+SArray<Type, inline_size> CreateSArray(Allocator* allocator) {
+    static_assert(inline_size > 0);
+
+    SArray<Type, inline_size> array = {};
+    array.allocator = allocator;
+    array.size      = inline_size;
+    array.count     = 0;
+    return array;
+}
+
+template<typename Type, uint32 inline_size>
+void DestroySArray(SArray<Type, inline_size>* array) {
+    if (!IsInline(array)) {
+        Deallocate(array->allocator, array->data);
+    }
+    *array = {};
+    array->size = inline_size;
+}
+
+template<typename Type, uint32 inline_size>
+Type* Push(SArray<Type, inline_size>* array, Type elem) {
+    Grow(array, array->count + 1);
+
+    Type* new_elem = &GetData(array)[array->count];
+    *new_elem = elem;
+    array->count += 1;
+    return new_elem;
+}
+
+template<typename Type, uint32 inline_size>
+Type* Push(SArray<Type, inline_size>* array) {
+    return Push(array, {});
+}
+
+template<typename Type, uint32 inline_size>
+void PushRange(SArray<Type, inline_size>* array, const Type* data, uint32 data_size) {
+    if (data_size == 0) {
+        return;
+    }
+
+    Grow(array, array->count + data_size);
+
+    memcpy(&GetData(array)[array->count], data, data_size * sizeof(Type));
+    array->count += data_size;
+}
+
+template<typename Type, uint32 inline_size>
+void PushRange(SArray<Type, inline_size>* array, Array<Type>* other) {
+    PushRange(array, other->data, other->count);
+}
+
+template<typename Type, uint32 inline_size, uint32 size>
+void PushRange(SArray<Type, inline_size>* array, FArray<Type, size>* other) {
+    PushRange(array, other->data, other->count);
+}
+
+template<typename Type, uint32 inline_size>
+void Remove(SArray<Type, inline_size>* array, uint32 index) {
+    CTK_ASSERT(index < array->count);
+
+    Type* data = GetData(array);
+    memmove(&data[index], &data[index + 1], (array->count - index - 1) * sizeof(Type));
+    array->count -= 1;
+}
+
+template<typename Type, uint32 inline_size>
+void RemoveRange(SArray<Type, inline_size>* array, uint32 index, uint32 count) {
+    CTK_ASSERT(index < array->count);
+    CTK_ASSERT(index + count <= array->count);
+
+    Type* data = GetData(array);
+    memmove(&data[index], &data[index + count], (array->count - index - count) * sizeof(Type));
+    array->count -= count;
+}
+
+template<typename Type, uint32 inline_size>
+void Clear(SArray<Type, inline_size>* array) {
+    array->count = 0;
+}
+
+template<typename Type, uint32 inline_size>
+Type* GetPtr(SArray<Type, inline_size>* array, uint32 index) {
+    CTK_ASSERT(index < array->count);
+
+    return &GetData(array)[index];
+}
+
+template<typename Type, uint32 inline_size>
+Type Get(SArray<Type, inline_size>* array, uint32 index) {
+    CTK_ASSERT(index < array->count);
+
+    return GetData(array)[index];
+}
+
+template<typename Type, uint32 inline_size>
+void Set(SArray<Type, inline_size>* array, uint32 index, Type val) {
+    CTK_ASSERT(index < array->count);
+
+    GetData(array)[index] = val;
+}
+
+template<typename Type, uint32 inline_size>
+uint32 ByteSize(SArray<Type, inline_size>* array) {
+    return array->size * sizeof(Type);
+}
+
+template<typename Type, uint32 inline_size>
+uint32 ByteCount(SArray<Type, inline_size>* array) {
+    return array->count * sizeof(Type);
+}
+
+template<typename Type, uint32 inline_size>
+bool Contains(SArray<Type, inline_size>* array, Type val) {
+    CTK_ITER(array_val, array) {
+        if (*array_val == val) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template<typename Type, uint32 inline_size>
+void Reverse(SArray<Type, inline_size>* array) {
+    Reverse(GetData(array), array->count);
+}
+
+template<typename Type, uint32 inline_size, typename ...Args>
+void InsertionSort(SArray<Type, inline_size>* array, Func<bool, Type*, Type*, Args...> SortFunc, Args... args) {
+    InsertionSort(GetData(array), array->count, SortFunc, args...);
+}
+
+template<typename Type, uint32 inline_size>
+Type Pop(SArray<Type, inline_size>* array) {
+    if (array->count == 0) {
+        CTK_FATAL("can't pop element from array; array is empty");
+    }
+    array->count -= 1;
+    return GetData(array)[array->count];
+}
+
+template<typename Type, uint32 inline_size>
+Type GetLast(SArray<Type, inline_size>* array) {
+    if (array->count == 0) {
+        CTK_FATAL("can't get last element from array; array is empty");
+    }
+    return GetData(array)[array->count - 1];
+}
+
+template<typename Type, uint32 inline_size>
+Type* GetLastPtr(SArray<Type, inline_size>* array) {
+    if (array->count == 0) {
+        CTK_FATAL("can't get last element from array; array is empty");
+    }
+    return &GetData(array)[array->count - 1];
+}
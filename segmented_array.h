@@ -0,0 +1,191 @@
+/// Macros
+////////////////////////////////////////////////////////////
+
+// Iterates over elements chunk by chunk; break only exits the current chunk.
+#define CTK_ITER_SEGMENTED(VAR, ARRAY) \
+    for (uint32 _chunk_index = 0; _chunk_index < GetChunkCount(ARRAY); _chunk_index += 1) \
+        CTK_ITER_PTR(VAR, GetChunk(ARRAY, _chunk_index), GetChunkElemCount(ARRAY, _chunk_index))
+
+/// Data
+////////////////////////////////////////////////////////////
+
+// Elements are stored in fixed-size power-of-2 chunks that are never moved once allocated, so pointers returned by
+// Push()/GetPtr() stay valid and growth never copies existing elements. Only the chunk table is reallocated.
+template<typename Type>
+struct SegmentedArray {
+    Allocator* allocator;
+    Type**     chunks;
+    uint32     chunk_table_size;
+    uint32     chunk_count;
+    uint32     chunk_shift;
+    uint32     chunk_mask;
+    uint32     count;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+template<typename Type>
+uint32 GetChunkSize(SegmentedArray<Type>* array) {
+    return array->chunk_mask + 1;
+}
+
+template<typename Type>
+void PushChunk(SegmentedArray<Type>* array) {
+    if (array->chunk_count == array->chunk_table_size) {
+        uint32 new_table_size = array->chunk_table_size == 0 ? 8 : array->chunk_table_size * 2;
+        array->chunks = array->chunk_table_size == 0
+                        ? AllocateNZ<Type*>(array->allocator, new_table_size)
+                        : ReallocateNZ(array->allocator, array->chunks, new_table_size);
+        array->chunk_table_size = new_table_size;
+    }
+
+    array->chunks[array->chunk_count] = AllocateNZ<Type>(array->allocator, GetChunkSize(array));
+    array->chunk_count += 1;
+}
+
+// Ensures chunks exist for elements up to (but not including) index end.
+template<typename Type>
+void ReserveChunks(SegmentedArray<Type>* array, uint32 end) {
+    uint32 required_chunk_count = (uint32)(((uint64)end + array->chunk_mask) >> array->chunk_shift);
+    while (array->chunk_count < required_chunk_count) {
+        PushChunk(array);
+    }
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+template<typename Type>
+SegmentedArray<Type> CreateSegmentedArray(Allocator* allocator, uint32 chunk_size) {
+    if (!IsPowerOf2(chunk_size)) {
+        CTK_FATAL("can't create segmented array with chunk size %u: chunk size must be a power of 2", chunk_size);
+    }
+
+    SegmentedArray<Type> array = {};
+    array.allocator        = allocator;
+    array.chunks           = NULL;
+    array.chunk_table_size = 0;
+    array.chunk_count      = 0;
+    array.chunk_shift      = 0;
+    array.chunk_mask       = chunk_size - 1;
+    array.count            = 0;
+    while ((1u << array.chunk_shift) < chunk_size) {
+        array.chunk_shift += 1;
+    }
+    return array;
+}
+
+template<typename Type>
+void DestroySegmentedArray(SegmentedArray<Type>* array) {
+    CTK_ASSERT(array->allocator != NULL);
+
+    for (uint32 i = 0; i < array->chunk_count; i += 1) {
+        Deallocate(array->allocator, array->chunks[i]);
+    }
+    if (array->chunks != NULL) {
+        Deallocate(array->allocator, array->chunks);
+    }
+    *array = {};
+}
+
+template<typename Type>
+uint32 GetChunkCount(SegmentedArray<Type>* array) {
+    return (uint32)(((uint64)array->count + array->chunk_mask) >> array->chunk_shift);
+}
+
+template<typename Type>
+Type* GetChunk(SegmentedArray<Type>* array, uint32 chunk_index) {
+    CTK_ASSERT(chunk_index < array->chunk_count);
+
+    return array->chunks[chunk_index];
+}
+
+// Number of elements in use in chunk; only the last chunk can be partially filled.
+template<typename Type>
+uint32 GetChunkElemCount(SegmentedArray<Type>* array, uint32 chunk_index) {
+    uint32 chunk_start = chunk_index << array->chunk_shift;
+    return Min(array->count - chunk_start, GetChunkSize(array));
+}
+
+template<typename Type>
+Type* Push(SegmentedArray<Type>* array, Type elem) {
+    if (array->count == UINT32_MAX) {
+        CTK_FATAL("can't push element to segmented array: array is at max count of %u", UINT32_MAX);
+    }
+
+    ReserveChunks(array, array->count + 1);
+
+    Type* new_elem = &array->chunks[array->count >> array->chunk_shift][array->count & array->chunk_mask];
+    *new_elem = elem;
+    array->count += 1;
+    return new_elem;
+}
+
+template<typename Type>
+Type* Push(SegmentedArray<Type>* array) {
+    return Push(array, {});
+}
+
+// Bulk append; copies one chunk-sized region at a time.
+template<typename Type>
+void PushRange(SegmentedArray<Type>* array, const Type* data, uint32 data_size) {
+    if (data_size == 0) {
+        return;
+    }
+
+    if ((uint64)array->count + data_size > UINT32_MAX) {
+        CTK_FATAL("can't push %u elements to segmented array: array would exceed max count of %u",
+                  data_size, UINT32_MAX);
+    }
+
+    ReserveChunks(array, array->count + data_size);
+
+    while (data_size > 0) {
+        uint32 chunk_offset = array->count & array->chunk_mask;
+        uint32 copy_count   = Min(data_size, GetChunkSize(array) - chunk_offset);
+        memcpy(&array->chunks[array->count >> array->chunk_shift][chunk_offset], data, copy_count * sizeof(Type));
+        array->count += copy_count;
+        data         += copy_count;
+        data_size    -= copy_count;
+    }
+}
+
+template<typename Type>
+void PushRange(SegmentedArray<Type>* array, Array<Type>* other) {
+    PushRange(array, other->data, other->count);
+}
+
+// Keeps allocated chunks for reuse.
+template<typename Type>
+void Clear(SegmentedArray<Type>* array) {
+    array->count = 0;
+}
+
+template<typename Type>
+Type* GetPtr(SegmentedArray<Type>* array, uint32 index) {
+    CTK_ASSERT(index < array->count);
+
+    return &array->chunks[index >> array->chunk_shift][index & array->chunk_mask];
+}
+
+template<typename Type>
+Type Get(SegmentedArray<Type>* array, uint32 index) {
+    CTK_ASSERT(index < array->count);
+
+    return array->chunks[index >> array->chunk_shift][index & array->chunk_mask];
+}
+
+template<typename Type>
+void Set(SegmentedArray<Type>* array, uint32 index, Type val) {
+    CTK_ASSERT(index < array->count);
+
+    array->chunks[index >> array->chunk_shift][index & array->chunk_mask] = val;
+}
+
+template<typename Type>
+Type Pop(SegmentedArray<Type>* array) {
+    if (array->count == 0) {
+        CTK_FATAL("can't pop element from segmented array; array is empty");
+    }
+    array->count -= 1;
+    return array->chunks[array->count >> array->chunk_shift][array->count & array->chunk_mask];
+}
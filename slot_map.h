@@ -0,0 +1,182 @@
+/// Data
+////////////////////////////////////////////////////////////
+template<typename Type>
+struct SlotHnd {
+    uint32 index;
+    uint32 generation;
+};
+
+// For live slots, dense_index points into data; for free slots, it links to the next free slot.
+struct Slot {
+    uint32 dense_index;
+    uint32 generation;
+};
+
+// Sparse set: elements are packed contiguously in data for iteration, and handles index into slots, which map to
+// dense positions. Removal swaps the last element into the removed position, so insert, remove and lookup are O(1).
+// Each slot's generation is bumped on removal, so stale handles are detected rather than aliasing new elements.
+template<typename Type>
+struct SlotMap {
+    Allocator* allocator;
+    Type*      data;
+    uint32*    dense_slots;
+    Slot*      slots;
+    uint32     size;
+    uint32     count;
+    uint32     next_free;
+};
+
+constexpr uint32 SLOT_MAP_NO_FREE_SLOT = UINT32_MAX;
+
+/// Utils
+////////////////////////////////////////////////////////////
+template<typename Type>
+void LinkFreeSlots(SlotMap<Type>* map, uint32 start, uint32 end) {
+    for (uint32 i = start; i < end; i += 1) {
+        map->slots[i].dense_index = i + 1 < end ? i + 1 : map->next_free;
+    }
+    map->next_free = start;
+}
+
+template<typename Type>
+void Grow(SlotMap<Type>* map) {
+    uint32 new_size = map->size * 2;
+    map->data        = ReallocateNZ(map->allocator, map->data,        new_size);
+    map->dense_slots = ReallocateNZ(map->allocator, map->dense_slots, new_size);
+    map->slots       = ReallocateNZ(map->allocator, map->slots,       new_size);
+    for (uint32 i = map->size; i < new_size; i += 1) {
+        map->slots[i].generation = 1;
+    }
+    LinkFreeSlots(map, map->size, new_size);
+    map->size = new_size;
+}
+
+/// CTK_ITER Interface
+////////////////////////////////////////////////////////////
+template<typename Type>
+Type* IterStart(SlotMap<Type>* map) {
+    return map->data;
+}
+
+template<typename Type>
+Type* IterEnd(SlotMap<Type>* map) {
+    return map->data + map->count;
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+template<typename Type>
+SlotMap<Type> CreateSlotMap(Allocator* allocator, uint32 size) {
+    CTK_ASSERT(size > 0);
+
+    SlotMap<Type> map = {};
+    map.allocator   = allocator;
+    map.data        = AllocateNZ<Type>(allocator, size);
+    map.dense_slots = AllocateNZ<uint32>(allocator, size);
+    map.slots       = AllocateNZ<Slot>(allocator, size);
+    map.size        = size;
+    map.count       = 0;
+    map.next_free   = SLOT_MAP_NO_FREE_SLOT;
+
+    // Generations start at 1 so a zero-initialized handle is never valid.
+    for (uint32 i = 0; i < size; i += 1) {
+        map.slots[i].generation = 1;
+    }
+    LinkFreeSlots(&map, 0, size);
+
+    return map;
+}
+
+template<typename Type>
+void DestroySlotMap(SlotMap<Type>* map) {
+    CTK_ASSERT(map->allocator != NULL);
+
+    Deallocate(map->allocator, map->data);
+    Deallocate(map->allocator, map->dense_slots);
+    Deallocate(map->allocator, map->slots);
+    *map = {};
+}
+
+template<typename Type>
+bool IsValid(SlotMap<Type>* map, SlotHnd<Type> hnd) {
+    return hnd.index < map->size && map->slots[hnd.index].generation == hnd.generation &&
+           map->slots[hnd.index].dense_index < map->count &&
+           map->dense_slots[map->slots[hnd.index].dense_index] == hnd.index;
+}
+
+// Grows map if full; pointers into data are invalidated by growth, handles aren't.
+template<typename Type>
+SlotHnd<Type> Insert(SlotMap<Type>* map, Type elem) {
+    if (map->next_free == SLOT_MAP_NO_FREE_SLOT) {
+        Grow(map);
+    }
+
+    uint32 slot_index = map->next_free;
+    Slot* slot = &map->slots[slot_index];
+    map->next_free = slot->dense_index;
+
+    slot->dense_index = map->count;
+    map->data[map->count]        = elem;
+    map->dense_slots[map->count] = slot_index;
+    map->count += 1;
+
+    return { .index = slot_index, .generation = slot->generation };
+}
+
+template<typename Type>
+SlotHnd<Type> Insert(SlotMap<Type>* map) {
+    return Insert(map, {});
+}
+
+template<typename Type>
+Type* GetData(SlotMap<Type>* map, SlotHnd<Type> hnd) {
+    if (!IsValid(map, hnd)) {
+        CTK_FATAL("can't get data from slot map handle: handle (index %u, generation %u) is not valid",
+                  hnd.index, hnd.generation);
+    }
+
+    return &map->data[map->slots[hnd.index].dense_index];
+}
+
+// Returns handle for element at dense index, e.g. for removing elements found during iteration.
+template<typename Type>
+SlotHnd<Type> GetHnd(SlotMap<Type>* map, uint32 dense_index) {
+    CTK_ASSERT(dense_index < map->count);
+
+    uint32 slot_index = map->dense_slots[dense_index];
+    return { .index = slot_index, .generation = map->slots[slot_index].generation };
+}
+
+// Swap-remove: last element is moved into removed element's position, so element order isn't preserved.
+template<typename Type>
+void Remove(SlotMap<Type>* map, SlotHnd<Type> hnd) {
+    if (!IsValid(map, hnd)) {
+        CTK_FATAL("can't remove from slot map: handle (index %u, generation %u) is not valid",
+                  hnd.index, hnd.generation);
+    }
+
+    Slot* slot = &map->slots[hnd.index];
+    uint32 last = map->count - 1;
+    if (slot->dense_index != last) {
+        uint32 last_slot_index = map->dense_slots[last];
+        map->data[slot->dense_index]        = map->data[last];
+        map->dense_slots[slot->dense_index] = last_slot_index;
+        map->slots[last_slot_index].dense_index = slot->dense_index;
+    }
+    map->count -= 1;
+
+    slot->generation += 1;
+    slot->dense_index = map->next_free;
+    map->next_free = hnd.index;
+}
+
+// Invalidates all handles.
+template<typename Type>
+void Clear(SlotMap<Type>* map) {
+    for (uint32 i = 0; i < map->count; i += 1) {
+        map->slots[map->dense_slots[i]].generation += 1;
+    }
+    map->count     = 0;
+    map->next_free = SLOT_MAP_NO_FREE_SLOT;
+    LinkFreeSlots(map, 0, map->size);
+}
@@ -0,0 +1,158 @@
+/// Data
+////////////////////////////////////////////////////////////
+
+// Struct-of-arrays container: each field in Fields is stored in its own column so loops that only touch some fields
+// only pull those fields through cache. Columns are aligned to SOA_COLUMN_ALIGNMENT so they can be fed directly to
+// SIMD kernels.
+template<typename ...Fields>
+struct SoAArray {
+    Allocator* allocator;
+    void*      columns[sizeof...(Fields)];
+    uint32     size;
+    uint32     count;
+};
+
+constexpr uint32 SOA_COLUMN_ALIGNMENT = 64;
+
+/// Utils
+////////////////////////////////////////////////////////////
+template<uint32 column, typename Field, typename ...Rest>
+struct SoAField {
+    using Type = typename SoAField<column - 1, Rest...>::Type;
+};
+
+template<typename Field, typename ...Rest>
+struct SoAField<0, Field, Rest...> {
+    using Type = Field;
+};
+
+// Prevents field types from being deduced from value arguments, so Push(&array, 1, 2.0f) works for
+// SoAArray<uint32, float32> without casts.
+template<typename Field>
+struct SoAValue {
+    using Type = Field;
+};
+
+template<typename ...Fields>
+void ResizeColumns(SoAArray<Fields...>* array, uint32 new_size) {
+    uint32 column = 0;
+    ((array->columns[column] = array->columns[column] == NULL
+        ? AllocateNZ(array->allocator, new_size * SizeOf32<Fields>(), SOA_COLUMN_ALIGNMENT)
+        : ReallocateNZ(array->allocator, array->columns[column], new_size * SizeOf32<Fields>(), SOA_COLUMN_ALIGNMENT),
+      column += 1), ...);
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+template<typename ...Fields>
+SoAArray<Fields...> CreateSoAArray(Allocator* allocator, uint32 size = 0) {
+    static_assert(sizeof...(Fields) > 0);
+
+    SoAArray<Fields...> array = {};
+    array.allocator = allocator;
+    array.size      = 0;
+    array.count     = 0;
+    if (size > 0) {
+        ResizeColumns(&array, size);
+        array.size = size;
+    }
+    return array;
+}
+
+template<typename ...Fields>
+void DestroySoAArray(SoAArray<Fields...>* array) {
+    CTK_ASSERT(array->allocator != NULL);
+
+    CTK_ITER_ARRAY(column, array->columns) {
+        if (*column != NULL) {
+            Deallocate(array->allocator, *column);
+        }
+    }
+    *array = {};
+}
+
+template<typename ...Fields>
+void Resize(SoAArray<Fields...>* array, uint32 new_size) {
+    if (new_size == 0) {
+        Allocator* allocator = array->allocator;
+        DestroySoAArray(array);
+        array->allocator = allocator;
+        return;
+    }
+
+    ResizeColumns(array, new_size);
+    array->size = new_size;
+    if (array->count > new_size) {
+        array->count = new_size;
+    }
+}
+
+template<uint32 column, typename ...Fields>
+typename SoAField<column, Fields...>::Type* GetColumn(SoAArray<Fields...>* array) {
+    static_assert(column < sizeof...(Fields));
+    return (typename SoAField<column, Fields...>::Type*)array->columns[column];
+}
+
+template<typename ...Fields>
+bool CanPush(SoAArray<Fields...>* array, uint32 count) {
+    return array->count + count <= array->size;
+}
+
+// Returns index of pushed element.
+template<typename ...Fields>
+uint32 Push(SoAArray<Fields...>* array, typename SoAValue<Fields>::Type... values) {
+    if (array->count == array->size) {
+        CTK_FATAL("can't push element to SoA array: no space available");
+    }
+
+    uint32 index  = array->count;
+    uint32 column = 0;
+    ((((Fields*)array->columns[column])[index] = values, column += 1), ...);
+    array->count += 1;
+    return index;
+}
+
+template<typename ...Fields>
+uint32 PushResize(SoAArray<Fields...>* array, uint32 additional_space, typename SoAValue<Fields>::Type... values) {
+    if (!CanPush(array, 1)) {
+        Resize(array, array->size + additional_space);
+    }
+    return Push(array, values...);
+}
+
+// Swap-remove: last element is moved into index, so element order isn't preserved.
+template<typename ...Fields>
+void Remove(SoAArray<Fields...>* array, uint32 index) {
+    CTK_ASSERT(index < array->count);
+
+    uint32 last   = array->count - 1;
+    uint32 column = 0;
+    ((((Fields*)array->columns[column])[index] = ((Fields*)array->columns[column])[last], column += 1), ...);
+    array->count -= 1;
+}
+
+template<typename ...Fields>
+void Clear(SoAArray<Fields...>* array) {
+    array->count = 0;
+}
+
+template<uint32 column, typename ...Fields>
+typename SoAField<column, Fields...>::Type* GetPtr(SoAArray<Fields...>* array, uint32 index) {
+    CTK_ASSERT(index < array->count);
+
+    return &GetColumn<column>(array)[index];
+}
+
+template<uint32 column, typename ...Fields>
+typename SoAField<column, Fields...>::Type Get(SoAArray<Fields...>* array, uint32 index) {
+    CTK_ASSERT(index < array->count);
+
+    return GetColumn<column>(array)[index];
+}
+
+template<uint32 column, typename ...Fields>
+void Set(SoAArray<Fields...>* array, uint32 index, typename SoAField<column, Fields...>::Type val) {
+    CTK_ASSERT(index < array->count);
+
+    GetColumn<column>(array)[index] = val;
+}
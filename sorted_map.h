@@ -0,0 +1,189 @@
+/// Data
+////////////////////////////////////////////////////////////
+
+// Keys are kept sorted in their own array, separate from values, so searches only pull keys through cache. Lookups are
+// O(log n) and inserts/removes are O(n) memmoves; for insert-heavy workloads use BTreeMap.
+template<typename Key, typename Value>
+struct SortedMap {
+    Allocator* allocator;
+    Key*       keys;
+    Value*     values;
+    uint32     size;
+    uint32     count;
+};
+
+// Half-open range of indexes into a sorted map's keys/values.
+struct SortedMapRange {
+    uint32 start;
+    uint32 end;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+
+// Branchless binary search: the loop has a fixed trip count for a given count and the comparison compiles to a cmov,
+// so there are no mispredicted branches.
+template<typename Key>
+uint32 LowerBound(const Key* keys, uint32 count, Key key) {
+    if (count == 0) {
+        return 0;
+    }
+
+    const Key* base = keys;
+    uint32 remaining = count;
+    while (remaining > 1) {
+        uint32 half = remaining / 2;
+        base = base[half] < key ? base + half : base;
+        remaining -= half;
+    }
+    return (uint32)(base - keys) + (*base < key ? 1 : 0);
+}
+
+template<typename Key>
+uint32 UpperBound(const Key* keys, uint32 count, Key key) {
+    if (count == 0) {
+        return 0;
+    }
+
+    const Key* base = keys;
+    uint32 remaining = count;
+    while (remaining > 1) {
+        uint32 half = remaining / 2;
+        base = key < base[half] ? base : base + half;
+        remaining -= half;
+    }
+    return (uint32)(base - keys) + (key < *base ? 0 : 1);
+}
+
+template<typename Key, typename Value>
+sint32 ComparePairKeys(const void* a, const void* b) {
+    Key a_key = ((const Pair<Key, Value>*)a)->key;
+    Key b_key = ((const Pair<Key, Value>*)b)->key;
+    return a_key < b_key ? -1 : b_key < a_key ? 1 : 0;
+}
+
+template<typename Key, typename Value>
+void Resize(SortedMap<Key, Value>* map, uint32 new_size) {
+    CTK_ASSERT(new_size >= map->count);
+
+    map->keys   = map->size == 0 ? AllocateNZ<Key>  (map->allocator, new_size)
+                                 : ReallocateNZ(map->allocator, map->keys,   new_size);
+    map->values = map->size == 0 ? AllocateNZ<Value>(map->allocator, new_size)
+                                 : ReallocateNZ(map->allocator, map->values, new_size);
+    map->size   = new_size;
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+template<typename Key, typename Value>
+SortedMap<Key, Value> CreateSortedMap(Allocator* allocator, uint32 size = 0) {
+    SortedMap<Key, Value> map = {};
+    map.allocator = allocator;
+    map.count     = 0;
+    if (size > 0) {
+        Resize(&map, size);
+    }
+    return map;
+}
+
+// Bulk build from unsorted pairs in O(n log n), rather than O(n^2) for inserting pairs one at a time.
+template<typename Key, typename Value>
+SortedMap<Key, Value> CreateSortedMap(Allocator* allocator, const Pair<Key, Value>* pairs, uint32 pair_count) {
+    SortedMap<Key, Value> map = CreateSortedMap<Key, Value>(allocator, pair_count);
+    if (pair_count == 0) {
+        return map;
+    }
+
+    auto sorted_pairs = AllocateNZ<Pair<Key, Value>>(allocator, pair_count);
+    memcpy(sorted_pairs, pairs, pair_count * sizeof(Pair<Key, Value>));
+    qsort(sorted_pairs, pair_count, sizeof(Pair<Key, Value>), ComparePairKeys<Key, Value>);
+
+    for (uint32 i = 0; i < pair_count; i += 1) {
+        if (i > 0 && !(sorted_pairs[i - 1].key < sorted_pairs[i].key)) {
+            Deallocate(allocator, sorted_pairs);
+            DestroySortedMap(&map);
+            CTK_FATAL("can't create sorted map from pairs: pairs contain duplicate keys");
+        }
+        map.keys  [i] = sorted_pairs[i].key;
+        map.values[i] = sorted_pairs[i].value;
+    }
+    map.count = pair_count;
+
+    Deallocate(allocator, sorted_pairs);
+    return map;
+}
+
+template<typename Key, typename Value>
+void DestroySortedMap(SortedMap<Key, Value>* map) {
+    CTK_ASSERT(map->allocator != NULL);
+
+    if (map->size > 0) {
+        Deallocate(map->allocator, map->keys);
+        Deallocate(map->allocator, map->values);
+    }
+    *map = {};
+}
+
+template<typename Key, typename Value>
+uint32 FindValueIndex(SortedMap<Key, Value>* map, Key key) {
+    uint32 index = LowerBound(map->keys, map->count, key);
+    return index < map->count && !(key < map->keys[index]) ? index : UINT32_MAX;
+}
+
+template<typename Key, typename Value>
+Value* FindValue(SortedMap<Key, Value>* map, Key key) {
+    uint32 index = FindValueIndex(map, key);
+    return index == UINT32_MAX ? NULL : &map->values[index];
+}
+
+// Grows map if full.
+template<typename Key, typename Value>
+Value* Insert(SortedMap<Key, Value>* map, Key key, Value value) {
+    uint32 index = LowerBound(map->keys, map->count, key);
+    if (index < map->count && !(key < map->keys[index])) {
+        CTK_FATAL("can't insert key/value pair into sorted map: key already exists in map");
+    }
+
+    if (map->count == map->size) {
+        Resize(map, map->size == 0 ? 8 : map->size * 2);
+    }
+
+    memmove(&map->keys  [index + 1], &map->keys  [index], (map->count - index) * sizeof(Key));
+    memmove(&map->values[index + 1], &map->values[index], (map->count - index) * sizeof(Value));
+    map->keys[index] = key;
+    Value* new_value = &map->values[index];
+    *new_value = value;
+    map->count += 1;
+    return new_value;
+}
+
+template<typename Key, typename Value>
+Value* Insert(SortedMap<Key, Value>* map, Key key) {
+    return Insert(map, key, {});
+}
+
+template<typename Key, typename Value>
+void Remove(SortedMap<Key, Value>* map, Key key) {
+    uint32 index = FindValueIndex(map, key);
+    if (index == UINT32_MAX) {
+        CTK_FATAL("can't remove sorted map entry with key: key does not exist in map");
+    }
+
+    memmove(&map->keys  [index], &map->keys  [index + 1], (map->count - index - 1) * sizeof(Key));
+    memmove(&map->values[index], &map->values[index + 1], (map->count - index - 1) * sizeof(Value));
+    map->count -= 1;
+}
+
+template<typename Key, typename Value>
+void Clear(SortedMap<Key, Value>* map) {
+    map->count = 0;
+}
+
+// Range of entries with keys in [min_key, max_key).
+template<typename Key, typename Value>
+SortedMapRange GetRange(SortedMap<Key, Value>* map, Key min_key, Key max_key) {
+    SortedMapRange range = {};
+    range.start = LowerBound(map->keys, map->count, min_key);
+    range.end   = Max(range.start, LowerBound(map->keys, map->count, max_key));
+    return range;
+}
@@ -25,6 +25,10 @@ String CreateString(Allocator* allocator, String* src_string) {
     return CreateArray(allocator, src_string);
 }
 
+String CreateString(Allocator* allocator, StringView src_string) {
+    return CreateArray(allocator, src_string.data, src_string.size);
+}
+
 String CreateStringFull(Allocator* allocator, uint32 size) {
     return CreateArrayFull<char>(allocator, size);
 }
@@ -37,6 +41,22 @@ String WrapString(char* string, uint32 size) {
     return WrapArray(string, size);
 }
 
+StringView ViewString(String* string) {
+    return { .data = string->data, .size = string->count };
+}
+
+uint64 Hash(String* string, uint64 seed = 0) {
+    return Hash(string->data, string->count, seed);
+}
+
+// Writes Hash() of each string to hashes.
+void HashStrings(const String* strings, uint32 string_count, uint64* hashes, uint64 seed = 0) {
+    uint64 mixed_seed = MixHashSeed(seed);
+    for (uint32 i = 0; i < string_count; i += 1) {
+        hashes[i] = HashMixedSeed((const uint8*)strings[i].data, strings[i].count, mixed_seed);
+    }
+}
+
 void PushRange(String* string, const char* nt_src_string) {
     PushRange(string, nt_src_string, StringSize(nt_src_string));
 }
@@ -58,6 +78,39 @@ void Append(String* string, const char* fmt_string, Args... args) {
     string->count += chars_to_append <= remaining_space ? chars_to_append : remaining_space;
 }
 
+uint32 GetMaxFormatSize(String* string) {
+    return string->count;
+}
+
+uint32 FormatValue(char* buffer, uint32 buffer_size, String* string) {
+    uint32 size = Min(string->count, buffer_size);
+    memcpy(buffer, string->data, size);
+    return size;
+}
+
+// Grows string through its allocator if needed; strings without an allocator (e.g. from WrapString()) are truncated.
+template<typename Type>
+void AppendValue(String* string, Type value) {
+    uint32 max_size = GetMaxFormatSize(value);
+    if (string->allocator != NULL && string->count + max_size > string->size) {
+        ResizeNZ(string, Max(string->size * 2, string->count + max_size));
+    }
+    string->count += FormatValue(&string->data[string->count], string->size - string->count, value);
+}
+
+// Typed alternative to Append() that formats each arg by type instead of parsing a printf format string, e.g.
+// AppendValues(&line, "id: ", id, " pos: ", AlignRight(x, 8), ", ", y, " mask: 0x", Hex(mask, 8)).
+template<typename ...Args>
+void AppendValues(String* string, Args... args) {
+    (AppendValue(string, args), ...);
+}
+
+template<typename ...Args>
+void WriteValues(String* string, Args... args) {
+    string->count = 0;
+    AppendValues(string, args...);
+}
+
 bool StringsMatch(String* string_a, const char* string_b, uint32 string_b_size) {
     return StringsMatch(string_a->data, string_a->count, string_b, string_b_size);
 }
@@ -0,0 +1,283 @@
+/// Macros
+////////////////////////////////////////////////////////////
+#define CTK_VIEW_STRING(LITERAL) ViewString(LITERAL, sizeof(LITERAL) - 1)
+
+#define CTK_ITER_SPLIT(VAR, STRING_VIEW, DELIMITER) \
+    for (auto VAR = SplitString(STRING_VIEW, DELIMITER); \
+         IsValid(&VAR); \
+         Next(&VAR))
+
+#define CTK_ITER_TOKENS(VAR, STRING_VIEW, NT_DELIMITERS) \
+    for (auto VAR = TokenizeString(STRING_VIEW, NT_DELIMITERS); \
+         IsValid(&VAR); \
+         Next(&VAR))
+
+/// Data
+////////////////////////////////////////////////////////////
+
+// Non-owning view of chars that aren't necessarily null-terminated. Views are passed by value and never copy or free
+// their data, so they're only valid as long as the memory they point into.
+struct StringView {
+    const char* data;
+    uint32      size;
+};
+
+// Iterates tokens separated by delimiter, including empty tokens between adjacent delimiters, so "a,,b" splits into
+// "a", "" and "b". token points into string.
+struct StringSplitter {
+    StringView string;
+    StringView token;
+    uint32     next_index;
+    char       delimiter;
+    bool       valid;
+};
+
+// Iterates non-empty runs of chars not in a set of delimiters, so " a  b " tokenizes into "a" and "b". Delimiters are
+// stored as a 256-bit lookup table, so each char test is a single bit read.
+struct StringTokenizer {
+    StringView string;
+    StringView token;
+    uint32     next_index;
+    uint64     delimiter_bits[4];
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+bool IsWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+bool IsDelimiter(StringTokenizer* tokenizer, char c) {
+    uint8 byte = (uint8)c;
+    return (tokenizer->delimiter_bits[byte / 64] >> (byte % 64)) & 1;
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+StringView ViewString(const char* string, uint32 size) {
+    return { .data = string, .size = size };
+}
+
+StringView ViewString(const char* nt_string) {
+    return { .data = nt_string, .size = StringSize(nt_string) };
+}
+
+// Sub-view of size chars starting at index.
+StringView GetSubstring(StringView string, uint32 index, uint32 size) {
+    if (index > string.size || size > string.size - index) {
+        CTK_FATAL("can't get substring [%u, %u) of string view with size %u: range out of bounds",
+                  index, index + size, string.size);
+    }
+
+    return { .data = &string.data[index], .size = size };
+}
+
+// Sub-view from index to end of string.
+StringView GetSubstring(StringView string, uint32 index) {
+    if (index > string.size) {
+        CTK_FATAL("can't get substring starting at %u of string view with size %u: index out of bounds",
+                  index, string.size);
+    }
+
+    return { .data = &string.data[index], .size = string.size - index };
+}
+
+StringView TrimLeft(StringView string) {
+    uint32 index = 0;
+    while (index < string.size && IsWhitespace(string.data[index])) {
+        index += 1;
+    }
+    return { .data = &string.data[index], .size = string.size - index };
+}
+
+StringView TrimRight(StringView string) {
+    uint32 size = string.size;
+    while (size > 0 && IsWhitespace(string.data[size - 1])) {
+        size -= 1;
+    }
+    return { .data = string.data, .size = size };
+}
+
+// Removes leading and trailing spaces, tabs and newlines.
+StringView Trim(StringView string) {
+    return TrimRight(TrimLeft(string));
+}
+
+bool StringsMatch(StringView string_a, StringView string_b) {
+    return StringsMatch(string_a.data, string_a.size, string_b.data, string_b.size);
+}
+
+bool StringsMatch(StringView string_a, const char* string_b, uint32 string_b_size) {
+    return StringsMatch(string_a.data, string_a.size, string_b, string_b_size);
+}
+
+bool StringsMatch(StringView string_a, const char* nt_string_b) {
+    return StringsMatch(string_a.data, string_a.size, nt_string_b, StringSize(nt_string_b));
+}
+
+bool StartsWith(StringView string, StringView prefix) {
+    return prefix.size <= string.size && StringsMatch(string.data, prefix.data, prefix.size);
+}
+
+bool StartsWith(StringView string, const char* nt_prefix) {
+    return StartsWith(string, ViewString(nt_prefix));
+}
+
+bool EndsWith(StringView string, StringView suffix) {
+    return suffix.size <= string.size &&
+           StringsMatch(&string.data[string.size - suffix.size], suffix.data, suffix.size);
+}
+
+bool EndsWith(StringView string, const char* nt_suffix) {
+    return EndsWith(string, ViewString(nt_suffix));
+}
+
+// Returns index of first occurrence of c, or STRING_NOT_FOUND.
+uint32 FindChar(StringView string, char c) {
+    return FindChar(string.data, string.size, c);
+}
+
+// Returns index of first occurrence of substring, or STRING_NOT_FOUND.
+uint32 FindSubstring(StringView string, StringView substring) {
+    return FindSubstring(string.data, string.size, substring.data, substring.size);
+}
+
+uint32 FindSubstring(StringView string, const char* nt_substring) {
+    return FindSubstring(string.data, string.size, nt_substring, StringSize(nt_substring));
+}
+
+bool IsSubstring(StringView string, StringView substring) {
+    return IsSubstring(string.data, string.size, substring.data, substring.size);
+}
+
+bool IsSubstring(StringView string, const char* substring, uint32 substring_size) {
+    return IsSubstring(string.data, string.size, substring, substring_size);
+}
+
+bool IsSubstring(StringView string, const char* nt_substring) {
+    return IsSubstring(string.data, string.size, nt_substring, StringSize(nt_substring));
+}
+
+bool Contains(StringView string, char c) {
+    return Contains(string.data, string.size, c);
+}
+
+template<typename FloatType>
+FloatType ToFloat(StringView string) {
+    return ToFloat<FloatType>(string.data, string.size);
+}
+
+#define STRING_VIEW_TO_FLOAT_FUNC(BITS) \
+float##BITS ToFloat##BITS(StringView string) { \
+    return ToFloat##BITS(string.data, string.size); \
+}
+STRING_VIEW_TO_FLOAT_FUNC(32)
+STRING_VIEW_TO_FLOAT_FUNC(64)
+
+template<typename IntType>
+IntType ToInt(StringView string) {
+    return ToInt<IntType>(string.data, string.size);
+}
+
+template<typename IntType>
+IntParseResult<IntType> TryToInt(StringView string) {
+    return TryToInt<IntType>(string.data, string.size);
+}
+
+#define STRING_VIEW_TO_INT_FUNC(SIGN, SIGN_UPPER, BITS) \
+SIGN##int##BITS To##SIGN_UPPER##Int##BITS(StringView string) { \
+    return To##SIGN_UPPER##Int##BITS(string.data, string.size); \
+}
+STRING_VIEW_TO_INT_FUNC(s, S, 8)
+STRING_VIEW_TO_INT_FUNC(s, S, 16)
+STRING_VIEW_TO_INT_FUNC(s, S, 32)
+STRING_VIEW_TO_INT_FUNC(s, S, 64)
+STRING_VIEW_TO_INT_FUNC(u, U, 8)
+STRING_VIEW_TO_INT_FUNC(u, U, 16)
+STRING_VIEW_TO_INT_FUNC(u, U, 32)
+STRING_VIEW_TO_INT_FUNC(u, U, 64)
+
+bool ToBool(StringView string) {
+    return ToBool(string.data, string.size);
+}
+
+uint32 GetMaxFormatSize(StringView string) {
+    return string.size;
+}
+
+uint32 FormatValue(char* buffer, uint32 buffer_size, StringView string) {
+    uint32 size = Min(string.size, buffer_size);
+    memcpy(buffer, string.data, size);
+    return size;
+}
+
+/// Splitting
+////////////////////////////////////////////////////////////
+bool IsValid(StringSplitter* splitter) {
+    return splitter->valid;
+}
+
+void Next(StringSplitter* splitter) {
+    // Index past end means the last token (which had no delimiter after it) has already been returned.
+    if (splitter->next_index > splitter->string.size) {
+        splitter->valid = false;
+        splitter->token = {};
+        return;
+    }
+
+    StringView remaining = GetSubstring(splitter->string, splitter->next_index);
+    uint32 token_size = FindChar(remaining, splitter->delimiter);
+    if (token_size == STRING_NOT_FOUND) {
+        token_size = remaining.size;
+    }
+    splitter->token = GetSubstring(remaining, 0, token_size);
+    splitter->next_index += token_size + 1;
+}
+
+// Delimiters are found with FindChar(), so long tokens are scanned with SIMD.
+StringSplitter SplitString(StringView string, char delimiter) {
+    StringSplitter splitter = {};
+    splitter.string     = string;
+    splitter.next_index = 0;
+    splitter.delimiter  = delimiter;
+    splitter.valid      = true;
+    Next(&splitter);
+    return splitter;
+}
+
+bool IsValid(StringTokenizer* tokenizer) {
+    return tokenizer->token.data != NULL;
+}
+
+void Next(StringTokenizer* tokenizer) {
+    const char* chars = tokenizer->string.data;
+    uint32      size  = tokenizer->string.size;
+    uint32      index = tokenizer->next_index;
+    while (index < size && IsDelimiter(tokenizer, chars[index])) {
+        index += 1;
+    }
+    if (index == size) {
+        tokenizer->next_index = size;
+        tokenizer->token = {};
+        return;
+    }
+
+    uint32 token_start = index;
+    while (index < size && !IsDelimiter(tokenizer, chars[index])) {
+        index += 1;
+    }
+    tokenizer->token = { .data = &chars[token_start], .size = index - token_start };
+    tokenizer->next_index = index;
+}
+
+StringTokenizer TokenizeString(StringView string, const char* nt_delimiters) {
+    StringTokenizer tokenizer = {};
+    tokenizer.string     = string;
+    tokenizer.next_index = 0;
+    for (const char* delimiter = nt_delimiters; *delimiter != '\0'; delimiter += 1) {
+        uint8 byte = (uint8)*delimiter;
+        tokenizer.delimiter_bits[byte / 64] |= 1ull << (byte % 64);
+    }
+    Next(&tokenizer);
+    return tokenizer;
+}
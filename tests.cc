@@ -2,6 +2,10 @@
 using namespace CTK;
 
 // Core
+#include "ctk/tests/c_string.h"
+#include "ctk/tests/format.h"
+#include "ctk/tests/string_view.h"
+#include "ctk/tests/hash.h"
 #include "ctk/tests/f_array.h"
 #include "ctk/tests/f_string.h"
 #include "ctk/tests/math.h"
@@ -12,10 +16,25 @@ using namespace CTK;
 
 // Collections
 #include "ctk/tests/array.h"
+#include "ctk/tests/s_array.h"
+#include "ctk/tests/soa_array.h"
+#include "ctk/tests/segmented_array.h"
 #include "ctk/tests/string.h"
+#include "ctk/tests/unicode.h"
+#include "ctk/tests/queue.h"
+#include "ctk/tests/bitset.h"
+#include "ctk/tests/slot_map.h"
+#include "ctk/tests/priority_queue.h"
+#include "ctk/tests/sorted_map.h"
+#include "ctk/tests/b_tree_map.h"
+#include "ctk/tests/intern_table.h"
 
 // System
 #include "ctk/tests/json.h"
+#include "ctk/tests/json_document.h"
+#include "ctk/tests/json_parallel.h"
+#include "ctk/tests/json_reader.h"
+#include "ctk/tests/json_writer.h"
 #include "ctk/tests/window.h"
 #include "ctk/tests/thread_pool.h"
 
@@ -23,28 +42,56 @@ using namespace CTK;
 #include "ctk/tests/profile.h"
 
 // Performance Tests
+#include "ctk/tests/perf_utils.h"
 #include "ctk/tests/json_perf.h"
+#include "ctk/tests/json_writer_perf.h"
+#include "ctk/tests/json_parallel_perf.h"
 #include "ctk/tests/free_list_perf.h"
 #include "ctk/tests/iterator_perf.h"
+#include "ctk/tests/soa_array_perf.h"
+#include "ctk/tests/priority_queue_perf.h"
+#include "ctk/tests/c_string_perf.h"
+#include "ctk/tests/format_perf.h"
+#include "ctk/tests/unicode_perf.h"
+#include "ctk/tests/hash_perf.h"
 
 sint32 main() {
     SetShowPassedTests(true);
 
     // Core
-    RunTest("FArray",   NULL, FArrayTest::Run);
-    RunTest("FString",  NULL, FStringTest::Run);
-    RunTest("Math",     NULL, MathTest::Run);
+    RunTest("CString",    NULL, CStringTest::Run);
+    RunTest("Format",     NULL, FormatTest::Run);
+    RunTest("StringView", NULL, StringViewTest::Run);
+    RunTest("Hash",       NULL, HashTest::Run);
+    RunTest("FArray",     NULL, FArrayTest::Run);
+    RunTest("FString",    NULL, FStringTest::Run);
+    RunTest("Math",       NULL, MathTest::Run);
 
     // Allocators
     RunTest("Stack",    NULL, StackTest::Run);
     RunTest("FreeList", NULL, FreeListTest::Run);
 
     // Collections
-    RunTest("Array",    NULL, ArrayTest::Run);
-    RunTest("String",   NULL, StringTest::Run);
+    RunTest("Array",          NULL, ArrayTest::Run);
+    RunTest("SArray",         NULL, SArrayTest::Run);
+    RunTest("SoAArray",       NULL, SoAArrayTest::Run);
+    RunTest("SegmentedArray", NULL, SegmentedArrayTest::Run);
+    RunTest("String",         NULL, StringTest::Run);
+    RunTest("Unicode",        NULL, UnicodeTest::Run);
+    RunTest("Queue",          NULL, QueueTest::Run);
+    RunTest("Bitset",         NULL, BitsetTest::Run);
+    RunTest("SlotMap",        NULL, SlotMapTest::Run);
+    RunTest("PriorityQueue",  NULL, PriorityQueueTest::Run);
+    RunTest("SortedMap",      NULL, SortedMapTest::Run);
+    RunTest("BTreeMap",       NULL, BTreeMapTest::Run);
+    RunTest("InternTable",    NULL, InternTableTest::Run);
 
     // System
-    RunTest("JSON",     NULL, JSONTest::Run);
+    RunTest("JSON",         NULL, JSONTest::Run);
+    RunTest("JSONDocument", NULL, JSONDocumentTest::Run);
+    RunTest("JSONParallel", NULL, JSONParallelTest::Run);
+    RunTest("JSONReader",   NULL, JSONReaderTest::Run);
+    RunTest("JSONWriter",   NULL, JSONWriterTest::Run);
 
     ShowTestStats();
 
@@ -54,7 +101,15 @@ sint32 main() {
 
     // FreeListPerfTest::Run();
     // JSONPerfTest::Run();
+    // JSONWriterPerfTest::Run();
+    // JSONParallelPerfTest::Run();
     // IteratorPerfTest::Run();
+    // SoAArrayPerfTest::Run();
+    // PriorityQueuePerfTest::Run();
+    // CStringPerfTest::Run();
+    // FormatPerfTest::Run();
+    // UnicodePerfTest::Run();
+    // HashPerfTest::Run();
 
     return 0;
 }
@@ -0,0 +1,144 @@
+#pragma once
+
+namespace BTreeMapTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 KEY_COUNT = 10000;
+
+/// Utils
+////////////////////////////////////////////////////////////
+
+// 7919 is coprime with KEY_COUNT, so keys are inserted in scrambled order.
+uint32 GetScrambledKey(uint32 i) {
+    return (i * 7919) % KEY_COUNT;
+}
+
+bool TestInOrder(BTreeMap<uint32, uint32>* map, uint32 expected_count) {
+    bool pass = true;
+
+    if (!ExpectEqual("map->count", expected_count, map->count)) {
+        pass = false;
+    }
+
+    uint32 iter_count = 0;
+    bool sorted = true;
+    bool values_match = true;
+    uint32 prev_key = 0;
+    CTK_ITER_BTREE(cursor, map) {
+        uint32 key = GetKey(&cursor);
+        if (iter_count > 0 && !(prev_key < key)) {
+            sorted = false;
+        }
+        if (*GetValue(&cursor) != key * 2) {
+            values_match = false;
+        }
+        prev_key = key;
+        iter_count += 1;
+    }
+
+    if (!ExpectEqual("iterated count", expected_count, iter_count)) {
+        pass = false;
+    }
+
+    if (!ExpectEqual("keys are iterated in order", true, sorted)) {
+        pass = false;
+    }
+
+    if (!ExpectEqual("values match keys", true, values_match)) {
+        pass = false;
+    }
+
+    return pass;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool InsertTest() {
+    bool pass = true;
+
+    auto map = CreateBTreeMap<uint32, uint32>(&g_std_allocator);
+    for (uint32 i = 0; i < KEY_COUNT; i += 1) {
+        uint32 key = GetScrambledKey(i);
+        Insert(&map, key, key * 2);
+    }
+    RunTest("Insert() x10000", &pass, TestInOrder, &map, KEY_COUNT);
+    RunTest("map.root->leaf", &pass, ExpectEqual, false, map.root->leaf);
+    RunTest("*FindValue(&map, 1234)", &pass, ExpectEqual, 2468u, *FindValue(&map, 1234u));
+    RunTest("FindValue(&map, KEY_COUNT)", &pass, ExpectEqual, true, FindValue(&map, KEY_COUNT) == NULL);
+    RunTest<Func<uint32*, BTreeMap<uint32, uint32>*, uint32, uint32>>(
+        "Insert() with existing key", &pass, ExpectFatalError, Insert, &map, 1234u, 0u);
+
+    DestroyBTreeMap(&map);
+
+    return pass;
+}
+
+bool RangeTest() {
+    bool pass = true;
+
+    auto map = CreateBTreeMap<uint32, uint32>(&g_std_allocator);
+    for (uint32 i = 0; i < KEY_COUNT; i += 1) {
+        uint32 key = GetScrambledKey(i);
+        Insert(&map, key * 2, key * 4); // Even keys only.
+    }
+
+    // Range [1001, 2001) should contain even keys 1002..2000.
+    uint32 range_count = 0;
+    uint32 first_key = 0;
+    for (auto cursor = LowerBound(&map, 1001u); IsValid(&cursor) && GetKey(&cursor) < 2001; Next(&cursor)) {
+        if (range_count == 0) {
+            first_key = GetKey(&cursor);
+        }
+        range_count += 1;
+    }
+    RunTest("range [1001, 2001) first key", &pass, ExpectEqual, 1002u, first_key);
+    RunTest("range [1001, 2001) count",     &pass, ExpectEqual, 500u,  range_count);
+
+    auto end_cursor = LowerBound(&map, KEY_COUNT * 2);
+    RunTest("LowerBound(&map, max + 1)", &pass, ExpectEqual, false, IsValid(&end_cursor));
+
+    DestroyBTreeMap(&map);
+
+    return pass;
+}
+
+bool RemoveTest() {
+    bool pass = true;
+
+    auto map = CreateBTreeMap<uint32, uint32>(&g_std_allocator);
+    for (uint32 i = 0; i < KEY_COUNT; i += 1) {
+        Insert(&map, i, i * 2);
+    }
+
+    // Remove all keys but every 100th, leaving many empty leaves.
+    for (uint32 i = 0; i < KEY_COUNT; i += 1) {
+        if (i % 100 != 0) {
+            Remove(&map, i);
+        }
+    }
+    RunTest("Remove() x9900", &pass, TestInOrder, &map, 100u);
+    RunTest("FindValue(&map, 101)", &pass, ExpectEqual, true, FindValue(&map, 101u) == NULL);
+    RunTest<Func<void, BTreeMap<uint32, uint32>*, uint32>>(
+        "Remove() with missing key", &pass, ExpectFatalError, Remove, &map, 101u);
+
+    // Removed keys can be reinserted.
+    Insert(&map, 101u, 202u);
+    RunTest("Insert() removed key", &pass, TestInOrder, &map, 101u);
+
+    DestroyBTreeMap(&map);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("InsertTest()", &pass, InsertTest);
+    RunTest("RangeTest()",  &pass, RangeTest);
+    RunTest("RemoveTest()", &pass, RemoveTest);
+
+    return pass;
+}
+
+}
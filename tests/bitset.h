@@ -0,0 +1,158 @@
+#pragma once
+
+namespace BitsetTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 OP_BIT_COUNT = 1000;
+
+/// Utils
+////////////////////////////////////////////////////////////
+void SetRandomBits(Bitset* bitset, bool* bools) {
+    Clear(bitset);
+    for (uint32 i = 0; i < bitset->bit_count; i += 1) {
+        bools[i] = RandomRange(0u, 3u) == 0;
+        if (bools[i]) {
+            SetBit(bitset, i);
+        }
+    }
+}
+
+bool TestBitsetMatches(Bitset* bitset, bool* expected_bools) {
+    bool matches = true;
+    uint32 expected_count = 0;
+    for (uint32 i = 0; i < bitset->bit_count; i += 1) {
+        if (TestBit(bitset, i) != expected_bools[i]) {
+            matches = false;
+        }
+        expected_count += expected_bools[i] ? 1 : 0;
+    }
+
+    bool pass = true;
+
+    if (!ExpectEqual("bits match", true, matches)) {
+        pass = false;
+    }
+
+    if (!ExpectEqual("CountSetBits(bitset)", expected_count, CountSetBits(bitset))) {
+        pass = false;
+    }
+
+    return pass;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool FBitsetTest() {
+    bool pass = true;
+
+    FBitset<130> bitset = {};
+    RunTest("FindFirstSet(&bitset) (empty)", &pass, ExpectEqual, 130u, FindFirstSet(&bitset));
+
+    SetBit(&bitset, 3);
+    SetBit(&bitset, 64);
+    SetBit(&bitset, 129);
+    RunTest("TestBit(&bitset, 64)", &pass, ExpectEqual, true,  TestBit(&bitset, 64));
+    RunTest("TestBit(&bitset, 65)", &pass, ExpectEqual, false, TestBit(&bitset, 65));
+    RunTest("CountSetBits(&bitset)", &pass, ExpectEqual, 3u, CountSetBits(&bitset));
+
+    uint32 expected_bits[] = { 3, 64, 129 };
+    uint32 iter_count = 0;
+    CTK_ITER_BITS(bit, &bitset) {
+        RunTest("CTK_ITER_BITS(bit, &bitset)", &pass, ExpectEqual, expected_bits[iter_count], bit);
+        iter_count += 1;
+    }
+    RunTest("CTK_ITER_BITS() iteration count", &pass, ExpectEqual, 3u, iter_count);
+
+    ClearBit(&bitset, 3);
+    RunTest("ClearBit(&bitset, 3); FindFirstSet(&bitset)", &pass, ExpectEqual, 64u, FindFirstSet(&bitset));
+    RunTest("FindNextSet(&bitset, 65)", &pass, ExpectEqual, 129u, FindNextSet(&bitset, 65));
+
+    // Bits past bit count in last word must stay clear.
+    SetAll(&bitset);
+    RunTest("SetAll(&bitset); CountSetBits(&bitset)", &pass, ExpectEqual, 130u, CountSetBits(&bitset));
+
+    Clear(&bitset);
+    RunTest("Clear(&bitset); CountSetBits(&bitset)", &pass, ExpectEqual, 0u, CountSetBits(&bitset));
+
+    return pass;
+}
+
+bool OpTest() {
+    bool pass = true;
+
+    Bitset a   = CreateBitset(&g_std_allocator, OP_BIT_COUNT);
+    Bitset b   = CreateBitset(&g_std_allocator, OP_BIT_COUNT);
+    Bitset dst = CreateBitset(&g_std_allocator, OP_BIT_COUNT);
+    bool a_bools[OP_BIT_COUNT]        = {};
+    bool b_bools[OP_BIT_COUNT]        = {};
+    bool expected_bools[OP_BIT_COUNT] = {};
+    RandomSeed(1);
+    SetRandomBits(&a, a_bools);
+    SetRandomBits(&b, b_bools);
+    RunTest("SetBit() x random", &pass, TestBitsetMatches, &a, a_bools);
+
+    And(&dst, &a, &b);
+    for (uint32 i = 0; i < OP_BIT_COUNT; i += 1) {
+        expected_bools[i] = a_bools[i] && b_bools[i];
+    }
+    RunTest("And(&dst, &a, &b)", &pass, TestBitsetMatches, &dst, expected_bools);
+
+    Or(&dst, &a, &b);
+    for (uint32 i = 0; i < OP_BIT_COUNT; i += 1) {
+        expected_bools[i] = a_bools[i] || b_bools[i];
+    }
+    RunTest("Or(&dst, &a, &b)", &pass, TestBitsetMatches, &dst, expected_bools);
+
+    Xor(&dst, &a, &b);
+    for (uint32 i = 0; i < OP_BIT_COUNT; i += 1) {
+        expected_bools[i] = a_bools[i] != b_bools[i];
+    }
+    RunTest("Xor(&dst, &a, &b)", &pass, TestBitsetMatches, &dst, expected_bools);
+
+    AndNot(&dst, &a, &b);
+    for (uint32 i = 0; i < OP_BIT_COUNT; i += 1) {
+        expected_bools[i] = a_bools[i] && !b_bools[i];
+    }
+    RunTest("AndNot(&dst, &a, &b)", &pass, TestBitsetMatches, &dst, expected_bools);
+
+    DestroyBitset(&a);
+    DestroyBitset(&b);
+    DestroyBitset(&dst);
+
+    return pass;
+}
+
+bool ResizeTest() {
+    bool pass = true;
+
+    Bitset bitset = CreateBitset(&g_std_allocator, 70);
+    SetAll(&bitset);
+
+    Resize(&bitset, 65);
+    RunTest("Resize(&bitset, 65); CountSetBits(&bitset)", &pass, ExpectEqual, 65u, CountSetBits(&bitset));
+
+    // Bits cut off by shrinking must not reappear when growing.
+    Resize(&bitset, 300);
+    RunTest("Resize(&bitset, 300); CountSetBits(&bitset)", &pass, ExpectEqual, 65u, CountSetBits(&bitset));
+    RunTest("FindNextSet(&bitset, 65)", &pass, ExpectEqual, 300u, FindNextSet(&bitset, 65));
+
+    SetBit(&bitset, 299);
+    RunTest("SetBit(&bitset, 299); FindNextSet(&bitset, 65)", &pass, ExpectEqual, 299u, FindNextSet(&bitset, 65));
+
+    DestroyBitset(&bitset);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("FBitsetTest()", &pass, FBitsetTest);
+    RunTest("OpTest()",      &pass, OpTest);
+    RunTest("ResizeTest()",  &pass, ResizeTest);
+
+    return pass;
+}
+
+}
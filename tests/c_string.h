@@ -0,0 +1,319 @@
+#pragma once
+
+namespace CStringTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 BUFFER_SIZE = 256;
+
+/// Utils
+////////////////////////////////////////////////////////////
+
+// Fills buffer with a repeating pattern that has many partial matches for "abcab".
+void FillBuffer(char* buffer, uint32 size) {
+    for (uint32 i = 0; i < size; i += 1) {
+        buffer[i] = "abcaxabca"[i % 9];
+    }
+}
+
+template<typename FloatType>
+bool BitsMatch(FloatType a, FloatType b) {
+    return memcmp(&a, &b, sizeof(FloatType)) == 0;
+}
+
+template<typename FloatType>
+bool MatchesStrtod(const char* nt_string) {
+    return BitsMatch(ToFloat<FloatType>(nt_string), Strtod_ToFloat<FloatType>(nt_string, StringSize(nt_string)));
+}
+
+// Random bit patterns (excluding infinity and NaN) printed with enough digits to round-trip.
+template<typename FloatType, typename Bits>
+bool RoundTripRandomFloats(uint32 count, const char* fmt_string) {
+    uint64 random_state = RandomSeed64(1);
+    char buffer[64] = {};
+    for (uint32 i = 0; i < count; i += 1) {
+        Bits bits = (Bits)Random64(&random_state);
+        FloatType value = 0;
+        memcpy(&value, &bits, sizeof(value));
+        if (!isfinite(value)) {
+            continue;
+        }
+
+        Write(buffer, sizeof(buffer), fmt_string, value);
+        if (!BitsMatch(value, ToFloat<FloatType>(buffer))) {
+            PrintLine("    round-trip failed for %s", buffer);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Random digit strings covering long mantissas, leading zeros and exponents near the under/overflow limits.
+template<typename FloatType>
+bool MatchStrtodRandomStrings(uint32 count) {
+    uint64 random_state = RandomSeed64(2);
+    char buffer[128] = {};
+    for (uint32 i = 0; i < count; i += 1) {
+        uint32 size = 0;
+        if (Random64(&random_state) % 2 == 0) {
+            buffer[size++] = '-';
+        }
+
+        uint32 digit_count = 1 + (uint32)(Random64(&random_state) % 40);
+        uint32 decimal_index = (uint32)(Random64(&random_state) % (digit_count + 1));
+        uint32 leading_zeros = Random64(&random_state) % 4 == 0 ? (uint32)(Random64(&random_state) % 20) : 0;
+        for (uint32 digit = 0; digit < digit_count; digit += 1) {
+            if (digit == decimal_index) {
+                buffer[size++] = '.';
+            }
+            buffer[size++] = digit < leading_zeros ? '0' : (char)('0' + (Random64(&random_state) % 10));
+        }
+
+        sint32 max_exponent = sizeof(FloatType) == sizeof(float32) ? 50 : 350;
+        sint32 exponent = (sint32)(Random64(&random_state) % (2 * max_exponent + 1)) - max_exponent;
+        Write(&buffer[size], sizeof(buffer) - size, "e%i", exponent);
+
+        if (!MatchesStrtod<FloatType>(buffer)) {
+            PrintLine("    mismatch with strtod for %s", buffer);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename IntType>
+bool TryToIntMatches(const char* nt_string, IntParseStatus expected_status, IntType expected_value) {
+    IntParseResult<IntType> result = TryToInt<IntType>(nt_string);
+    if (result.status != expected_status || result.value != expected_value) {
+        PrintLine("    TryToInt(\"%s\"): expected status %u value %lld, got status %u value %lld", nt_string,
+                  (uint32)expected_status, (sint64)expected_value, (uint32)result.status, (sint64)result.value);
+        return false;
+    }
+
+    return true;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool StringSizeTest() {
+    bool pass = true;
+
+    alignas(32) char buffer[BUFFER_SIZE] = {};
+    FillBuffer(buffer, BUFFER_SIZE - 1);
+
+    // Every start offset and terminator position, so all alignments and block boundaries are covered.
+    bool sse2_match = true;
+    bool avx2_match = true;
+    for (uint32 start = 0; start < 64; start += 1)
+    for (uint32 end = start; end < BUFFER_SIZE - 1; end += 7) {
+        char prev = buffer[end];
+        buffer[end] = '\0';
+        uint32 expected = end - start;
+        sse2_match &= SSE2_StringSize(&buffer[start]) == expected;
+        avx2_match &= !HasAVX2() || AVX2_StringSize(&buffer[start]) == expected;
+        buffer[end] = prev;
+    }
+    RunTest("SSE2_StringSize() matches scalar", &pass, ExpectEqual, true, sse2_match);
+    RunTest("AVX2_StringSize() matches scalar", &pass, ExpectEqual, true, avx2_match);
+    RunTest("StringSize(NULL)", &pass, ExpectEqual, 0u, StringSize(NULL));
+    RunTest("StringSize(\"\")", &pass, ExpectEqual, 0u, StringSize(""));
+
+    return pass;
+}
+
+bool StringsMatchTest() {
+    bool pass = true;
+
+    char a[BUFFER_SIZE] = {};
+    char b[BUFFER_SIZE] = {};
+    FillBuffer(a, BUFFER_SIZE);
+    FillBuffer(b, BUFFER_SIZE);
+
+    bool sse2_match = true;
+    bool avx2_match = true;
+    for (uint32 size = 0; size < 100; size += 1) {
+        sse2_match &= SSE2_StringsMatch(a, b, size);
+        avx2_match &= !HasAVX2() || AVX2_StringsMatch(a, b, size);
+
+        // Mismatch at each position within size.
+        for (uint32 i = 0; i < size; i += 1) {
+            b[i] = '#';
+            sse2_match &= !SSE2_StringsMatch(a, b, size);
+            avx2_match &= !HasAVX2() || !AVX2_StringsMatch(a, b, size);
+            b[i] = a[i];
+        }
+    }
+    RunTest("SSE2_StringsMatch() matches scalar", &pass, ExpectEqual, true, sse2_match);
+    RunTest("AVX2_StringsMatch() matches scalar", &pass, ExpectEqual, true, avx2_match);
+    RunTest("StringsMatch(\"test\", \"test\")", &pass, ExpectEqual, true,  StringsMatch("test", "test"));
+    RunTest("StringsMatch(\"test\", \"tests\")", &pass, ExpectEqual, false, StringsMatch("test", "tests"));
+
+    return pass;
+}
+
+bool FindTest() {
+    bool pass = true;
+
+    char buffer[BUFFER_SIZE] = {};
+    FillBuffer(buffer, BUFFER_SIZE);
+    const char* substrings[] = {
+        "a", "x", "ax", "abcab", "abcaxabcaa", "xabcaxabcaxabcaxabcaxabcaxabcaxabcaxabca", "#"
+    };
+
+    bool sse2_match = true;
+    bool avx2_match = true;
+    for (uint32 size = 0; size < 120; size += 1) {
+        buffer[size] = '#'; // Put single occurrence of '#' at end.
+        sse2_match &= SSE2_FindChar(buffer, size + 1, 'x') == Scalar_FindChar(buffer, size + 1, 'x');
+        sse2_match &= SSE2_FindChar(buffer, size + 1, '#') == size;
+        avx2_match &= !HasAVX2() || AVX2_FindChar(buffer, size + 1, '#') == size;
+        CTK_ITER_ARRAY(substring, substrings) {
+            uint32 substring_size = StringSize(*substring);
+            uint32 expected = Scalar_FindSubstring(buffer, size + 1, *substring, substring_size);
+            sse2_match &= SSE2_FindSubstring(buffer, size + 1, *substring, substring_size) == expected;
+            avx2_match &= !HasAVX2() || AVX2_FindSubstring(buffer, size + 1, *substring, substring_size) == expected;
+        }
+        buffer[size] = "abcaxabca"[size % 9];
+    }
+    RunTest("SSE2_FindChar()/SSE2_FindSubstring() match scalar", &pass, ExpectEqual, true, sse2_match);
+    RunTest("AVX2_FindChar()/AVX2_FindSubstring() match scalar", &pass, ExpectEqual, true, avx2_match);
+
+    RunTest("IsSubstring(\"this is a test\", \"a test\")", &pass,
+            ExpectEqual, true, IsSubstring("this is a test", "a test"));
+    RunTest("IsSubstring(\"this is a test\", \"a tesT\")", &pass,
+            ExpectEqual, false, IsSubstring("this is a test", "a tesT"));
+    RunTest("FindSubstring(\"abc\", 3, \"\", 0)", &pass, ExpectEqual, 0u, FindSubstring("abc", 3, "", 0));
+    RunTest("Contains(\"abc\", 3, 'c')", &pass, ExpectEqual, true,  Contains("abc", 3, 'c'));
+    RunTest("Contains(\"abc\", 2, 'c')", &pass, ExpectEqual, false, Contains("abc", 2, 'c'));
+
+    return pass;
+}
+
+bool ToFloatTest() {
+    bool pass = true;
+
+    const char* edge_cases[] = {
+        "0", "-0", "0.0", "1", "0.1", "1e0", "1E+2", "1e-2", "123456789012345678", "9007199254740993",
+        "1.7976931348623157e308", "1.7976931348623159e308", "1e309", "2.2250738585072014e-308",
+        "2.2250738585072011e-308", "4.9406564584124654e-324", "2.4703282292062327e-324", "1e-400",
+        "3.4028234663852886e38", "3.4028236e38", "1.17549435e-38", "1.4e-45", "7.0064923216240854e-46",
+        "0.1000000000000000055511151231257827021181583404541015625",
+        "0.1000000000000000055511151231257827021181583404541015624",
+        "2.22507385850720113605740979670913197593481954635164564e-308",
+        "00000000000000000000000000000000000000000000000000000001.5",
+        "12345678901234567890123456789012345678901234567890",
+    };
+    bool float32_match = true;
+    bool float64_match = true;
+    CTK_ITER_ARRAY(edge_case, edge_cases) {
+        if (!MatchesStrtod<float32>(*edge_case)) {
+            PrintLine("    float32 mismatch with strtod for %s", *edge_case);
+            float32_match = false;
+        }
+        if (!MatchesStrtod<float64>(*edge_case)) {
+            PrintLine("    float64 mismatch with strtod for %s", *edge_case);
+            float64_match = false;
+        }
+    }
+    RunTest("ToFloat32() edge cases match strtof()", &pass, ExpectEqual, true, float32_match);
+    RunTest("ToFloat64() edge cases match strtod()", &pass, ExpectEqual, true, float64_match);
+
+    RunTest("ToFloat32() round-trips random floats", &pass,
+            ExpectEqual, true, RoundTripRandomFloats<float32, uint32>(100000, "%.9g"));
+    RunTest("ToFloat64() round-trips random floats", &pass,
+            ExpectEqual, true, RoundTripRandomFloats<float64, uint64>(100000, "%.17g"));
+    RunTest("ToFloat32() matches strtof() on random strings", &pass,
+            ExpectEqual, true, MatchStrtodRandomStrings<float32>(100000));
+    RunTest("ToFloat64() matches strtod() on random strings", &pass,
+            ExpectEqual, true, MatchStrtodRandomStrings<float64>(100000));
+
+    // Characters after the number are ignored; 'e' without exponent digits isn't part of the number.
+    RunTest("ToFloat64(\"1.5e3x\")", &pass, ExpectEqual, 1500.0, ToFloat64("1.5e3x"));
+    RunTest("ToFloat64(\"2e\")",     &pass, ExpectEqual, 2.0,    ToFloat64("2e"));
+    RunTest("ToFloat64(\"2e+\")",    &pass, ExpectEqual, 2.0,    ToFloat64("2e+"));
+    RunTest("ToFloat64(\" -.25 \")", &pass, ExpectEqual, -0.25,  ToFloat64(" -.25 "));
+    RunTest("ToFloat64(\"\")",       &pass, ExpectEqual, 0.0,    ToFloat64(""));
+    RunTest<Func<float64, const char*>>("ToFloat64(\"1.1.1\")", &pass, ExpectFatalError, ToFloat64, "1.1.1");
+
+    return pass;
+}
+
+bool ToIntTest() {
+    bool pass = true;
+
+    // Every digit count up to 24 (wrapping past 19 digits) followed by a non-digit, at every string offset, so all
+    // 16/8/1-digit step combinations and end-of-string cases are covered.
+    char buffer[64] = {};
+    uint64 random_state = RandomSeed64(1);
+    bool swar_match  = true;
+    bool sse41_match = true;
+    for (uint32 digit_count = 0; digit_count <= 24; digit_count += 1)
+    for (uint32 offset = 0; offset < 8; offset += 1)
+    for (uint32 size_padding = 0; size_padding < 2; size_padding += 1) {
+        for (uint32 i = 0; i < offset + digit_count; i += 1) {
+            buffer[i] = (char)('0' + (Random64(&random_state) % 10));
+        }
+        buffer[offset + digit_count] = 'x';
+        uint32 size = offset + digit_count + size_padding;
+
+        uint64 expected_value = 0;
+        uint32 expected_index = Scalar_AccumulateDigits(buffer, size, offset, &expected_value);
+        uint64 value = 0;
+        swar_match &= SWAR_AccumulateDigits(buffer, size, offset, &value) == expected_index &&
+                      value == expected_value;
+        value = 0;
+        sse41_match &= !HasSSE41() || (SSE41_AccumulateDigits(buffer, size, offset, &value) == expected_index &&
+                                       value == expected_value);
+    }
+    RunTest("SWAR_AccumulateDigits() matches scalar",  &pass, ExpectEqual, true, swar_match);
+    RunTest("SSE41_AccumulateDigits() matches scalar", &pass, ExpectEqual, true, sse41_match);
+    RunTest("ToUInt64(\"12345678901234567890\")", &pass,
+            ExpectEqual, (uint64)12345678901234567890ull, ToUInt64("12345678901234567890"));
+    RunTest("ToSInt64(\" -1234567890123456789x\")", &pass,
+            ExpectEqual, (sint64)-1234567890123456789ll, ToSInt64(" -1234567890123456789x"));
+
+    bool try_to_int_match = true;
+    try_to_int_match &= TryToIntMatches<sint8> ("127",  IntParseStatus::SUCCESS,      (sint8)127);
+    try_to_int_match &= TryToIntMatches<sint8> ("128",  IntParseStatus::OUT_OF_RANGE, (sint8)0);
+    try_to_int_match &= TryToIntMatches<sint8> ("-128", IntParseStatus::SUCCESS,      (sint8)-128);
+    try_to_int_match &= TryToIntMatches<sint8> ("-129", IntParseStatus::OUT_OF_RANGE, (sint8)0);
+    try_to_int_match &= TryToIntMatches<uint8> ("255",  IntParseStatus::SUCCESS,      (uint8)255);
+    try_to_int_match &= TryToIntMatches<uint8> ("256",  IntParseStatus::OUT_OF_RANGE, (uint8)0);
+    try_to_int_match &= TryToIntMatches<uint32>("-1",   IntParseStatus::OUT_OF_RANGE, 0u);
+    try_to_int_match &= TryToIntMatches<uint32>("-0",   IntParseStatus::SUCCESS,      0u);
+    try_to_int_match &= TryToIntMatches<uint32>("",     IntParseStatus::INVALID,      0u);
+    try_to_int_match &= TryToIntMatches<uint32>("-",    IntParseStatus::INVALID,      0u);
+    try_to_int_match &= TryToIntMatches<uint32>(" 1",   IntParseStatus::INVALID,      0u);
+    try_to_int_match &= TryToIntMatches<uint32>("1 ",   IntParseStatus::INVALID,      0u);
+    try_to_int_match &= TryToIntMatches<uint32>("12a",  IntParseStatus::INVALID,      0u);
+    try_to_int_match &= TryToIntMatches<uint32>("4294967295", IntParseStatus::SUCCESS,      4294967295u);
+    try_to_int_match &= TryToIntMatches<uint32>("4294967296", IntParseStatus::OUT_OF_RANGE, 0u);
+    try_to_int_match &= TryToIntMatches<uint32>("0000000000000000000000000042", IntParseStatus::SUCCESS, 42u);
+    try_to_int_match &= TryToIntMatches<sint64>("-9223372036854775808", IntParseStatus::SUCCESS,
+                                                (sint64)(0 - 9223372036854775808ull));
+    try_to_int_match &= TryToIntMatches<sint64>("9223372036854775808",  IntParseStatus::OUT_OF_RANGE, 0ll);
+    try_to_int_match &= TryToIntMatches<uint64>("18446744073709551615", IntParseStatus::SUCCESS,
+                                                18446744073709551615ull);
+    try_to_int_match &= TryToIntMatches<uint64>("18446744073709551616", IntParseStatus::OUT_OF_RANGE, 0ull);
+    try_to_int_match &= TryToIntMatches<uint64>("99999999999999999999", IntParseStatus::OUT_OF_RANGE, 0ull);
+    try_to_int_match &= TryToIntMatches<uint64>("100000000000000000000", IntParseStatus::OUT_OF_RANGE, 0ull);
+    RunTest("TryToInt() status and value", &pass, ExpectEqual, true, try_to_int_match);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("StringSizeTest()",   &pass, StringSizeTest);
+    RunTest("StringsMatchTest()", &pass, StringsMatchTest);
+    RunTest("FindTest()",         &pass, FindTest);
+    RunTest("ToFloatTest()",      &pass, ToFloatTest);
+    RunTest("ToIntTest()",        &pass, ToIntTest);
+
+    return pass;
+}
+
+}
@@ -0,0 +1,232 @@
+#pragma once
+
+namespace CStringPerfTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 BUFFER_SIZE = 1024 * 1024;
+constexpr uint32 TEST_PASSES = 100;
+constexpr uint32 NUMBER_COUNT = 1000000;
+
+// Numbers stored back to back in chars, with their offsets and sizes.
+struct NumberStrings {
+    char*   chars;
+    uint32* offsets;
+    uint32* sizes;
+    uint32  total_size;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+// Profiles TEST_PASSES calls of TestFunc over the BUFFER_SIZE test buffers.
+template<typename ReturnType, typename ...Args>
+void ProfileBufferFunc(const char* name, Func<ReturnType, Args...> TestFunc, Args... args) {
+    PerfUtils::ProfileFunc(name, BUFFER_SIZE, TEST_PASSES, TestFunc, args...);
+}
+
+// Generates NUMBER_COUNT numbers with fmt_string from random values in [0, 1) scaled by 10^[min_pow10, max_pow10].
+NumberStrings CreateNumberStrings(const char* fmt_string, sint32 min_pow10, sint32 max_pow10) {
+    NumberStrings numbers = {};
+    numbers.chars   = AllocateNZ<char>(&g_std_allocator, NUMBER_COUNT * 32);
+    numbers.offsets = AllocateNZ<uint32>(&g_std_allocator, NUMBER_COUNT);
+    numbers.sizes   = AllocateNZ<uint32>(&g_std_allocator, NUMBER_COUNT);
+    numbers.total_size = 0;
+
+    uint64 random_state = RandomSeed64(1);
+    for (uint32 i = 0; i < NUMBER_COUNT; i += 1) {
+        uint64 random = Random64(&random_state);
+        float64 value = (float64)(random >> 11) / (float64)(1ull << 53);
+        value *= pow(10.0, (float64)(min_pow10 + (sint32)(random % (uint64)(max_pow10 - min_pow10 + 1))));
+
+        numbers.offsets[i] = numbers.total_size;
+        numbers.sizes[i]   = (uint32)Write(&numbers.chars[numbers.total_size], 32, fmt_string, value);
+        numbers.total_size += numbers.sizes[i];
+    }
+
+    return numbers;
+}
+
+// Generates NUMBER_COUNT integers with uniformly random digit counts in [1, 19].
+NumberStrings CreateIntStrings() {
+    NumberStrings numbers = {};
+    numbers.chars   = AllocateNZ<char>(&g_std_allocator, NUMBER_COUNT * 32);
+    numbers.offsets = AllocateNZ<uint32>(&g_std_allocator, NUMBER_COUNT);
+    numbers.sizes   = AllocateNZ<uint32>(&g_std_allocator, NUMBER_COUNT);
+    numbers.total_size = 0;
+
+    uint64 random_state = RandomSeed64(2);
+    for (uint32 i = 0; i < NUMBER_COUNT; i += 1) {
+        uint32 digit_count = 1 + (uint32)(Random64(&random_state) % 19);
+
+        numbers.offsets[i] = numbers.total_size;
+        numbers.sizes[i]   = digit_count;
+        for (uint32 digit = 0; digit < digit_count; digit += 1) {
+            // No leading zeros, so digit counts are exact.
+            uint64 random = Random64(&random_state);
+            numbers.chars[numbers.total_size + digit] = digit == 0 ? (char)('1' + (random % 9))
+                                                                   : (char)('0' + (random % 10));
+        }
+        numbers.total_size += digit_count;
+    }
+
+    return numbers;
+}
+
+void DestroyNumberStrings(NumberStrings* numbers) {
+    Deallocate(&g_std_allocator, numbers->chars);
+    Deallocate(&g_std_allocator, numbers->offsets);
+    Deallocate(&g_std_allocator, numbers->sizes);
+    *numbers = {};
+}
+
+template<typename FloatType>
+void ProfileToFloatFunc(const char* name, Func<FloatType, const char*, uint32> TestFunc, NumberStrings* numbers) {
+    PerfUtils::VolatileFunc<FloatType, const char*, uint32> test_func = TestFunc;
+    float64 checksum = 0;
+    Profile prof = BeginProfile(name);
+    for (uint32 i = 0; i < NUMBER_COUNT; i += 1) {
+        checksum += test_func(&numbers->chars[numbers->offsets[i]], numbers->sizes[i]);
+    }
+    EndProfile(&prof);
+    PrintLine("    %-30s %8.2f ms  %7.2f MB/s  %6.2f M floats/s  (checksum %g)", name, prof.ms,
+              ((float64)numbers->total_size / (1024.0 * 1024.0)) / (prof.ms / 1000.0),
+              ((float64)NUMBER_COUNT / 1000000.0) / (prof.ms / 1000.0), checksum);
+}
+
+void PrintNumberProfile(Profile* prof, NumberStrings* numbers, uint64 checksum) {
+    PrintLine("    %-30s %8.2f ms  %7.2f MB/s  %6.2f M ints/s  (checksum %llu)", prof->name, prof->ms,
+              ((float64)numbers->total_size / (1024.0 * 1024.0)) / (prof->ms / 1000.0),
+              ((float64)NUMBER_COUNT / 1000000.0) / (prof->ms / 1000.0), checksum);
+}
+
+void ProfileAccumulateDigitsFunc(const char* name, Func<uint32, const char*, uint32, uint32, uint64*> TestFunc,
+                                 NumberStrings* numbers)
+{
+    PerfUtils::VolatileFunc<uint32, const char*, uint32, uint32, uint64*> test_func = TestFunc;
+    uint64 checksum = 0;
+    Profile prof = BeginProfile(name);
+    for (uint32 i = 0; i < NUMBER_COUNT; i += 1) {
+        uint64 value = 0;
+        test_func(&numbers->chars[numbers->offsets[i]], numbers->sizes[i], 0, &value);
+        checksum += value;
+    }
+    EndProfile(&prof);
+    PrintNumberProfile(&prof, numbers, checksum);
+}
+
+void ToIntPerfTest() {
+    NumberStrings numbers = CreateIntStrings();
+    PrintLine("\nToInt() Performance Test (%u random 1 to 19 digit integers)", NUMBER_COUNT);
+
+    ProfileAccumulateDigitsFunc("Scalar_AccumulateDigits()", Scalar_AccumulateDigits, &numbers);
+    ProfileAccumulateDigitsFunc("SWAR_AccumulateDigits()",   SWAR_AccumulateDigits,   &numbers);
+    if (HasSSE41()) {
+        ProfileAccumulateDigitsFunc("SSE41_AccumulateDigits()", SSE41_AccumulateDigits, &numbers);
+    }
+
+    PerfUtils::VolatileFunc<uint64, const char*, uint32> to_uint64 = ToUInt64;
+    uint64 checksum = 0;
+    Profile prof = BeginProfile("ToUInt64()");
+    for (uint32 i = 0; i < NUMBER_COUNT; i += 1) {
+        checksum += to_uint64(&numbers.chars[numbers.offsets[i]], numbers.sizes[i]);
+    }
+    EndProfile(&prof);
+    PrintNumberProfile(&prof, &numbers, checksum);
+
+    PerfUtils::VolatileFunc<IntParseResult<uint64>, const char*, uint32> try_to_uint64 = TryToInt<uint64>;
+    checksum = 0;
+    prof = BeginProfile("TryToInt<uint64>()");
+    for (uint32 i = 0; i < NUMBER_COUNT; i += 1) {
+        checksum += try_to_uint64(&numbers.chars[numbers.offsets[i]], numbers.sizes[i]).value;
+    }
+    EndProfile(&prof);
+    PrintNumberProfile(&prof, &numbers, checksum);
+
+    DestroyNumberStrings(&numbers);
+}
+
+void ToFloatPerfTest() {
+    struct NumberSet {
+        const char* desc;
+        const char* fmt_string;
+        sint32      min_pow10;
+        sint32      max_pow10;
+    };
+    NumberSet number_sets[] = {
+        { "short decimals (e.g. 1234.56)",      "%.2f",   0,    6   },
+        { "17-digit decimals (e.g. 0.1234...)", "%.17g",  0,    0   },
+        { "17-digit exponents (e.g. 1.23e-45)", "%.17e",  -300, 300 },
+    };
+
+    PrintLine("\nToFloat() Performance Test (%u numbers)", NUMBER_COUNT);
+    CTK_ITER_ARRAY(number_set, number_sets) {
+        NumberStrings numbers = CreateNumberStrings(number_set->fmt_string, number_set->min_pow10,
+                                                    number_set->max_pow10);
+        PrintLine("%s", number_set->desc);
+        ProfileToFloatFunc<float64>("Strtod_ToFloat<float64>()", Strtod_ToFloat<float64>, &numbers);
+        ProfileToFloatFunc<float64>("ToFloat64()",               ToFloat<float64>,        &numbers);
+        ProfileToFloatFunc<float32>("Strtod_ToFloat<float32>()", Strtod_ToFloat<float32>, &numbers);
+        ProfileToFloatFunc<float32>("ToFloat32()",               ToFloat<float32>,        &numbers);
+        DestroyNumberStrings(&numbers);
+    }
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+void StringPrimitivesPerfTest() {
+    PrintLine("\nCString Performance Test (%u KB buffer x %u passes)", BUFFER_SIZE / 1024, TEST_PASSES);
+
+    // Text-like buffer where only the last bytes differ, so every function scans the whole buffer.
+    char* a = AllocateNZ<char>(&g_std_allocator, BUFFER_SIZE + 1, 32);
+    char* b = AllocateNZ<char>(&g_std_allocator, BUFFER_SIZE + 1, 32);
+    for (uint32 i = 0; i < BUFFER_SIZE; i += 1) {
+        a[i] = "the quick brown fox jumps over the lazy dog "[i % 44];
+    }
+    memcpy(b, a, BUFFER_SIZE);
+    a[BUFFER_SIZE] = '\0';
+    b[BUFFER_SIZE] = '\0';
+    const char* substring = "the lazy dog#";
+    uint32 substring_size = StringSize(substring);
+    memcpy(&a[BUFFER_SIZE - substring_size], substring, substring_size);
+    const char* a_const = a;
+    const char* b_const = b;
+
+    PrintLine("StringSize()");
+    ProfileBufferFunc("Scalar_StringSize()", Scalar_StringSize, a_const);
+    ProfileBufferFunc("SSE2_StringSize()",   SSE2_StringSize,   a_const);
+    if (HasAVX2()) {
+        ProfileBufferFunc("AVX2_StringSize()", AVX2_StringSize, a_const);
+    }
+
+    PrintLine("StringsMatch()");
+    ProfileBufferFunc("Scalar_StringsMatch()", Scalar_StringsMatch, a_const, b_const, BUFFER_SIZE);
+    ProfileBufferFunc("SSE2_StringsMatch()",   SSE2_StringsMatch,   a_const, b_const, BUFFER_SIZE);
+    if (HasAVX2()) {
+        ProfileBufferFunc("AVX2_StringsMatch()", AVX2_StringsMatch, a_const, b_const, BUFFER_SIZE);
+    }
+
+    PrintLine("FindChar()");
+    ProfileBufferFunc("Scalar_FindChar()", Scalar_FindChar, a_const, BUFFER_SIZE, '#');
+    ProfileBufferFunc("SSE2_FindChar()",   SSE2_FindChar,   a_const, BUFFER_SIZE, '#');
+    if (HasAVX2()) {
+        ProfileBufferFunc("AVX2_FindChar()", AVX2_FindChar, a_const, BUFFER_SIZE, '#');
+    }
+
+    PrintLine("FindSubstring()");
+    ProfileBufferFunc("Scalar_FindSubstring()", Scalar_FindSubstring, a_const, BUFFER_SIZE, substring, substring_size);
+    ProfileBufferFunc("SSE2_FindSubstring()",   SSE2_FindSubstring,   a_const, BUFFER_SIZE, substring, substring_size);
+    if (HasAVX2()) {
+        ProfileBufferFunc("AVX2_FindSubstring()", AVX2_FindSubstring, a_const, BUFFER_SIZE, substring, substring_size);
+    }
+
+    Deallocate(&g_std_allocator, a);
+    Deallocate(&g_std_allocator, b);
+}
+
+void Run() {
+    StringPrimitivesPerfTest();
+    ToFloatPerfTest();
+    ToIntPerfTest();
+}
+
+}
@@ -0,0 +1,196 @@
+#pragma once
+
+namespace FormatTest {
+
+/// Utils
+////////////////////////////////////////////////////////////
+template<typename ...Args>
+bool WritesValues(const char* expected, Args... args) {
+    char buffer[256] = {};
+    uint32 size = WriteValues(buffer, sizeof(buffer), args...);
+    return ExpectEqual(expected, StringSize(expected), buffer, size);
+}
+
+template<typename ...Args>
+bool WritesValuesTruncated(const char* expected, uint32 buffer_size, Args... args) {
+    char buffer[256] = {};
+    uint32 size = WriteValues(buffer, buffer_size, args...);
+    return ExpectEqual(expected, StringSize(expected), buffer, size);
+}
+
+// Checks random floats round-trip through FormatFloat() and ToFloat(), and that output has the fewest significant
+// digits that round-trip, found by printing with increasing precision.
+template<typename FloatType, typename Bits>
+bool FormatsShortestRandomFloats(uint32 count, uint32 max_digits) {
+    uint64 random_state = RandomSeed64(1);
+    char buffer[FORMAT_MAX_NUMBER_SIZE] = {};
+    char reference[64] = {};
+    for (uint32 i = 0; i < count; i += 1) {
+        Bits bits = (Bits)Random64(&random_state);
+        FloatType value = 0;
+        memcpy(&value, &bits, sizeof(value));
+        if (!isfinite(value)) {
+            continue;
+        }
+
+        uint32 size = FormatFloat(buffer, value);
+        FloatType parsed = ToFloat<FloatType>(buffer, size);
+        if (memcmp(&parsed, &value, sizeof(value)) != 0) {
+            PrintLine("    %.*s doesn't round-trip", size, buffer);
+            return false;
+        }
+
+        uint32 digit_count = 0;
+        uint32 trailing_zeros = 0;
+        bool leading = true;
+        for (uint32 c = 0; c < size && buffer[c] != 'e'; c += 1) {
+            if (!IsDigit(buffer[c]) || (leading && buffer[c] == '0')) {
+                continue;
+            }
+            leading = false;
+            digit_count += 1;
+            trailing_zeros = buffer[c] == '0' ? trailing_zeros + 1 : 0;
+        }
+        digit_count -= trailing_zeros;
+
+        uint32 shortest_digit_count = max_digits;
+        for (uint32 digits = 1; digits < max_digits; digits += 1) {
+            Write(reference, sizeof(reference), "%.*e", digits - 1, value);
+            if (ToFloat<FloatType>(reference) == value) {
+                shortest_digit_count = digits;
+                break;
+            }
+        }
+        if (digit_count != shortest_digit_count) {
+            PrintLine("    %.*s has %u digits; shortest has %u", size, buffer, digit_count, shortest_digit_count);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool IntTest() {
+    bool pass = true;
+
+    RunTest("0",                    &pass, WritesValues, "0",                    0);
+    RunTest("9, 10, 99, 100",       &pass, WritesValues, "9 10 99 100",          9, ' ', 10, ' ', 99, ' ', 100);
+    RunTest("UINT8_MAX",            &pass, WritesValues, "255",                  (uint8)UINT8_MAX);
+    RunTest("SINT8_MIN",            &pass, WritesValues, "-128",                 (sint8)INT8_MIN);
+    RunTest("UINT32_MAX",           &pass, WritesValues, "4294967295",           (uint32)UINT32_MAX);
+    RunTest("SINT32_MIN",           &pass, WritesValues, "-2147483648",          (sint32)INT32_MIN);
+    RunTest("UINT64_MAX",           &pass, WritesValues, "18446744073709551615", (uint64)UINT64_MAX);
+    RunTest("SINT64_MIN",           &pass, WritesValues, "-9223372036854775808", (sint64)INT64_MIN);
+    RunTest("Hex(0xBEEF)",          &pass, WritesValues, "beef",                 Hex(0xBEEF));
+    RunTest("Hex(0xBEEF, 8, true)", &pass, WritesValues, "0000BEEF",             Hex(0xBEEF, 8, true));
+    RunTest("Hex(0)",               &pass, WritesValues, "0",                    Hex(0));
+    RunTest("Hex(UINT64_MAX)",      &pass, WritesValues, "ffffffffffffffff",     Hex(UINT64_MAX));
+
+    // Every power of 10 and its neighbours, covering each decimal length.
+    bool powers_match = true;
+    char expected[32] = {};
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(UINT64_POW10); i += 1) {
+        for (uint64 value = UINT64_POW10[i] - 1; value <= UINT64_POW10[i] + 1; value += 1) {
+            Write(expected, sizeof(expected), "%llu", (unsigned long long)value);
+            powers_match &= WritesValues(expected, value);
+        }
+    }
+    RunTest("powers of 10 match printf", &pass, ExpectEqual, true, powers_match);
+
+    return pass;
+}
+
+bool FloatTest() {
+    bool pass = true;
+
+    RunTest("0.0",                     &pass, WritesValues, "0",                       0.0);
+    RunTest("-0.0",                    &pass, WritesValues, "-0",                      -0.0);
+    RunTest("0.1",                     &pass, WritesValues, "0.1",                     0.1);
+    RunTest("0.1f",                    &pass, WritesValues, "0.1",                     0.1f);
+    RunTest("1.0 / 3.0",               &pass, WritesValues, "0.3333333333333333",      1.0 / 3.0);
+    RunTest("-123.456",                &pass, WritesValues, "-123.456",                -123.456);
+    RunTest("100.0",                   &pass, WritesValues, "100",                     100.0);
+    RunTest("1e20",                    &pass, WritesValues, "100000000000000000000",   1e20);
+    RunTest("1e21",                    &pass, WritesValues, "1e+21",                   1e21);
+    RunTest("1.5e300",                 &pass, WritesValues, "1.5e+300",                1.5e300);
+    RunTest("0.000001",                &pass, WritesValues, "0.000001",                0.000001);
+    RunTest("1e-7",                    &pass, WritesValues, "1e-7",                    1e-7);
+    RunTest("DBL_MAX",                 &pass, WritesValues, "1.7976931348623157e+308", 1.7976931348623157e308);
+    RunTest("DBL_TRUE_MIN",            &pass, WritesValues, "5e-324",                  4.9406564584124654e-324);
+    RunTest("FLT_MAX",                 &pass, WritesValues, "3.4028235e+38",           3.4028235e38f);
+    RunTest("FLT_TRUE_MIN",            &pass, WritesValues, "1e-45",                   1.4e-45f);
+    RunTest("INFINITY",                &pass, WritesValues, "inf",                     (float64)INFINITY);
+    RunTest("-INFINITY",               &pass, WritesValues, "-inf",                    -(float64)INFINITY);
+    RunTest("NAN",                     &pass, WritesValues, "nan",                     (float64)NAN);
+    RunTest("random float64s are shortest and round-trip", &pass,
+            FormatsShortestRandomFloats<float64, uint64>, 100000u, 17u);
+    RunTest("random float32s are shortest and round-trip", &pass,
+            FormatsShortestRandomFloats<float32, uint32>, 100000u, 9u);
+
+    return pass;
+}
+
+bool PadTest() {
+    bool pass = true;
+
+    RunTest("AlignRight(42, 6)",         &pass, WritesValues, "    42",  AlignRight(42, 6));
+    RunTest("AlignLeft(42, 6)",          &pass, WritesValues, "42    |", AlignLeft(42, 6), '|');
+    RunTest("AlignRight(-42, 6, '0')",   &pass, WritesValues, "-00042",  AlignRight(-42, 6, '0'));
+    RunTest("AlignRight(\"abc\", 5)",    &pass, WritesValues, "  abc",   AlignRight("abc", 5));
+    RunTest("AlignRight(123456, 3)",     &pass, WritesValues, "123456",  AlignRight(123456, 3));
+    RunTest("AlignRight(Hex(255), 4)",   &pass, WritesValues, "  ff",    AlignRight(Hex(255), 4));
+    RunTest("AlignRight(1.5, 5)",        &pass, WritesValues, "  1.5",   AlignRight(1.5, 5));
+    RunTest("true, false",               &pass, WritesValues, "true false", true, ' ', false);
+
+    // Output is cut off at buffer size rather than overflowing.
+    RunTest("truncated int",             &pass, WritesValuesTruncated, "1234",   4u, 123456789);
+    RunTest("truncated string",          &pass, WritesValuesTruncated, "x=ab",   4u, "x=", "abcdef");
+    RunTest("truncated AlignRight",      &pass, WritesValuesTruncated, "   1",   4u, AlignRight(12, 5));
+    RunTest("truncated AlignLeft",       &pass, WritesValuesTruncated, "12  ",   4u, AlignLeft(12, 5));
+
+    return pass;
+}
+
+bool StringTest() {
+    bool pass = true;
+
+    // String grows through its allocator.
+    String string = CreateString(&g_std_allocator, 4);
+    WriteValues(&string, "count: ", 1234567u, ", ratio: ", 0.25, ", flags: 0x", Hex(0xF00D, 8, true));
+    RunTest("WriteValues(&string)", &pass, ExpectEqual, "count: 1234567, ratio: 0.25, flags: 0x0000F00D", &string);
+    String suffix = CreateString(&g_std_allocator, "!!");
+    AppendValues(&string, ' ', &suffix, AlignRight(-5, 4));
+    RunTest("AppendValues(&string)", &pass, ExpectEqual,
+            "count: 1234567, ratio: 0.25, flags: 0x0000F00D !!  -5", &string);
+    DestroyString(&suffix);
+    DestroyString(&string);
+
+    // Wrapped strings have no allocator, so output is truncated.
+    char wrapped_data[8] = {};
+    String wrapped = WrapString(wrapped_data, sizeof(wrapped_data));
+    WriteValues(&wrapped, "value: ", 12345);
+    RunTest("WriteValues(&wrapped)", &pass, ExpectEqual, "value: 1", &wrapped);
+
+    FString<16> fstring = {};
+    WriteValues(&fstring, -1.5f, ' ', AlignRight(7u, 3, '0'));
+    RunTest("WriteValues(&fstring)", &pass, ExpectEqual, "-1.5 007", fstring.data, fstring.count);
+    AppendValues(&fstring, " overflowing");
+    RunTest("AppendValues(&fstring)", &pass, ExpectEqual, "-1.5 007 overflo", fstring.data, fstring.count);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("IntTest()",    &pass, IntTest);
+    RunTest("FloatTest()",  &pass, FloatTest);
+    RunTest("PadTest()",    &pass, PadTest);
+    RunTest("StringTest()", &pass, StringTest);
+
+    return pass;
+}
+
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+namespace FormatPerfTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 VALUE_COUNT = 1000000;
+
+/// Utils
+////////////////////////////////////////////////////////////
+template<typename Type>
+Type* CreateRandomValues(uint64 seed) {
+    uint64 random_state = RandomSeed64(seed);
+    auto values = AllocateNZ<Type>(&g_std_allocator, VALUE_COUNT);
+    for (uint32 i = 0; i < VALUE_COUNT; i += 1) {
+        uint64 random = Random64(&random_state);
+        if constexpr (sizeof(Type) == sizeof(uint64)) {
+            // Shift by random amount so values have uniformly random digit counts.
+            uint64 bits = random >> (random % 64);
+            memcpy(&values[i], &bits, sizeof(Type));
+        }
+        else {
+            values[i] = (Type)random;
+        }
+    }
+    return values;
+}
+
+void PrintFormatProfile(Profile* prof, uint64 total_size) {
+    PrintLine("    %-34s %8.2f ms  %6.2f M values/s  (%llu chars)", prof->name, prof->ms,
+              ((float64)VALUE_COUNT / 1000000.0) / (prof->ms / 1000.0), total_size);
+}
+
+template<typename Type>
+void ProfileWrite(const char* name, const char* fmt_string, Type* values) {
+    char buffer[64] = {};
+    uint64 total_size = 0;
+    Profile prof = BeginProfile(name);
+    for (uint32 i = 0; i < VALUE_COUNT; i += 1) {
+        total_size += Write(buffer, sizeof(buffer), fmt_string, values[i]);
+    }
+    EndProfile(&prof);
+    PrintFormatProfile(&prof, total_size);
+}
+
+template<typename Type>
+void ProfileWriteValues(const char* name, Type* values) {
+    PerfUtils::VolatileFunc<uint32, char*, uint32, Type> write_values = WriteValues<Type>;
+    char buffer[64] = {};
+    uint64 total_size = 0;
+    Profile prof = BeginProfile(name);
+    for (uint32 i = 0; i < VALUE_COUNT; i += 1) {
+        total_size += write_values(buffer, sizeof(buffer), values[i]);
+    }
+    EndProfile(&prof);
+    PrintFormatProfile(&prof, total_size);
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+void IntPerfTest() {
+    uint64* values = CreateRandomValues<uint64>(1);
+    PrintLine("\nInteger Formatting Performance Test (%u random 1 to 20 digit integers)", VALUE_COUNT);
+
+    ProfileWrite("Write(\"%llu\")",            "%llu", values);
+    ProfileWriteValues("WriteValues(uint64)", values);
+
+    Deallocate(&g_std_allocator, values);
+}
+
+void FloatPerfTest() {
+    float64* values = CreateRandomValues<float64>(2);
+    for (uint32 i = 0; i < VALUE_COUNT; i += 1) {
+        if (!isfinite(values[i])) {
+            values[i] = 0.0;
+        }
+    }
+    PrintLine("\nFloat Formatting Performance Test (%u random float64s)", VALUE_COUNT);
+
+    // %.17g always round-trips but isn't shortest; WriteValues() output is both.
+    ProfileWrite("Write(\"%.17g\")",            "%.17g", values);
+    ProfileWrite("Write(\"%g\")",               "%g",    values);
+    ProfileWriteValues("WriteValues(float64)", values);
+
+    Deallocate(&g_std_allocator, values);
+}
+
+void StringPerfTest() {
+    PrintLine("\nString Building Performance Test (%u appends)", VALUE_COUNT);
+
+    String string = CreateString(&g_std_allocator, VALUE_COUNT * 32);
+    Profile prof = BeginProfile("Append(\"id=%u, value=%.3f; \")");
+    for (uint32 i = 0; i < VALUE_COUNT; i += 1) {
+        if (string.count + 64 > string.size) {
+            Clear(&string);
+        }
+        Append(&string, "id=%u, value=%.3f; ", i, (float64)i * 0.125);
+    }
+    EndProfile(&prof);
+    PrintFormatProfile(&prof, string.count);
+
+    Clear(&string);
+    prof = BeginProfile("AppendValues(\"id=\", ..., \"; \")");
+    for (uint32 i = 0; i < VALUE_COUNT; i += 1) {
+        if (string.count + 64 > string.size) {
+            Clear(&string);
+        }
+        AppendValues(&string, "id=", i, ", value=", (float64)i * 0.125, "; ");
+    }
+    EndProfile(&prof);
+    PrintFormatProfile(&prof, string.count);
+
+    DestroyString(&string);
+}
+
+void Run() {
+    IntPerfTest();
+    FloatPerfTest();
+    StringPerfTest();
+}
+
+}
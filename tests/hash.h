@@ -0,0 +1,215 @@
+#pragma once
+
+namespace HashTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 DATA_SIZE = 4096;
+
+/// Utils
+////////////////////////////////////////////////////////////
+void FillRandom(uint8* bytes, uint32 size, uint64 seed) {
+    uint64 random_state = RandomSeed64(seed);
+    for (uint32 i = 0; i < size; i += 1) {
+        bytes[i] = (uint8)Random64(&random_state);
+    }
+}
+
+// Hashes of data[0, size) for every size up to max_size are all distinct.
+bool AllSizesDistinct(const uint8* data, uint32 max_size) {
+    auto hashes = AllocateNZ<uint64>(&g_std_allocator, max_size + 1);
+    for (uint32 size = 0; size <= max_size; size += 1) {
+        hashes[size] = Hash(data, size);
+    }
+    qsort(hashes, max_size + 1, sizeof(uint64), [](const void* a, const void* b) {
+        uint64 hash_a = *(const uint64*)a;
+        uint64 hash_b = *(const uint64*)b;
+        return hash_a < hash_b ? -1 : hash_a > hash_b ? 1 : 0;
+    });
+
+    bool distinct = true;
+    for (uint32 i = 1; i <= max_size; i += 1) {
+        distinct &= hashes[i - 1] != hashes[i];
+    }
+    Deallocate(&g_std_allocator, hashes);
+    return distinct;
+}
+
+// Flipping any single input bit should flip about half of the output bits.
+bool Avalanches(uint32 size) {
+    uint8 data[64] = {};
+    FillRandom(data, size, 0x5EED + size);
+    uint64 hash = Hash(data, size);
+    uint32 flipped_bit_count = 0;
+    for (uint32 bit = 0; bit < size * 8; bit += 1) {
+        data[bit / 8] ^= 1 << (bit % 8);
+        flipped_bit_count += PopCount(hash ^ Hash(data, size));
+        data[bit / 8] ^= 1 << (bit % 8);
+    }
+    float64 average = (float64)flipped_bit_count / (size * 8);
+    return average > 28.0 && average < 36.0;
+}
+
+// Streams data in random-sized pieces and checks the stream's hash against Hash() after every piece.
+bool StreamMatchesHash(const uint8* data, uint32 size, uint64 seed) {
+    uint64 random_state = RandomSeed64(seed);
+    HashStream stream = CreateHashStream(7);
+    uint32 streamed_size = 0;
+    bool match = GetHash(&stream) == Hash(data, 0, 7);
+    while (streamed_size < size) {
+        uint64 random = Random64(&random_state);
+        uint32 piece_size = (uint32)(random % 4 == 0 ? random % 300 : random % 20);
+        piece_size = Min(piece_size, size - streamed_size);
+        Update(&stream, &data[streamed_size], piece_size);
+        streamed_size += piece_size;
+        match &= GetHash(&stream) == Hash(data, streamed_size, 7);
+    }
+    return match;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool HashFuncTest() {
+    bool pass = true;
+
+    auto data = AllocateNZ<uint8>(&g_std_allocator, DATA_SIZE);
+    FillRandom(data, DATA_SIZE, 0x1234);
+
+    String string = CreateString(&g_std_allocator, "hash me");
+    FString<16> fstring = {};
+    PushRange(&fstring, "hash me");
+    uint64 expected = Hash("hash me", 7);
+    RunTest("Hash(\"hash me\")",                     &pass, ExpectEqual, expected, Hash("hash me"));
+    RunTest("Hash(CTK_VIEW_STRING(\"hash me\"))",    &pass, ExpectEqual, expected, Hash(CTK_VIEW_STRING("hash me")));
+    RunTest("Hash(&string)",                         &pass, ExpectEqual, expected, Hash(&string));
+    RunTest("Hash(&fstring)",                        &pass, ExpectEqual, expected, Hash(&fstring));
+    RunTest("Hash(\"hash me\", 7, 1) != expected",   &pass, ExpectEqual, true, Hash("hash me", 7, 1) != expected);
+    RunTest("Hash(\"hash mf\") != expected",         &pass, ExpectEqual, true, Hash("hash mf") != expected);
+    RunTest("AllSizesDistinct(data, 300)",           &pass, ExpectEqual, true, AllSizesDistinct(data, 300));
+
+    // Covers each size class: overlapping short loads, tail mixes and blocks.
+    uint32 avalanche_sizes[] = { 1, 3, 4, 8, 12, 16, 24, 40, 48, 49, 64 };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(avalanche_sizes); i += 1) {
+        char desc[32] = {};
+        WriteValues(desc, sizeof(desc), "Avalanches(", avalanche_sizes[i], ")");
+        RunTest(desc, &pass, ExpectEqual, true, Avalanches(avalanche_sizes[i]));
+    }
+
+    DestroyString(&string);
+    Deallocate(&g_std_allocator, data);
+    return pass;
+}
+
+bool StreamTest() {
+    bool pass = true;
+
+    auto data = AllocateNZ<uint8>(&g_std_allocator, DATA_SIZE);
+    FillRandom(data, DATA_SIZE, 0x4321);
+
+    // Sizes around block boundaries, where pending bytes are hashed or kept for the final mix.
+    uint32 sizes[] = { 0, 1, 16, 17, 47, 48, 49, 95, 96, 97, 144, 1000, DATA_SIZE };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(sizes); i += 1) {
+        HashStream stream = CreateHashStream(7);
+        Update(&stream, data, sizes[i]);
+        char desc[48] = {};
+        WriteValues(desc, sizeof(desc), "single Update() of ", sizes[i], " bytes");
+        RunTest(desc, &pass, ExpectEqual, Hash(data, sizes[i], 7), GetHash(&stream));
+    }
+
+    for (uint64 seed = 1; seed <= 20; seed += 1) {
+        char desc[48] = {};
+        WriteValues(desc, sizeof(desc), "StreamMatchesHash(data, seed ", seed, ")");
+        RunTest(desc, &pass, ExpectEqual, true, StreamMatchesHash(data, DATA_SIZE, seed));
+    }
+
+    Deallocate(&g_std_allocator, data);
+    return pass;
+}
+
+bool BatchTest() {
+    bool pass = true;
+
+    StringView views[] = {
+        CTK_VIEW_STRING(""),
+        CTK_VIEW_STRING("a"),
+        CTK_VIEW_STRING("0123456789abcdef"),
+        CTK_VIEW_STRING("a string that's long enough to be hashed in more than one 48-byte block"),
+    };
+    uint64 hashes[CTK_ARRAY_SIZE(views)] = {};
+    HashStrings(views, CTK_ARRAY_SIZE(views), hashes, 3);
+    bool strings_match = true;
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(views); i += 1) {
+        strings_match &= hashes[i] == Hash(views[i], 3);
+    }
+    RunTest("HashStrings(views, 4, hashes, 3)", &pass, ExpectEqual, true, strings_match);
+
+    String strings[CTK_ARRAY_SIZE(views)] = {};
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(views); i += 1) {
+        strings[i] = CreateString(&g_std_allocator, views[i]);
+    }
+    uint64 string_hashes[CTK_ARRAY_SIZE(views)] = {};
+    HashStrings(strings, CTK_ARRAY_SIZE(strings), string_hashes, 3);
+    RunTest("HashStrings(strings, 4, string_hashes, 3)", &pass, ExpectEqual, true,
+            memcmp(hashes, string_hashes, sizeof(hashes)) == 0);
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(strings); i += 1) {
+        DestroyString(&strings[i]);
+    }
+
+    // Specialized (4, 8, 12, 16) and generic key sizes.
+    uint8 keys[40 * 64] = {};
+    FillRandom(keys, sizeof(keys), 0xABCD);
+    uint32 key_sizes[] = { 1, 4, 8, 12, 16, 20, 40 };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(key_sizes); i += 1) {
+        uint64 key_hashes[64] = {};
+        HashKeys(keys, key_sizes[i], 64, key_hashes, 5);
+        bool keys_match = true;
+        for (uint32 key = 0; key < 64; key += 1) {
+            keys_match &= key_hashes[key] == Hash(&keys[key * key_sizes[i]], key_sizes[i], 5);
+        }
+        char desc[48] = {};
+        WriteValues(desc, sizeof(desc), "HashKeys(keys, ", key_sizes[i], ", 64, key_hashes, 5)");
+        RunTest(desc, &pass, ExpectEqual, true, keys_match);
+    }
+
+    uint64 int_keys[] = { 0, 1, 2, UINT64_MAX };
+    uint64 int_hashes[CTK_ARRAY_SIZE(int_keys)] = {};
+    HashKeys(int_keys, CTK_ARRAY_SIZE(int_keys), int_hashes);
+    RunTest("HashKeys(int_keys, 4, int_hashes)", &pass, ExpectEqual, Hash(&int_keys[3], 8), int_hashes[3]);
+
+    return pass;
+}
+
+bool CRC32CTest() {
+    bool pass = true;
+
+    // Standard check value.
+    RunTest("CRC32C(\"123456789\", 9)",       &pass, ExpectEqual, 0xE3069283u, CRC32C("123456789", 9));
+    RunTest("CRC32C(\"\", 0)",                &pass, ExpectEqual, 0u, CRC32C("", 0));
+    RunTest("CRC32C(CTK_VIEW_STRING(...))",   &pass, ExpectEqual, 0xE3069283u,
+            CRC32C(CTK_VIEW_STRING("123456789")));
+    RunTest("CRC32C(\"56789\", 5, CRC32C(\"1234\", 4))", &pass, ExpectEqual, 0xE3069283u,
+            CRC32C("56789", 5, CRC32C("1234", 4)));
+
+    auto data = AllocateNZ<uint8>(&g_std_allocator, DATA_SIZE);
+    FillRandom(data, DATA_SIZE, 0x7777);
+    bool implementations_match = true;
+    for (uint32 size = 0; size < 100; size += 1) {
+        implementations_match &= Scalar_CRC32C(data, size, ~0u) == SSE42_CRC32C(data, size, ~0u);
+    }
+    implementations_match &= Scalar_CRC32C(data, DATA_SIZE, ~0u) == SSE42_CRC32C(data, DATA_SIZE, ~0u);
+    RunTest("Scalar_CRC32C() == SSE42_CRC32C()", &pass, ExpectEqual, true, implementations_match);
+
+    Deallocate(&g_std_allocator, data);
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+    RunTest("HashFuncTest()", &pass, HashFuncTest);
+    RunTest("StreamTest()",   &pass, StreamTest);
+    RunTest("BatchTest()",    &pass, BatchTest);
+    RunTest("CRC32CTest()",   &pass, CRC32CTest);
+    return pass;
+}
+
+}
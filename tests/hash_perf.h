@@ -0,0 +1,127 @@
+#pragma once
+
+namespace HashPerfTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 DATA_SIZE      = 1024 * 1024;
+constexpr uint64 BYTES_PER_TEST = 256 * 1024 * 1024;
+constexpr uint32 KEY_COUNT      = 1000000;
+
+/// Utils
+////////////////////////////////////////////////////////////
+// Hashes BYTES_PER_TEST bytes as size-byte inputs, stepping through data so inputs aren't all the same cached bytes.
+template<typename HashType>
+void ProfileHash(const char* name, Func<HashType, const void*, uint32, HashType> hash_func, const uint8* data,
+                 uint32 size) {
+    PerfUtils::VolatileFunc<HashType, const void*, uint32, HashType> test_func = hash_func;
+    uint64 hash_count = BYTES_PER_TEST / size;
+    uint32 input_count = DATA_SIZE / size;
+    uint64 checksum = 0;
+    Profile prof = BeginProfile(name);
+    for (uint64 i = 0; i < hash_count; i += 1) {
+        checksum += test_func(&data[(i % input_count) * size], size, 0);
+    }
+    EndProfile(&prof);
+    PerfUtils::PrintThroughput(&prof, hash_count * size, checksum, "hashes", hash_count);
+}
+
+uint64 StreamHash(const void* data, uint32 size, uint64 seed) {
+    // Feed data in 4 KB pieces, as when hashing a file while reading it.
+    HashStream stream = CreateHashStream(seed);
+    for (uint32 i = 0; i < size; i += 4096) {
+        Update(&stream, &((const uint8*)data)[i], Min(4096u, size - i));
+    }
+    return GetHash(&stream);
+}
+
+uint64 HashFunc(const void* data, uint32 size, uint64 seed) {
+    return Hash(data, size, seed);
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+void SizePerfTest(const uint8* data, uint32 size) {
+    PrintLine("\nHash Performance Test: %u byte inputs", size);
+    ProfileHash<uint64>("Hash()", HashFunc, data, size);
+    if (size >= 4096) {
+        ProfileHash<uint64>("HashStream (4 KB updates)", StreamHash, data, size);
+    }
+    ProfileHash<uint32>("Scalar_CRC32C()", [](const void* data, uint32 size, uint32 crc) {
+        return Scalar_CRC32C((const uint8*)data, size, crc);
+    }, data, size);
+    if (HasSSE42()) {
+        ProfileHash<uint32>("SSE42_CRC32C()", [](const void* data, uint32 size, uint32 crc) {
+            return SSE42_CRC32C((const uint8*)data, size, crc);
+        }, data, size);
+    }
+}
+
+void BatchPerfTest(const uint8* data) {
+    PrintLine("\nHash Performance Test: batches of %u keys", KEY_COUNT);
+    auto hashes = Allocate<uint64>(&g_std_allocator, KEY_COUNT); // Zeroed so first profile doesn't pay for page faults.
+    auto views  = AllocateNZ<StringView>(&g_std_allocator, KEY_COUNT);
+    uint32 view_byte_count = 0;
+    for (uint32 i = 0; i < KEY_COUNT; i += 1) {
+        // Identifier-like strings of 4-31 chars.
+        uint32 size = 4 + (data[i % DATA_SIZE] % 28);
+        views[i] = { .data = (const char*)&data[(i * 32) % (DATA_SIZE - 32)], .size = size };
+        view_byte_count += size;
+    }
+
+    uint32 key_sizes[] = { 8, 16 };
+    for (uint32 k = 0; k < CTK_ARRAY_SIZE(key_sizes); k += 1) {
+        uint32 key_size = key_sizes[k];
+        char name[32] = {};
+        WriteValues(name, sizeof(name), "Hash() x ", key_size, " bytes");
+        Profile prof = BeginProfile(name);
+        for (uint32 i = 0; i < KEY_COUNT; i += 1) {
+            hashes[i] = Hash(&data[i * key_size % DATA_SIZE], key_size);
+        }
+        EndProfile(&prof);
+        PerfUtils::PrintThroughput(&prof, (uint64)KEY_COUNT * key_size, hashes[KEY_COUNT - 1], "hashes", KEY_COUNT);
+
+        // Keys are contiguous, so only hash as many as fit in data.
+        uint32 key_count = Min(KEY_COUNT, DATA_SIZE / key_size);
+        WriteValues(name, sizeof(name), "HashKeys() x ", key_size, " bytes");
+        prof = BeginProfile(name);
+        for (uint32 i = 0; i < KEY_COUNT; i += key_count) {
+            HashKeys(data, key_size, Min(key_count, KEY_COUNT - i), &hashes[i]);
+        }
+        EndProfile(&prof);
+        PerfUtils::PrintThroughput(&prof, (uint64)KEY_COUNT * key_size, hashes[KEY_COUNT - 1], "hashes", KEY_COUNT);
+    }
+
+    Profile prof = BeginProfile("Hash() x views");
+    for (uint32 i = 0; i < KEY_COUNT; i += 1) {
+        hashes[i] = Hash(views[i]);
+    }
+    EndProfile(&prof);
+    PerfUtils::PrintThroughput(&prof, view_byte_count, hashes[KEY_COUNT - 1], "hashes", KEY_COUNT);
+
+    prof = BeginProfile("HashStrings() x views");
+    HashStrings(views, KEY_COUNT, hashes);
+    EndProfile(&prof);
+    PerfUtils::PrintThroughput(&prof, view_byte_count, hashes[KEY_COUNT - 1], "hashes", KEY_COUNT);
+
+    Deallocate(&g_std_allocator, views);
+    Deallocate(&g_std_allocator, hashes);
+}
+
+void Run() {
+    auto data = AllocateNZ<uint8>(&g_std_allocator, DATA_SIZE);
+    uint64 random_state = RandomSeed64(1);
+    for (uint32 i = 0; i < DATA_SIZE; i += 1) {
+        data[i] = (uint8)Random64(&random_state);
+    }
+
+    uint32 sizes[] = { 8, 16, 32, 64, 256, 1024, 4096, 64 * 1024, DATA_SIZE };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(sizes); i += 1) {
+        SizePerfTest(data, sizes[i]);
+    }
+    BatchPerfTest(data);
+
+    Deallocate(&g_std_allocator, data);
+}
+
+}
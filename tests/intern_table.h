@@ -0,0 +1,162 @@
+#pragma once
+
+namespace InternTableTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 THREAD_COUNT        = 4;
+constexpr uint32 THREAD_STRING_COUNT = 2000;
+
+struct InternThreadState {
+    InternTable* table;
+    uint32       start;
+    Atom         atoms[THREAD_STRING_COUNT];
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+bool ExpectView(const char* expected, StringView actual) {
+    return ExpectEqual(expected, StringSize(expected), actual.data, actual.size);
+}
+
+// Each thread interns an overlapping range of numbered strings, so threads race to intern the same strings.
+void InternThread(void* data) {
+    auto state = (InternThreadState*)data;
+    char string[16] = {};
+    for (uint32 i = 0; i < THREAD_STRING_COUNT; i += 1) {
+        uint32 size = WriteValues(string, sizeof(string), "string_", state->start + i);
+        state->atoms[i] = Intern(state->table, string, size);
+    }
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool InternTest() {
+    bool pass = true;
+
+    InternTable table = CreateInternTable(&g_std_allocator, 4, 32);
+    Atom apple  = Intern(&table, "apple");
+    Atom banana = Intern(&table, CTK_VIEW_STRING("banana"));
+    StringView apple_string = GetAtomString(&table, apple);
+    RunTest("apple",                          &pass, ExpectEqual, 0u, apple);
+    RunTest("banana",                         &pass, ExpectEqual, 1u, banana);
+    RunTest("Intern(&table, \"apple\")",      &pass, ExpectEqual, apple, Intern(&table, "apple"));
+    RunTest("Intern(&table, \"apples\", 5)",  &pass, ExpectEqual, apple, Intern(&table, "apples", 5));
+    RunTest("FindAtom(&table, \"banana\")",   &pass, ExpectEqual, banana, FindAtom(&table, "banana"));
+    RunTest("FindAtom(&table, \"cherry\")",   &pass, ExpectEqual, ATOM_NOT_FOUND, FindAtom(&table, "cherry"));
+    RunTest("GetAtomCount(&table)",           &pass, ExpectEqual, 2u, GetAtomCount(&table));
+    RunTest("GetAtomString(&table, banana)",  &pass, ExpectView, "banana", GetAtomString(&table, banana));
+    RunTest("StringSize(apple_string.data)",  &pass, ExpectEqual, 5u, StringSize(apple_string.data));
+
+    // Empty strings are interned like any other string.
+    Atom empty = Intern(&table, "");
+    RunTest("Intern(&table, \"\")",           &pass, ExpectEqual, 2u, empty);
+    RunTest("GetAtomString(&table, empty)",   &pass, ExpectView, "", GetAtomString(&table, empty));
+
+    // 6 + 7 + 1 chars used of 32.
+    RunTest<Func<Atom, InternTable*, const char*>>(
+        "Intern() past max char count", &pass, ExpectFatalError, Intern, &table, "0123456789abcdefghi");
+    Intern(&table, "cherry");
+    RunTest<Func<Atom, InternTable*, const char*>>(
+        "Intern() past max atom count", &pass, ExpectFatalError, Intern, &table, "date");
+    RunTest("Intern() existing string when full", &pass, ExpectEqual, banana, Intern(&table, "banana"));
+
+    DestroyInternTable(&table);
+
+    RunTest("CreateInternTable(&g_std_allocator, 0, 32)", &pass,
+            ExpectFatalError, CreateInternTable, &g_std_allocator, 0u, 32u);
+
+    return pass;
+}
+
+bool InternRangeTest() {
+    bool pass = true;
+
+    InternTable table = CreateInternTable(&g_std_allocator, 64, 1024);
+    Atom existing = Intern(&table, "b");
+
+    StringView strings[] = {
+        CTK_VIEW_STRING("a"),
+        CTK_VIEW_STRING("b"),
+        CTK_VIEW_STRING("c"),
+        CTK_VIEW_STRING("a"),
+    };
+    Atom atoms[CTK_ARRAY_SIZE(strings)] = {};
+    InternRange(&table, strings, CTK_ARRAY_SIZE(strings), atoms);
+    RunTest("atoms[1] == existing",  &pass, ExpectEqual, existing, atoms[1]);
+    RunTest("atoms[0] == atoms[3]",  &pass, ExpectEqual, atoms[0], atoms[3]);
+    RunTest("atoms[0] != atoms[2]",  &pass, ExpectEqual, true, atoms[0] != atoms[2]);
+    RunTest("GetAtomCount(&table)",  &pass, ExpectEqual, 3u, GetAtomCount(&table));
+    RunTest("GetAtomString(&table, atoms[2])", &pass, ExpectView, "c", GetAtomString(&table, atoms[2]));
+
+    // Fill table to max atom count, which probes across the whole index.
+    char string[16] = {};
+    for (uint32 i = GetAtomCount(&table); i < 64; i += 1) {
+        uint32 size = WriteValues(string, sizeof(string), "s", i);
+        Intern(&table, string, size);
+    }
+    bool all_found = true;
+    for (uint32 atom = 0; atom < 64; atom += 1) {
+        all_found &= FindAtom(&table, GetAtomString(&table, atom)) == atom;
+    }
+    RunTest("all atoms found in full table", &pass, ExpectEqual, true, all_found);
+
+    DestroyInternTable(&table);
+
+    return pass;
+}
+
+bool ThreadedTest() {
+    bool pass = true;
+
+    ThreadPool thread_pool = {};
+    InitThreadPool(&thread_pool, &g_std_allocator, THREAD_COUNT);
+
+    InternTable table = CreateInternTable(&g_std_allocator, THREAD_STRING_COUNT * 4, THREAD_STRING_COUNT * 64);
+    auto states = Allocate<InternThreadState>(&g_std_allocator, THREAD_COUNT);
+    TaskHnd tasks[THREAD_COUNT] = {};
+    for (uint32 i = 0; i < THREAD_COUNT; i += 1) {
+        states[i].table = &table;
+        states[i].start = i * (THREAD_STRING_COUNT / 2);
+        tasks[i] = SubmitTask(&thread_pool, &states[i], InternThread);
+    }
+    CTK_ITER_ARRAY(task, tasks) {
+        Wait(&thread_pool, *task);
+    }
+
+    // Overlapping halves of ranges mean (THREAD_COUNT + 1) * THREAD_STRING_COUNT / 2 unique strings.
+    RunTest("GetAtomCount(&table)", &pass, ExpectEqual, (THREAD_COUNT + 1) * THREAD_STRING_COUNT / 2,
+            GetAtomCount(&table));
+
+    // Every thread got the same atom for the same string, and atoms map back to their strings.
+    bool atoms_match = true;
+    char string[16] = {};
+    for (uint32 i = 0; i < THREAD_COUNT; i += 1) {
+        for (uint32 j = 0; j < THREAD_STRING_COUNT; j += 1) {
+            uint32 size = WriteValues(string, sizeof(string), "string_", states[i].start + j);
+            atoms_match &= StringsMatch(GetAtomString(&table, states[i].atoms[j]), string, size);
+            if (i > 0 && j < THREAD_STRING_COUNT / 2) {
+                atoms_match &= states[i].atoms[j] == states[i - 1].atoms[j + THREAD_STRING_COUNT / 2];
+            }
+        }
+    }
+    RunTest("atoms match across threads", &pass, ExpectEqual, true, atoms_match);
+
+    Deallocate(&g_std_allocator, states);
+    DestroyInternTable(&table);
+    DestroyThreadPool(&thread_pool);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("InternTest()",      &pass, InternTest);
+    RunTest("InternRangeTest()", &pass, InternRangeTest);
+    RunTest("ThreadedTest()",    &pass, ThreadedTest);
+
+    return pass;
+}
+
+}
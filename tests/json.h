@@ -101,6 +101,42 @@ bool NoRootTest() {
     return pass;
 }
 
+bool UnclosedBracketTest() {
+    bool pass = true;
+
+    RunTest("LoadJSON(\"tests/data/unclosed_bracket.json\")", &pass,
+            ExpectFatalError, LoadJSON, &g_std_allocator, "tests/data/unclosed_bracket.json");
+
+    return pass;
+}
+
+bool MismatchedBracketTest() {
+    bool pass = true;
+
+    RunTest("LoadJSON(\"tests/data/mismatched_bracket.json\")", &pass,
+            ExpectFatalError, LoadJSON, &g_std_allocator, "tests/data/mismatched_bracket.json");
+
+    return pass;
+}
+
+bool UnicodeEscapeTest() {
+    bool pass = true;
+
+    // \u escape sequences are written as UTF-8, with surrogate pairs combined into one codepoint.
+    const char expected[] = "\b\f/A\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\0end";
+    JSON json = LoadJSON(&g_std_allocator, "tests/data/unicode_escape.json");
+    RunTest("SearchNode(escapes)", &pass, ExpectEqual, true,
+            StringsMatch(&SearchNode(&json, "escapes")->string, expected, sizeof(expected) - 1));
+    DestroyJSON(&json);
+
+    RunTest("LoadJSON(\"tests/data/unpaired_surrogate.json\")", &pass,
+            ExpectFatalError, LoadJSON, &g_std_allocator, "tests/data/unpaired_surrogate.json");
+    RunTest("LoadJSON(\"tests/data/invalid_unicode_escape.json\")", &pass,
+            ExpectFatalError, LoadJSON, &g_std_allocator, "tests/data/invalid_unicode_escape.json");
+
+    return pass;
+}
+
 bool LargeTest() {
     bool pass = true;
 
@@ -110,6 +146,107 @@ bool LargeTest() {
     return pass;
 }
 
+// Nodes of JSON loaded from a mapped file match nodes of JSON loaded from a copy of it.
+bool MappedNodesMatch(const char* path) {
+    JSON json        = LoadJSON      (&g_std_allocator, path);
+    JSON mapped_json = LoadMappedJSON(&g_std_allocator, path);
+    bool match = json.nodes.count == mapped_json.nodes.count && json.max_keys == mapped_json.max_keys;
+    for (uint32 i = 0; match && i < json.nodes.count; i += 1) {
+        JSONNode* node        = &json.nodes.data[i];
+        JSONNode* mapped_node = &mapped_json.nodes.data[i];
+        match = node->type == mapped_node->type && node->key_index == mapped_node->key_index &&
+                StringsMatch(&node->key, &mapped_node->key);
+        if (match && node->type == JSONNodeType::STRING) {
+            match = StringsMatch(&node->string, &mapped_node->string);
+        }
+        else if (match && (node->type == JSONNodeType::ARRAY || node->type == JSONNodeType::OBJECT)) {
+            match = node->list.node_index == mapped_node->list.node_index &&
+                    node->list.key_index  == mapped_node->list.key_index  &&
+                    node->list.size       == mapped_node->list.size;
+        }
+        else if (match) {
+            match = node->num_uint32 == mapped_node->num_uint32;
+        }
+    }
+    DestroyJSON(&mapped_json);
+    DestroyJSON(&json);
+    return match;
+}
+
+bool InMappedFile(JSON* json, String* string) {
+    const char* data = json->mapped_file.data;
+    return string->data >= data && string->data + string->size <= data + json->mapped_file.size;
+}
+
+bool MappedTest() {
+    bool pass = true;
+
+    const char* paths[] = {
+        "tests/data/valid.json",
+        "tests/data/gltf_test.json",
+        "tests/data/object_key_test.json",
+        "tests/data/string_parse_test.json",
+        "tests/data/scientific_e_notation.json",
+    };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(paths); i += 1) {
+        char desc[64] = {};
+        WriteValues(desc, sizeof(desc), "MappedNodesMatch(", paths[i], ")");
+        RunTest(desc, &pass, ExpectEqual, true, MappedNodesMatch(paths[i]));
+    }
+
+    // Only strings with escape sequences are copied out of the mapped file.
+    JSON json = LoadMappedJSON(&g_std_allocator, "tests/data/valid.json");
+    JSONNode* object = GetObject(&json, "object");
+    RunTest("GetString(string)",           &pass, ExpectEqual, "this is a \"test\"", GetString(&json, "string"));
+    RunTest("InMappedFile(string)",        &pass, ExpectEqual, false, InMappedFile(&json, GetString(&json, "string")));
+    RunTest("InMappedFile(object.string)", &pass, ExpectEqual, true,
+            InMappedFile(&json, GetString(&json, object, "string")));
+    RunTest("InMappedFile(object.key)",    &pass, ExpectEqual, true,  InMappedFile(&json, &object->key));
+    DestroyJSON(&json);
+
+    RunTest("LoadMappedJSON(\"tests/data/eof_string.json\")", &pass,
+            ExpectFatalError, LoadMappedJSON, &g_std_allocator, "tests/data/eof_string.json");
+
+    return pass;
+}
+
+bool KeyTableTest() {
+    bool pass = true;
+
+    // large_object.json's root has 100 keys "key_0" to "key_99" with values 0 to 99, then a duplicate "key_0". Its key
+    // table is built when it's loaded, and lookups don't build any more.
+    JSON json = LoadJSON(&g_std_allocator, "tests/data/large_object.json");
+    RunTest("key_tables.count",           &pass, ExpectEqual, 1u,   json.key_tables.count);
+    bool values_match = true;
+    for (uint32 i = 0; i < 100; i += 1) {
+        char key[16] = {};
+        WriteValues(key, sizeof(key), "key_", i);
+        values_match &= GetUInt32(&json, key) == i;
+    }
+    JSONNode* root = &json.root_node;
+    RunTest("GetUInt32(key_0 to key_99)", &pass, ExpectEqual, true, values_match);
+    RunTest("FindNode(key_100)",          &pass, ExpectEqual, true, FindNode(&json, root, "key_100") == NULL);
+    RunTest("FindNode(key_)",             &pass, ExpectEqual, true, FindNode(&json, root, "key_") == NULL);
+    RunTest("GetUInt32(small.b)",         &pass, ExpectEqual, 2u,   GetUInt32(&json, GetObject(&json, "small"), "b"));
+    RunTest("key_tables.count (lookups)", &pass, ExpectEqual, 1u,   json.key_tables.count);
+    DestroyJSON(&json);
+
+    json = LoadMappedJSON(&g_std_allocator, "tests/data/large_object.json");
+    RunTest("key_tables.count (mapped)",  &pass, ExpectEqual, 1u,  json.key_tables.count);
+    RunTest("GetUInt32(key_99) (mapped)", &pass, ExpectEqual, 99u, GetUInt32(&json, "key_99"));
+    RunTest("GetUInt32(key_0) (mapped)",  &pass, ExpectEqual, 0u,  GetUInt32(&json, "key_0"));
+    DestroyJSON(&json);
+
+    // large_objects.json's root array has 12 objects with keys "key_0" to "key_39", each with its own key table.
+    json = LoadJSON(&g_std_allocator, "tests/data/large_objects.json");
+    RunTest("key_tables.count (12 objects)", &pass, ExpectEqual, 12u, json.key_tables.count);
+    RunTest("GetUInt32([11], key_39)",       &pass, ExpectEqual, 1139u,
+            GetUInt32(&json, GetObject(&json, 11u), "key_39"));
+    DestroyJSON(&json);
+
+    return pass;
+}
+
 bool ValidSearchTest() {
     bool pass = true;
 
@@ -169,6 +306,119 @@ bool InvalidSearchTest() {
     return pass;
 }
 
+// Nodes found with compiled paths match nodes found with search strings.
+bool PathNodesMatch(JSON* json, const char** searches, uint32 search_count, bool cache_node) {
+    bool match = true;
+    for (uint32 i = 0; i < search_count; i += 1) {
+        JSONPath path = CompileJSONPath(&g_std_allocator, searches[i], cache_node);
+        match &= SearchNode(json, &path) == SearchNode(json, searches[i]);
+        match &= SearchNode(json, &path) == SearchNode(json, searches[i]);
+        DestroyJSONPath(&path);
+    }
+    return match;
+}
+
+void CompileAndDestroyJSONPath(const char* search) {
+    JSONPath path = CompileJSONPath(&g_std_allocator, search);
+    DestroyJSONPath(&path);
+}
+
+JSONNode* SearchNodeWithPath(JSON* json, const char* search) {
+    JSONPath path = CompileJSONPath(&g_std_allocator, search);
+    JSONNode* node = SearchNode(json, &path);
+    DestroyJSONPath(&path);
+    return node;
+}
+
+bool PathTest() {
+    bool pass = true;
+
+    // Sorted so paths sharing prefixes are next to each other for SearchNodes().
+    const char* searches[] = {
+        "array", "array[3]", "array[8][0]", "array[9].name", "float32", "object", "object.array[0]", "object.object",
+        "object.object.name", "object.string", "string", "uint32",
+    };
+    constexpr uint32 SEARCH_COUNT = CTK_ARRAY_SIZE(searches);
+
+    JSON json = LoadJSON(&g_std_allocator, "tests/data/valid.json");
+    RunTest("PathNodesMatch(valid.json)",          &pass, ExpectEqual, true,
+            PathNodesMatch(&json, searches, SEARCH_COUNT, false));
+    RunTest("PathNodesMatch(valid.json, cached)",  &pass, ExpectEqual, true,
+            PathNodesMatch(&json, searches, SEARCH_COUNT, true));
+
+    JSONPath float_path = CompileJSONPath(&g_std_allocator, "float32");
+    JSONPath name_path  = CompileJSONPath(&g_std_allocator, "object.name");
+    JSONNode* object = SearchObject(&json, "object");
+    RunTest("SearchFloat32(float32)",              &pass, ExpectEqual, -2.3f, SearchFloat32(&json, &float_path));
+    RunTest("SearchFloat32(object, float32)",      &pass, ExpectEqual, 5.6f,  SearchFloat32(&json, object, &float_path));
+    RunTest("SearchString (object, object.name)",  &pass, ExpectEqual, "object object",
+            SearchString(&json, object, &name_path));
+    DestroyJSONPath(&name_path);
+    DestroyJSONPath(&float_path);
+
+    // Batch search finds the same nodes as searching paths one at a time.
+    JSONPath paths[SEARCH_COUNT] = {};
+    JSONNode* nodes[SEARCH_COUNT] = {};
+    for (uint32 i = 0; i < SEARCH_COUNT; i += 1) {
+        paths[i] = CompileJSONPath(&g_std_allocator, searches[i]);
+    }
+    SearchNodes(&json, paths, SEARCH_COUNT, nodes);
+    bool batch_matches = true;
+    for (uint32 i = 0; i < SEARCH_COUNT; i += 1) {
+        batch_matches &= nodes[i] == SearchNode(&json, searches[i]);
+    }
+    RunTest("SearchNodes(valid.json)",             &pass, ExpectEqual, true, batch_matches);
+
+    // Cached nodes aren't reused for a different load of the same file.
+    JSONPath cached_path = CompileJSONPath(&g_std_allocator, "object.string", true);
+    RunTest("SearchString(object.string, cached)", &pass, ExpectEqual, "object string",
+            SearchString(&json, &cached_path));
+    DestroyJSON(&json);
+    json = LoadMappedJSON(&g_std_allocator, "tests/data/valid.json");
+    RunTest("SearchNode(object.string, reloaded)", &pass, ExpectEqual, true,
+            SearchNode(&json, &cached_path) == SearchNode(&json, "object.string"));
+    DestroyJSONPath(&cached_path);
+
+    // Paths through large objects use the key tables built when loading, and searching doesn't modify them.
+    JSON large_json = LoadJSON(&g_std_allocator, "tests/data/large_object.json");
+    JSONKeyTable* key_tables = large_json.key_tables.data;
+    JSONPath large_paths[] = {
+        CompileJSONPath(&g_std_allocator, "key_0"),
+        CompileJSONPath(&g_std_allocator, "key_99"),
+        CompileJSONPath(&g_std_allocator, "small.a"),
+        CompileJSONPath(&g_std_allocator, "small.b"),
+    };
+    JSONNode* large_nodes[CTK_ARRAY_SIZE(large_paths)] = {};
+    SearchNodes(&large_json, large_paths, CTK_ARRAY_SIZE(large_paths), large_nodes);
+    RunTest("SearchNodes(large_object.json)[0]",   &pass, ExpectEqual, 0u,  large_nodes[0]->num_uint32);
+    RunTest("SearchNodes(large_object.json)[1]",   &pass, ExpectEqual, 99u, large_nodes[1]->num_uint32);
+    RunTest("SearchNodes(large_object.json)[2]",   &pass, ExpectEqual, 1u,  large_nodes[2]->num_uint32);
+    RunTest("SearchNodes(large_object.json)[3]",   &pass, ExpectEqual, 2u,  large_nodes[3]->num_uint32);
+    RunTest("key_tables.count",                    &pass, ExpectEqual, 1u,  large_json.key_tables.count);
+    RunTest("key_tables.data",                     &pass, ExpectEqual, true,
+            large_json.key_tables.data == key_tables);
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(large_paths); i += 1) {
+        DestroyJSONPath(&large_paths[i]);
+    }
+    DestroyJSON(&large_json);
+
+    const char* invalid_searches[] = { "array[", "array[x]", "array[]" };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(invalid_searches); i += 1) {
+        char desc[64] = {};
+        WriteValues(desc, sizeof(desc), "CompileJSONPath(", invalid_searches[i], ")");
+        RunTest(desc, &pass, ExpectFatalError, CompileAndDestroyJSONPath, invalid_searches[i]);
+    }
+    const char* missing_searches[] = { "invalid_key", "array[10]", "uint32.key", "object[0][0]" };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(missing_searches); i += 1) {
+        char desc[64] = {};
+        WriteValues(desc, sizeof(desc), "SearchNodeWithPath(", missing_searches[i], ")");
+        RunTest(desc, &pass, ExpectFatalError, SearchNodeWithPath, &json, missing_searches[i]);
+    }
+    DestroyJSON(&json);
+
+    return pass;
+}
+
 bool ValidGetTest() {
     bool pass = true;
 
@@ -211,11 +461,78 @@ bool ValidGetTest() {
     return pass;
 }
 
+// Structurals and end-in-string state from each implementation match Scalar_FindStructurals().
+bool StructuralsMatchScalar(const char* chars, uint32 size) {
+    auto expected = CreateArray<uint32>(&g_std_allocator, size + 64);
+    auto actual   = CreateArray<uint32>(&g_std_allocator, size + 64);
+    bool expected_in_string = Scalar_FindStructurals(chars, size, &expected);
+    bool match = true;
+    if (HasPCLMUL()) {
+        bool in_string = SSE2_FindStructurals(chars, size, &actual);
+        match &= in_string == expected_in_string && actual.count == expected.count &&
+                 memcmp(actual.data, expected.data, expected.count * sizeof(uint32)) == 0;
+    }
+    if (HasPCLMUL() && HasAVX2()) {
+        actual.count = 0;
+        bool in_string = AVX2_FindStructurals(chars, size, &actual);
+        match &= in_string == expected_in_string && actual.count == expected.count &&
+                 memcmp(actual.data, expected.data, expected.count * sizeof(uint32)) == 0;
+    }
+    DestroyArray(&expected);
+    DestroyArray(&actual);
+    return match;
+}
+
+bool StructuralsTest() {
+    bool pass = true;
+
+    const char* json = "{ \"key\": [1, -2.5e3, true, null, \"a \\\"b\\\\\"], \"c\": {} }";
+    uint32 expected[] = { 0, 2, 6, 7, 9, 10, 11, 13, 19, 21, 25, 27, 31, 33, 41, 42, 43, 45, 47, 48, 50, 51, 53 };
+    auto structurals = CreateArray<uint32>(&g_std_allocator, 64);
+    Scalar_FindStructurals(json, StringSize(json), &structurals);
+    RunTest("Scalar_FindStructurals(json)", &pass, ExpectEqual, true,
+            structurals.count == CTK_ARRAY_SIZE(expected) && memcmp(structurals.data, expected, sizeof(expected)) == 0);
+    RunTest("StructuralsMatchScalar(json)", &pass, ExpectEqual, true, StructuralsMatchScalar(json, StringSize(json)));
+    DestroyArray(&structurals);
+
+    // Backslash runs of each length ending on either side of the 64-char block boundary.
+    char chars[256] = {};
+    bool boundaries_match = true;
+    for (uint32 run_size = 1; run_size <= 8; run_size += 1) {
+        for (uint32 run_end = 56; run_end <= 72; run_end += 1) {
+            memset(chars, ' ', sizeof(chars));
+            chars[10] = '\"';
+            memset(&chars[run_end - run_size], '\\', run_size);
+            chars[run_end] = '\"';
+            chars[run_end + 2] = '1';
+            chars[run_end + 4] = '\"';
+            boundaries_match &= StructuralsMatchScalar(chars, sizeof(chars));
+        }
+    }
+    RunTest("StructuralsMatchScalar(backslash runs at block boundary)", &pass, ExpectEqual, true, boundaries_match);
+
+    // Random chars from an alphabet of everything the implementations treat differently, at sizes around block sizes.
+    constexpr const char ALPHABET[] = "\"\"\\\\ \t\n{}[]:,a1";
+    uint64 random_state = RandomSeed64(1);
+    bool random_match = true;
+    for (uint32 i = 0; i < 2000; i += 1) {
+        uint32 size = i % sizeof(chars);
+        for (uint32 c = 0; c < size; c += 1) {
+            chars[c] = ALPHABET[Random64(&random_state) % (sizeof(ALPHABET) - 1)];
+        }
+        random_match &= StructuralsMatchScalar(chars, size);
+    }
+    RunTest("StructuralsMatchScalar(random chars)", &pass, ExpectEqual, true, random_match);
+
+    return pass;
+}
+
 bool Run() {
     bool pass = true;
 
     TempStack_Init(&g_std_allocator, Kilobyte32<4>());
 
+    RunTest("StructuralsTest()",          &pass, StructuralsTest);
     RunTest("ValidTest()",                &pass, ValidTest);
     RunTest("ScientificENotationTest()",  &pass, ScientificENotationTest);
     RunTest("ObjectKeyTest()",            &pass, ObjectKeyTest);
@@ -227,9 +544,15 @@ bool Run() {
     RunTest("NegativeDecimalFirstTest()", &pass, NegativeDecimalFirstTest);
     RunTest("EOFBeforeEndOfStringTest()", &pass, EOFBeforeEndOfStringTest);
     RunTest("NoRootTest()",               &pass, NoRootTest);
+    RunTest("UnclosedBracketTest()",      &pass, UnclosedBracketTest);
+    RunTest("MismatchedBracketTest()",    &pass, MismatchedBracketTest);
+    RunTest("UnicodeEscapeTest()",        &pass, UnicodeEscapeTest);
     RunTest("LargeTest()",                &pass, LargeTest);
+    RunTest("MappedTest()",               &pass, MappedTest);
+    RunTest("KeyTableTest()",             &pass, KeyTableTest);
     RunTest("ValidSearchTest()",          &pass, ValidSearchTest);
     RunTest("InvalidSearchTest()",        &pass, InvalidSearchTest);
+    RunTest("PathTest()",                 &pass, PathTest);
     RunTest("ValidGetTest()",             &pass, ValidGetTest);
 
     TempStack_Deinit();
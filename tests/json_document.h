@@ -0,0 +1,175 @@
+#pragma once
+
+namespace JSONDocumentTest {
+
+/// Utils
+////////////////////////////////////////////////////////////
+// Values read on demand from document match node's values, recursing into lists.
+bool ValuesMatch(JSON* json, JSONNode* node, JSONValue value) {
+    if (GetType(value) != node->type) {
+        return false;
+    }
+
+    if (node->type == JSONNodeType::ARRAY || node->type == JSONNodeType::OBJECT) {
+        uint32 child_index = 0;
+        CTK_ITER_JSON(iterator, value) {
+            if (child_index >= node->list.size) {
+                return false;
+            }
+            JSONNode* child = &json->nodes.data[node->list.node_index + child_index];
+            bool key_matches = StringsMatch(&child->key, iterator.key.data, iterator.key.size);
+            if (node->type == JSONNodeType::OBJECT && !key_matches) {
+                return false;
+            }
+            if (!ValuesMatch(json, child, iterator.value)) {
+                return false;
+            }
+            child_index += 1;
+        }
+        return child_index == node->list.size;
+    }
+    if (node->type == JSONNodeType::STRING) {
+        String string = GetString(&g_std_allocator, value);
+        bool match = StringsMatch(&node->string, &string);
+        DestroyString(&string);
+        return match;
+    }
+    if (node->type == JSONNodeType::UINT32)  { return GetUInt32(value)  == node->num_uint32;  }
+    if (node->type == JSONNodeType::SINT32)  { return GetSInt32(value)  == node->num_sint32;  }
+    if (node->type == JSONNodeType::FLOAT32) { return GetFloat32(value) == node->num_float32; }
+    if (node->type == JSONNodeType::BOOLEAN) { return GetBoolean(value) == node->boolean;     }
+    return IsNull(value);
+}
+
+bool DocumentMatches(const char* path) {
+    JSON json = LoadJSON(&g_std_allocator, path);
+    JSONDocument document = LoadJSONDocument(&g_std_allocator, path);
+    bool match = ValuesMatch(&json, &json.root_node, GetRoot(&document));
+    DestroyJSONDocument(&document);
+    DestroyJSON(&json);
+    return match;
+}
+
+void LoadAndDestroyJSONDocument(const char* path) {
+    JSONDocument document = LoadJSONDocument(&g_std_allocator, path);
+    DestroyJSONDocument(&document);
+}
+
+void GetRootValue(JSONDocument* document, const char* key) {
+    GetValue(GetRoot(document), key);
+}
+
+void GetArrayValue(JSONDocument* document, const char* array_key, uint32 index) {
+    GetValue(GetValue(GetRoot(document), array_key), index);
+}
+
+void FindArrayValue(JSONDocument* document, const char* array_key, const char* key) {
+    JSONValue value = {};
+    FindValue(GetValue(GetRoot(document), array_key), key, &value);
+}
+
+void GetRootUInt32(JSONDocument* document, const char* key) {
+    GetUInt32(GetValue(GetRoot(document), key));
+}
+
+void GetRootSize(JSONDocument* document, const char* key) {
+    GetSize(GetValue(GetRoot(document), key));
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool MatchTest() {
+    bool pass = true;
+
+    const char* paths[] = {
+        "tests/data/valid.json",
+        "tests/data/gltf_test.json",
+        "tests/data/object_key_test.json",
+        "tests/data/string_parse_test.json",
+        "tests/data/scientific_e_notation.json",
+        "tests/data/large_object.json",
+    };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(paths); i += 1) {
+        char desc[64] = {};
+        WriteValues(desc, sizeof(desc), "DocumentMatches(", paths[i], ")");
+        RunTest(desc, &pass, ExpectEqual, true, DocumentMatches(paths[i]));
+    }
+
+    return pass;
+}
+
+bool ValueTest() {
+    bool pass = true;
+
+    JSONDocument document = LoadJSONDocument(&g_std_allocator, "tests/data/valid.json");
+    JSONValue root   = GetRoot(&document);
+    JSONValue array  = GetValue(root, "array");
+    JSONValue object = GetValue(root, "object");
+    RunTest("GetUInt32(uint32)",          &pass, ExpectEqual, 1u,    GetUInt32(GetValue(root, "uint32")));
+    RunTest("GetSInt32(sint32)",          &pass, ExpectEqual, -1,    GetSInt32(GetValue(root, "sint32")));
+    RunTest("GetFloat32(float32)",        &pass, ExpectEqual, -2.3f, GetFloat32(GetValue(root, "float32")));
+    RunTest("GetBoolean(bool)",           &pass, ExpectEqual, true,  GetBoolean(GetValue(root, "bool")));
+    RunTest("IsNull(null)",               &pass, ExpectEqual, true,  IsNull(GetValue(root, "null")));
+    RunTest("GetSize(empty_array)",       &pass, ExpectEqual, 0u,    GetSize(GetValue(root, "empty_array")));
+    RunTest("GetSize(array)",             &pass, ExpectEqual, 10u,   GetSize(array));
+    RunTest("GetFloat32(array[2])",       &pass, ExpectEqual, 2.3f,  GetFloat32(GetValue(array, 2u)));
+    RunTest("GetType(array[8])",          &pass, ExpectEqual, true,
+            GetType(GetValue(array, 8u)) == JSONNodeType::ARRAY);
+    RunTest("GetUInt32(object.uint32)",   &pass, ExpectEqual, 4u,    GetUInt32(GetValue(object, "uint32")));
+    RunTest("GetRawString(string)",       &pass, ExpectEqual, true,
+            StringsMatch(GetRawString(GetValue(root, "string")), "this is a \\\"test\\\""));
+
+    String string = GetString(&g_std_allocator, GetValue(root, "string"));
+    RunTest("GetString(string)",          &pass, ExpectEqual, "this is a \"test\"", &string);
+    DestroyString(&string);
+
+    JSONValue value = {};
+    RunTest("FindValue(invalid_key)",     &pass, ExpectEqual, false, FindValue(root, "invalid_key", &value));
+    RunTest("FindValue(object.string)",   &pass, ExpectEqual, true,  FindValue(object, "string", &value));
+    RunTest("GetRawString(object.string)", &pass, ExpectEqual, true,
+            StringsMatch(GetRawString(value), "object string"));
+    DestroyJSONDocument(&document);
+
+    // Empty document's root is an empty array, as with LoadJSON().
+    document = LoadJSONDocument(&g_std_allocator, "tests/data/empty.json");
+    RunTest("GetSize(empty.json root)", &pass, ExpectEqual, 0u, GetSize(GetRoot(&document)));
+    DestroyJSONDocument(&document);
+
+    return pass;
+}
+
+bool InvalidTest() {
+    bool pass = true;
+
+    const char* invalid_paths[] = {
+        "tests/data/eof_string.json",
+        "tests/data/no_root.json",
+        "tests/data/unclosed_bracket.json",
+        "tests/data/mismatched_bracket.json",
+    };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(invalid_paths); i += 1) {
+        char desc[64] = {};
+        WriteValues(desc, sizeof(desc), "LoadJSONDocument(", invalid_paths[i], ")");
+        RunTest(desc, &pass, ExpectFatalError, LoadAndDestroyJSONDocument, invalid_paths[i]);
+    }
+
+    JSONDocument document = LoadJSONDocument(&g_std_allocator, "tests/data/valid.json");
+    RunTest("GetValue(invalid_key)", &pass, ExpectFatalError, GetRootValue,   &document, "invalid_key");
+    RunTest("GetValue(array[10])",   &pass, ExpectFatalError, GetArrayValue,  &document, "array", 10u);
+    RunTest("FindValue(array, key)", &pass, ExpectFatalError, FindArrayValue, &document, "array", "key");
+    RunTest("GetUInt32(sint32)",     &pass, ExpectFatalError, GetRootUInt32,  &document, "sint32");
+    RunTest("GetSize(uint32)",       &pass, ExpectFatalError, GetRootSize,    &document, "uint32");
+    DestroyJSONDocument(&document);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+    RunTest("MatchTest()",   &pass, MatchTest);
+    RunTest("ValueTest()",   &pass, ValueTest);
+    RunTest("InvalidTest()", &pass, InvalidTest);
+    return pass;
+}
+
+}
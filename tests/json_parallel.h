@@ -0,0 +1,203 @@
+#pragma once
+
+namespace JSONParallelTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 THREAD_COUNTS[] = { 1, 2, 3, 4, 16 };
+
+// Forwards to parent, counting calls made from threads other than the one that created it.
+struct ThreadCheckAllocator {
+    Allocator       allocator;
+    Allocator*      parent;
+    DWORD           thread_id;
+    volatile uint32 other_thread_calls;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+void CheckThread(ThreadCheckAllocator* allocator) {
+    if (GetCurrentThreadId() != allocator->thread_id) {
+        AtomicAdd(&allocator->other_thread_calls, 1);
+    }
+}
+
+uint8* ThreadCheck_Allocate(Allocator* allocator, uint32 size, uint32 alignment) {
+    auto thread_check_allocator = (ThreadCheckAllocator*)allocator;
+    CheckThread(thread_check_allocator);
+    return Allocate(thread_check_allocator->parent, size, alignment);
+}
+
+uint8* ThreadCheck_AllocateNZ(Allocator* allocator, uint32 size, uint32 alignment) {
+    auto thread_check_allocator = (ThreadCheckAllocator*)allocator;
+    CheckThread(thread_check_allocator);
+    return AllocateNZ(thread_check_allocator->parent, size, alignment);
+}
+
+uint8* ThreadCheck_Reallocate(Allocator* allocator, void* mem, uint32 size, uint32 alignment) {
+    auto thread_check_allocator = (ThreadCheckAllocator*)allocator;
+    CheckThread(thread_check_allocator);
+    return Reallocate(thread_check_allocator->parent, mem, size, alignment);
+}
+
+uint8* ThreadCheck_ReallocateNZ(Allocator* allocator, void* mem, uint32 size, uint32 alignment) {
+    auto thread_check_allocator = (ThreadCheckAllocator*)allocator;
+    CheckThread(thread_check_allocator);
+    return ReallocateNZ(thread_check_allocator->parent, mem, size, alignment);
+}
+
+void ThreadCheck_Deallocate(Allocator* allocator, void* mem) {
+    auto thread_check_allocator = (ThreadCheckAllocator*)allocator;
+    CheckThread(thread_check_allocator);
+    Deallocate(thread_check_allocator->parent, mem);
+}
+
+ThreadCheckAllocator CreateThreadCheckAllocator(Allocator* parent) {
+    ThreadCheckAllocator allocator = {};
+    allocator.allocator.Allocate     = ThreadCheck_Allocate;
+    allocator.allocator.AllocateNZ   = ThreadCheck_AllocateNZ;
+    allocator.allocator.Reallocate   = ThreadCheck_Reallocate;
+    allocator.allocator.ReallocateNZ = ThreadCheck_ReallocateNZ;
+    allocator.allocator.Deallocate   = ThreadCheck_Deallocate;
+    allocator.parent                 = parent;
+    allocator.thread_id              = GetCurrentThreadId();
+    return allocator;
+}
+
+// Nodes match by value, recursing into lists, as parallel loads order nodes differently to LoadJSON().
+bool NodesMatch(JSON* json_a, JSONNode* node_a, JSON* json_b, JSONNode* node_b) {
+    if (node_a->type != node_b->type || !StringsMatch(&node_a->key, &node_b->key)) {
+        return false;
+    }
+    if (node_a->type == JSONNodeType::ARRAY || node_a->type == JSONNodeType::OBJECT) {
+        if (node_a->list.size != node_b->list.size) {
+            return false;
+        }
+        for (uint32 i = 0; i < node_a->list.size; i += 1) {
+            if (!NodesMatch(json_a, GetNode(json_a, node_a, i), json_b, GetNode(json_b, node_b, i))) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (node_a->type == JSONNodeType::STRING) {
+        return StringsMatch(&node_a->string, &node_b->string);
+    }
+    return node_a->num_uint32 == node_b->num_uint32;
+}
+
+bool ParallelLoadMatches(const char* path, uint32 thread_count) {
+    ThreadPool thread_pool = {};
+    InitThreadPool(&thread_pool, &g_std_allocator, thread_count);
+    JSON json          = LoadJSON        (&g_std_allocator, path);
+    JSON parallel_json = LoadJSONParallel(&g_std_allocator, path, &thread_pool);
+    bool match = json.nodes.count == parallel_json.nodes.count && json.max_keys == parallel_json.max_keys &&
+                 NodesMatch(&json, &json.root_node, &parallel_json, &parallel_json.root_node);
+    DestroyJSON(&parallel_json);
+    DestroyJSON(&json);
+    DestroyThreadPool(&thread_pool);
+    return match;
+}
+
+void LoadJSONParallelAndDestroy(const char* path, ThreadPool* thread_pool) {
+    JSON json = LoadJSONParallel(&g_std_allocator, path, thread_pool);
+    DestroyJSON(&json);
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool MatchTest() {
+    bool pass = true;
+
+    // valid.json's root is an object, so it's parsed on the calling thread.
+    const char* paths[] = {
+        "tests/data/root_array.json",
+        "tests/data/large_objects.json",
+        "tests/data/valid.json",
+    };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(paths); i += 1) {
+        for (uint32 j = 0; j < CTK_ARRAY_SIZE(THREAD_COUNTS); j += 1) {
+            char desc[64] = {};
+            WriteValues(desc, sizeof(desc), "ParallelLoadMatches(", paths[i], ", ", THREAD_COUNTS[j], ")");
+            RunTest(desc, &pass, ExpectEqual, true, ParallelLoadMatches(paths[i], THREAD_COUNTS[j]));
+        }
+    }
+
+    // Lookups work on parallel loaded nodes.
+    ThreadPool thread_pool = {};
+    InitThreadPool(&thread_pool, &g_std_allocator, 4);
+    JSON json = LoadJSONParallel(&g_std_allocator, "tests/data/root_array.json", &thread_pool);
+    RunTest("SearchString([1].name)", &pass, ExpectEqual, "second record", SearchString(&json, "[1].name"));
+    RunTest("SearchString([10].meta.nested.a[0].b)", &pass, ExpectEqual, "c",
+            SearchString(&json, "[10].meta.nested.a[0].b"));
+    RunTest("GetUInt32([10], id)", &pass, ExpectEqual, 2u, GetUInt32(&json, GetObject(&json, 10u), "id"));
+    DestroyJSON(&json);
+
+    // Batches build key tables for their large objects in their own regions of key_tables.
+    json = LoadJSONParallel(&g_std_allocator, "tests/data/large_objects.json", &thread_pool);
+    bool values_match = true;
+    for (uint32 i = 0; i < 12; i += 1) {
+        JSONNode* object = GetObject(&json, i);
+        values_match &= object->list.key_table_index != 0 && GetUInt32(&json, object, "key_39") == i * 100 + 39;
+    }
+    RunTest("GetUInt32([0 to 11], key_39)", &pass, ExpectEqual, true, values_match);
+    DestroyJSON(&json);
+    DestroyThreadPool(&thread_pool);
+
+    return pass;
+}
+
+bool AllocatorTest() {
+    bool pass = true;
+
+    // Allocators aren't thread-safe, so batches mustn't use json's allocator, including for their key tables. The 12
+    // large objects are split across all 4 batches.
+    FreeList free_list = CreateFreeList(&g_std_allocator, Megabyte32<1>(), { 256 });
+    ThreadCheckAllocator allocator = CreateThreadCheckAllocator(&free_list.allocator);
+    ThreadPool thread_pool = {};
+    InitThreadPool(&thread_pool, &g_std_allocator, 4);
+    JSON json = LoadJSONParallel(&allocator.allocator, "tests/data/large_objects.json", &thread_pool);
+    bool values_match = true;
+    for (uint32 i = 0; i < 12; i += 1) {
+        JSONNode* object = GetObject(&json, i);
+        values_match &= object->list.key_table_index != 0 && GetUInt32(&json, object, "key_0") == i * 100;
+    }
+    RunTest("GetUInt32([0 to 11], key_0)", &pass, ExpectEqual, true, values_match);
+    DestroyJSON(&json);
+    RunTest("other_thread_calls", &pass, ExpectEqual, 0u, allocator.other_thread_calls);
+    DestroyThreadPool(&thread_pool);
+    DestroyFreeList(&free_list);
+
+    return pass;
+}
+
+bool InvalidTest() {
+    bool pass = true;
+
+    // Errors in batches are caught on their thread and reported by LoadJSONParallel().
+    ThreadPool thread_pool = {};
+    InitThreadPool(&thread_pool, &g_std_allocator, 2);
+    const char* invalid_paths[] = {
+        "tests/data/root_array_invalid.json",
+        "tests/data/mismatched_bracket.json",
+        "tests/data/eof_string.json",
+    };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(invalid_paths); i += 1) {
+        char desc[64] = {};
+        WriteValues(desc, sizeof(desc), "LoadJSONParallel(", invalid_paths[i], ")");
+        RunTest(desc, &pass, ExpectFatalError, LoadJSONParallelAndDestroy, invalid_paths[i], &thread_pool);
+    }
+    DestroyThreadPool(&thread_pool);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+    RunTest("MatchTest()",     &pass, MatchTest);
+    RunTest("AllocatorTest()", &pass, AllocatorTest);
+    RunTest("InvalidTest()",   &pass, InvalidTest);
+    return pass;
+}
+
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+namespace JSONParallelPerfTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr const char* TEST_FILE_PATH   = "tests/data/json_parallel_perf.json";
+constexpr uint32      TEST_FILE_SIZE   = Gigabyte32<2>(); // Loading needs about 8 times this much memory.
+constexpr uint32      TEST_PASSES      = 3;
+constexpr uint32      MAX_THREAD_COUNT = 64;
+constexpr const char* TAGS[]           = { "alpha", "beta", "gamma", "delta", "weights", "tex\\coord" };
+
+struct TestFile {
+    HANDLE handle;
+    uint64 size;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+void WriteTestFile(void* data, const char* chars, uint32 size) {
+    auto test_file = (TestFile*)data;
+    WriteJSONFile(test_file->handle, chars, size);
+    test_file->size += size;
+}
+
+void WriteRecord(JSONWriter* writer, uint32 id, uint64* random_state) {
+    uint64 random = Random64(random_state);
+    BeginObject(writer);
+    WriteKey(writer, "id");      WriteUInt32 (writer, id);
+    WriteKey(writer, "name");    WriteString (writer, TAGS[random % CTK_ARRAY_SIZE(TAGS)]);
+    WriteKey(writer, "enabled"); WriteBoolean(writer, (random >> 8) & 1);
+    WriteKey(writer, "offset");  WriteSInt32 (writer, -(sint32)((random >> 16) % 100000));
+    WriteKey(writer, "scale");   WriteFloat32(writer, (float32)((random >> 32) % 100000) / 1000.0f);
+    WriteKey(writer, "position");
+    BeginArray(writer);
+    for (uint32 i = 0; i < 3; i += 1) {
+        WriteFloat32(writer, (float32)(Random64(random_state) % 100000) / 100000.0f);
+    }
+    EndArray(writer);
+    WriteKey(writer, "tags");
+    BeginArray(writer);
+    for (uint32 i = 0; i < (random >> 40) % 4; i += 1) {
+        WriteString(writer, TAGS[(random >> (44 + i * 4)) % CTK_ARRAY_SIZE(TAGS)]);
+    }
+    EndArray(writer);
+    WriteKey(writer, "meta");
+    BeginObject(writer);
+    WriteKey(writer, "parent"); WriteNull(writer);
+    WriteKey(writer, "nested");
+    BeginObject(writer);
+    WriteKey(writer, "a"); BeginArray(writer);  EndArray(writer);
+    WriteKey(writer, "b"); BeginObject(writer); EndObject(writer);
+    EndObject(writer);
+    EndObject(writer);
+    EndObject(writer);
+}
+
+// Writes a root array of records until the file reaches TEST_FILE_SIZE.
+void GenerateTestFile() {
+    TestFile test_file = {};
+    test_file.handle = CreateFile(TEST_FILE_PATH, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (test_file.handle == INVALID_HANDLE_VALUE) {
+        Win32Error e = {};
+        GetWin32Error(&e);
+        CTK_FATAL("CreateFile() failed for \"%s\": %.*s", TEST_FILE_PATH, e.message_length, e.message);
+    }
+
+    JSONWriter writer = CreateJSONWriter(&g_std_allocator, WriteTestFile, &test_file, 1024 * 1024,
+                                         JSONWriteMode::PRETTY, 8);
+    uint64 random_state = RandomSeed64(1);
+    BeginArray(&writer);
+    for (uint32 id = 0; test_file.size < TEST_FILE_SIZE; id += 1) {
+        WriteRecord(&writer, id, &random_state);
+    }
+    EndArray(&writer);
+    DestroyJSONWriter(&writer);
+    CloseHandle(test_file.handle);
+}
+
+void PrintStage(const char* name, float64 ms, float64 file_size_gb, float64 base_ms) {
+    PrintLine("    %-16s %9.2f ms  %6.3f GB / sec  %5.2fx", name, ms, file_size_gb / (ms / 1000.0), base_ms / ms);
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+void Run() {
+    PrintLine("\nJSON Parallel Performance Test");
+
+    GenerateTestFile();
+    float64 file_size_gb = GetFileSize(TEST_FILE_PATH) / 1000000000.0;
+    SYSTEM_INFO system_info = {};
+    GetSystemInfo(&system_info);
+    uint32 max_thread_count = Min((uint32)system_info.dwNumberOfProcessors, MAX_THREAD_COUNT);
+    PrintLine("%.3f GB file, average of %u passes:", file_size_gb, TEST_PASSES);
+
+    float64 load_ms = 0;
+    for (uint32 pass = 0; pass < TEST_PASSES; pass += 1) {
+        Profile prof = BeginProfile("LoadJSON");
+        JSON json = LoadJSON(&g_std_allocator, TEST_FILE_PATH);
+        EndProfile(&prof);
+        DestroyJSON(&json);
+        load_ms += prof.ms;
+    }
+    load_ms /= TEST_PASSES;
+    PrintStage("LoadJSON", load_ms, file_size_gb, load_ms);
+
+    // Thread counts double up to the processor count. Speedups are relative to LoadJSON().
+    for (uint32 thread_count = 1; true; thread_count = Min(thread_count * 2, max_thread_count)) {
+        ThreadPool thread_pool = {};
+        InitThreadPool(&thread_pool, &g_std_allocator, thread_count);
+        float64 parallel_ms = 0;
+        for (uint32 pass = 0; pass < TEST_PASSES; pass += 1) {
+            Profile prof = BeginProfile("LoadJSONParallel");
+            JSON json = LoadJSONParallel(&g_std_allocator, TEST_FILE_PATH, &thread_pool);
+            EndProfile(&prof);
+            DestroyJSON(&json);
+            parallel_ms += prof.ms;
+        }
+        DestroyThreadPool(&thread_pool);
+
+        char name[32] = {};
+        WriteValues(name, sizeof(name), thread_count, " threads");
+        PrintStage(name, parallel_ms / TEST_PASSES, file_size_gb, load_ms);
+        if (thread_count == max_thread_count) {
+            break;
+        }
+    }
+
+    DeleteFile(TEST_FILE_PATH);
+}
+
+}
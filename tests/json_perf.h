@@ -2,27 +2,101 @@
 
 namespace JSONPerfTest {
 
+/// Data
+////////////////////////////////////////////////////////////
+constexpr const char* TEST_FILE_PATH = "tests/data/large.json";
+constexpr uint32      TEST_PASSES    = 10;
+
+/// Utils
+////////////////////////////////////////////////////////////
+void CountEvent(void* data, JSONEvent* event) {
+    *(uint64*)data += 1;
+}
+
+// Sums the "id" of every record, leaving the rest of each record unread.
+uint64 SumRecordIDs(JSONDocument* document) {
+    uint64 id_sum = 0;
+    CTK_ITER_JSON(record, GetValue(GetRoot(document), "records")) {
+        id_sum += GetUInt32(GetValue(record.value, "id"));
+    }
+    return id_sum;
+}
+
+void PrintStage(const char* name, float64 ms, float64 file_size_gb) {
+    PrintLine("    %-12s %8.2f ms  %6.3f GB / sec", name, ms, file_size_gb / (ms / 1000.0));
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
 void Run() {
     PrintLine("\nJSON Performance Test");
 
-    float64 file_size_gb = GetFileSize("tests/data/large.json") / 1000000000.0;
-    constexpr uint32 TEST_PASSES = 100;
-    float64 total_ms = 0;
+    float64 file_size_gb = GetFileSize(TEST_FILE_PATH) / 1000000000.0;
+    float64 tokens_ms    = 0;
+    float64 nodes_ms     = 0;
+    float64 total_ms     = 0;
+    float64 mapped_ms    = 0;
+    float64 reader_ms    = 0;
+    float64 document_ms  = 0;
     for (uint32 pass = 0; pass < TEST_PASSES; pass += 1) {
-        FString<16> prof_name = {};
-        Write(&prof_name, "pass %2u", pass);
-        Profile prof = BeginProfile(prof_name.data);
+        // Time stages separately to see where load time goes.
+        String json_file = ReadFile<char>(&g_std_allocator, TEST_FILE_PATH);
+        JSON json = {};
+        json.allocator = &g_std_allocator;
 
-        JSON json = LoadJSON(&g_std_allocator, "tests/data/large.json");
+        Profile tokens_prof = BeginProfile("tokens");
+        Array<JSONToken> tokens = ParseTokens(&json, &json_file);
+        EndProfile(&tokens_prof);
+
+        Profile nodes_prof = BeginProfile("nodes");
+        ParseNodes(&json, &json_file, &tokens);
+        EndProfile(&nodes_prof);
+
+        DestroyArray(&tokens);
+        DestroyJSON(&json);
+        DestroyString(&json_file);
+        tokens_ms += tokens_prof.ms;
+        nodes_ms  += nodes_prof.ms;
+
+        // Time LoadJSON() as a whole, including reading the file.
+        Profile load_prof = BeginProfile("LoadJSON");
+        json = LoadJSON(&g_std_allocator, TEST_FILE_PATH);
+        EndProfile(&load_prof);
         DestroyJSON(&json);
+        total_ms += load_prof.ms;
 
-        EndProfile(&prof);
-        PrintProfile(&prof);
-        total_ms += prof.ms;
-        PrintLine(" (%.3f GB / sec)", file_size_gb / (prof.ms / 1000.0));
+        // Time LoadMappedJSON(), which tokenizes the mapped file and only copies strings with escape sequences.
+        Profile mapped_prof = BeginProfile("LoadMappedJSON");
+        json = LoadMappedJSON(&g_std_allocator, TEST_FILE_PATH);
+        EndProfile(&mapped_prof);
+        DestroyJSON(&json);
+        mapped_ms += mapped_prof.ms;
+
+        // Stream events through a fixed 64 KB buffer instead of loading the file.
+        uint64 event_count = 0;
+        Profile reader_prof = BeginProfile("JSONReader");
+        JSONReader reader = CreateJSONFileReader(&g_std_allocator, TEST_FILE_PATH, 64 * 1024, 64);
+        ReadJSON(&reader, CountEvent, &event_count);
+        DestroyJSONReader(&reader);
+        EndProfile(&reader_prof);
+        reader_ms += reader_prof.ms;
+
+        // Tokenize without building nodes, then read one field per record on demand.
+        Profile document_prof = BeginProfile("JSONDocument");
+        JSONDocument document = LoadJSONDocument(&g_std_allocator, TEST_FILE_PATH);
+        SumRecordIDs(&document);
+        DestroyJSONDocument(&document);
+        EndProfile(&document_prof);
+        document_ms += document_prof.ms;
     }
-    float64 average_ms = total_ms / TEST_PASSES;
-    PrintLine("average: %.f ms (%.3f GB / sec)", average_ms, file_size_gb / (average_ms / 1000.0));
+
+    PrintLine("average of %u passes:", TEST_PASSES);
+    PrintStage("ParseTokens", tokens_ms   / TEST_PASSES, file_size_gb);
+    PrintStage("ParseNodes",  nodes_ms    / TEST_PASSES, file_size_gb);
+    PrintStage("LoadJSON",    total_ms    / TEST_PASSES, file_size_gb);
+    PrintStage("LoadMapped",  mapped_ms   / TEST_PASSES, file_size_gb);
+    PrintStage("JSONReader",  reader_ms   / TEST_PASSES, file_size_gb);
+    PrintStage("OnDemand",    document_ms / TEST_PASSES, file_size_gb);
 }
 
 }
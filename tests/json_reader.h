@@ -0,0 +1,281 @@
+#pragma once
+
+namespace JSONReaderTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+struct MemoryInput {
+    const char* json;
+    uint32      size;
+    uint32      offset;
+    uint32      max_read_size;
+};
+
+constexpr const char* TEST_JSON =
+    "{\n"
+    "    \"uint32\": 1, \"sint32\": -2, \"float32\": 2.5e2,\n"
+    "    \"string\": \"this is a \\\"test\\\"\",\n"
+    "    \"literals\": [true, false, null],\n"
+    "    \"empty\": [{}, [],],\n"
+    "    \"nested\": {\"array\": [[1], {\"key\": \"value\"}]},\n"
+    "},\n";
+
+constexpr const char* TEST_JSON_EVENTS =
+    "BEGIN_OBJECT 0\n"
+    "KEY 1 uint32\n"    "UINT32 1 1\n"
+    "KEY 1 sint32\n"    "SINT32 1 -2\n"
+    "KEY 1 float32\n"   "FLOAT32 1 250\n"
+    "KEY 1 string\n"    "STRING 1 this is a \\\"test\\\"\n"
+    "KEY 1 literals\n"  "BEGIN_ARRAY 1\n" "BOOLEAN 2 true\n" "BOOLEAN 2 false\n" "NULL 2 null\n" "END_ARRAY 1\n"
+    "KEY 1 empty\n"     "BEGIN_ARRAY 1\n" "BEGIN_OBJECT 2\n" "END_OBJECT 2\n" "BEGIN_ARRAY 2\n" "END_ARRAY 2\n"
+                        "END_ARRAY 1\n"
+    "KEY 1 nested\n"    "BEGIN_OBJECT 1\n"
+    "KEY 2 array\n"     "BEGIN_ARRAY 2\n" "BEGIN_ARRAY 3\n" "UINT32 4 1\n" "END_ARRAY 3\n" "BEGIN_OBJECT 3\n"
+    "KEY 4 key\n"       "STRING 4 value\n" "END_OBJECT 3\n" "END_ARRAY 2\n" "END_OBJECT 1\n"
+    "END_OBJECT 0\n";
+
+/// Utils
+////////////////////////////////////////////////////////////
+uint32 ReadMemoryInput(void* data, char* buffer, uint32 size) {
+    auto input = (MemoryInput*)data;
+    uint32 read_size = Min(Min(size, input->max_read_size), input->size - input->offset);
+    memcpy(buffer, &input->json[input->offset], read_size);
+    input->offset += read_size;
+    return read_size;
+}
+
+// Appends a line per event to trace, so events can be compared across buffer and read sizes.
+void TraceEvents(JSONReader* reader, String* trace) {
+    JSONEvent event = {};
+    while (NextEvent(reader, &event)) {
+        AppendValues(trace, JSONEventTypeName(event.type), " ", event.depth);
+        if (event.type == JSONEventType::UINT32) {
+            AppendValues(trace, " ", event.num_uint32);
+        }
+        else if (event.type == JSONEventType::SINT32) {
+            AppendValues(trace, " ", event.num_sint32);
+        }
+        else if (event.type == JSONEventType::FLOAT32) {
+            AppendValues(trace, " ", event.num_float32);
+        }
+        else if (event.type == JSONEventType::BOOLEAN) {
+            AppendValues(trace, " ", event.boolean);
+        }
+        else if (event.text.size > 0) {
+            AppendValues(trace, " ", event.text);
+        }
+        AppendValues(trace, "\n");
+    }
+}
+
+bool TraceMatches(const char* json, uint32 buffer_size, uint32 max_read_size, const char* expected_trace) {
+    MemoryInput input = { .json = json, .size = StringSize(json), .offset = 0, .max_read_size = max_read_size };
+    JSONReader reader = CreateJSONReader(&g_std_allocator, ReadMemoryInput, &input, buffer_size, 8);
+    String trace = CreateString(&g_std_allocator, 256);
+    TraceEvents(&reader, &trace);
+    bool match = StringsMatch(&trace, expected_trace);
+    DestroyString(&trace);
+    DestroyJSONReader(&reader);
+    return match;
+}
+
+// Reads all of json's events.
+void ReadAllEvents(const char* json, uint32 buffer_size, uint32 max_depth) {
+    MemoryInput input = { .json = json, .size = StringSize(json), .offset = 0, .max_read_size = UINT32_MAX };
+    JSONReader reader = CreateJSONReader(&g_std_allocator, ReadMemoryInput, &input, buffer_size, max_depth);
+    JSONEvent event = {};
+    while (NextEvent(&reader, &event)) {}
+    DestroyJSONReader(&reader);
+}
+
+bool FileTraceMatches(const char* path, const char* expected_trace) {
+    JSONReader reader = CreateJSONFileReader(&g_std_allocator, path, 64, 8);
+    String trace = CreateString(&g_std_allocator, 256);
+    TraceEvents(&reader, &trace);
+    bool match = StringsMatch(&trace, expected_trace);
+    DestroyString(&trace);
+    DestroyJSONReader(&reader);
+    return match;
+}
+
+void ReadAllFileEvents(const char* path) {
+    JSONReader reader = CreateJSONFileReader(&g_std_allocator, path, 64, 8);
+    JSONEvent event = {};
+    while (NextEvent(&reader, &event)) {}
+    DestroyJSONReader(&reader);
+}
+
+// JSONDocument only reads values when they're iterated, so every list is iterated to read the whole document.
+void IterateAllValues(JSONValue value) {
+    JSONNodeType type = GetType(value);
+    if (type == JSONNodeType::ARRAY || type == JSONNodeType::OBJECT) {
+        CTK_ITER_JSON(iterator, value) {
+            IterateAllValues(iterator.value);
+        }
+    }
+}
+
+void ReadJSONDocument(const char* path) {
+    JSONDocument document = LoadJSONDocument(&g_std_allocator, path);
+    IterateAllValues(GetRoot(&document));
+    DestroyJSONDocument(&document);
+}
+
+void CreateInvalidFileReader(uint32 buffer_size, uint32 max_depth) {
+    CreateJSONFileReader(&g_std_allocator, "tests/data/valid.json", buffer_size, max_depth);
+}
+
+// Opening without sharing fails while any other handle to path is open.
+bool CanOpenExclusively(const char* path) {
+    HANDLE file = CreateFile(path, GENERIC_READ, 0, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    CloseHandle(file);
+    return true;
+}
+
+void CountEvent(void* data, JSONEvent* event) {
+    ((uint32*)data)[(uint32)event->type] += 1;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool EventTest() {
+    bool pass = true;
+
+    RunTest("TraceMatches(TEST_JSON, 256, UINT32_MAX)", &pass, ExpectEqual, true,
+            TraceMatches(TEST_JSON, 256, UINT32_MAX, TEST_JSON_EVENTS));
+    RunTest("TraceMatches(\"\", 16, UINT32_MAX)", &pass, ExpectEqual, true, TraceMatches("", 16, UINT32_MAX, ""));
+    RunTest("TraceMatches(\" [] \", 16, UINT32_MAX)", &pass, ExpectEqual, true,
+            TraceMatches(" [] ", 16, UINT32_MAX, "BEGIN_ARRAY 0\nEND_ARRAY 0\n"));
+
+    return pass;
+}
+
+bool SplitTokenTest() {
+    bool pass = true;
+
+    // Buffers just big enough for the largest token, and reads small enough to split every token.
+    for (uint32 buffer_size = 24; buffer_size <= 40; buffer_size += 8) {
+        for (uint32 max_read_size = 1; max_read_size <= 7; max_read_size += 1) {
+            char desc[64] = {};
+            WriteValues(desc, sizeof(desc), "TraceMatches(TEST_JSON, ", buffer_size, ", ", max_read_size, ")");
+            RunTest(desc, &pass, ExpectEqual, true,
+                    TraceMatches(TEST_JSON, buffer_size, max_read_size, TEST_JSON_EVENTS));
+        }
+    }
+
+    return pass;
+}
+
+bool FileTest() {
+    bool pass = true;
+
+    // Event counts from reading valid.json through a small buffer match the nodes LoadJSON() creates for it.
+    uint32 event_counts[(uint32)JSONEventType::NULL_ + 1] = {};
+    JSONReader reader = CreateJSONFileReader(&g_std_allocator, "tests/data/valid.json", 64, 8);
+    ReadJSON(&reader, CountEvent, event_counts);
+    DestroyJSONReader(&reader);
+
+    JSON json = LoadJSON(&g_std_allocator, "tests/data/valid.json");
+    uint32 node_counts[(uint32)JSONNodeType::NULL_ + 1] = {};
+    for (uint32 i = 0; i < json.nodes.count; i += 1) {
+        node_counts[(uint32)json.nodes.data[i].type] += 1;
+    }
+    RunTest("BEGIN_OBJECT events", &pass, ExpectEqual, node_counts[(uint32)JSONNodeType::OBJECT] + 1,
+            event_counts[(uint32)JSONEventType::BEGIN_OBJECT]);
+    RunTest("END_OBJECT events",   &pass, ExpectEqual, node_counts[(uint32)JSONNodeType::OBJECT] + 1,
+            event_counts[(uint32)JSONEventType::END_OBJECT]);
+    RunTest("BEGIN_ARRAY events",  &pass, ExpectEqual, node_counts[(uint32)JSONNodeType::ARRAY],
+            event_counts[(uint32)JSONEventType::BEGIN_ARRAY]);
+    RunTest("KEY events",          &pass, ExpectEqual, json.max_keys, event_counts[(uint32)JSONEventType::KEY]);
+    RunTest("FLOAT32 events",      &pass, ExpectEqual, node_counts[(uint32)JSONNodeType::FLOAT32],
+            event_counts[(uint32)JSONEventType::FLOAT32]);
+    RunTest("STRING events",       &pass, ExpectEqual, node_counts[(uint32)JSONNodeType::STRING],
+            event_counts[(uint32)JSONEventType::STRING]);
+    DestroyJSON(&json);
+
+    return pass;
+}
+
+// LoadJSON(), JSONDocument and JSONReader accept and reject the same commas.
+bool CommaTest() {
+    bool pass = true;
+
+    RunTest("DocumentMatches(optional_commas.json)", &pass, ExpectEqual, true,
+            JSONDocumentTest::DocumentMatches("tests/data/optional_commas.json"));
+    RunTest("FileTraceMatches(optional_commas.json)", &pass, ExpectEqual, true,
+            FileTraceMatches("tests/data/optional_commas.json",
+                             "BEGIN_OBJECT 0\n"
+                             "KEY 1 a\n"       "BEGIN_ARRAY 1\n"
+                             "UINT32 2 1\n"    "UINT32 2 2\n"
+                             "END_ARRAY 1\n"
+                             "KEY 1 b\n"       "BEGIN_OBJECT 1\n"
+                             "KEY 2 c\n"       "UINT32 2 3\n"
+                             "KEY 2 d\n"       "BEGIN_ARRAY 2\n" "END_ARRAY 2\n"
+                             "END_OBJECT 1\n"
+                             "END_OBJECT 0\n"));
+
+    const char* invalid_paths[] = {
+        "tests/data/repeated_comma_array.json",
+        "tests/data/repeated_comma_object.json",
+        "tests/data/repeated_trailing_comma.json",
+    };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(invalid_paths); i += 1) {
+        char desc[128] = {};
+        WriteValues(desc, sizeof(desc), "LoadJSON(", invalid_paths[i], ")");
+        RunTest(desc, &pass, ExpectFatalError, LoadJSON, &g_std_allocator, invalid_paths[i]);
+        WriteValues(desc, sizeof(desc), "ReadJSONDocument(", invalid_paths[i], ")");
+        RunTest(desc, &pass, ExpectFatalError, ReadJSONDocument, invalid_paths[i]);
+        WriteValues(desc, sizeof(desc), "ReadAllFileEvents(", invalid_paths[i], ")");
+        RunTest(desc, &pass, ExpectFatalError, ReadAllFileEvents, invalid_paths[i]);
+    }
+
+    return pass;
+}
+
+bool InvalidTest() {
+    bool pass = true;
+
+    const char* invalid_jsons[] = {
+        "[[[1]]]",              // Deeper than max depth.
+        "[\"a long string\"]",  // Token larger than buffer.
+        "[1}",                  // Mismatched bracket.
+        "{\"key\" 1}",          // Missing colon.
+        "{1: 1}",               // Non-string key.
+        "[1,, 2]",              // Repeated comma.
+        "[\"string",            // Unterminated string.
+        "[1, 2",                // Unterminated array.
+        "[tru]",                // Invalid literal.
+        "[1.2.3]",              // Multiple decimals.
+        "[1e]",                 // Exponent without digits.
+        "\"root\"",             // Root isn't an array or object.
+        "[] []",                // Second root.
+    };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(invalid_jsons); i += 1) {
+        char desc[64] = {};
+        WriteValues(desc, sizeof(desc), "ReadAllEvents(", invalid_jsons[i], ", 12, 2)");
+        RunTest(desc, &pass, ExpectFatalError, ReadAllEvents, invalid_jsons[i], 12u, 2u);
+    }
+
+    // Invalid settings are caught before the file is opened, so it isn't left open.
+    RunTest("CreateJSONFileReader(buffer_size = 0)", &pass, ExpectFatalError, CreateInvalidFileReader, 0u, 8u);
+    RunTest("CreateJSONFileReader(max_depth = 0)",   &pass, ExpectFatalError, CreateInvalidFileReader, 64u, 0u);
+    RunTest("CanOpenExclusively(valid.json)",        &pass, ExpectEqual, true,
+            CanOpenExclusively("tests/data/valid.json"));
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+    RunTest("EventTest()",      &pass, EventTest);
+    RunTest("SplitTokenTest()", &pass, SplitTokenTest);
+    RunTest("FileTest()",       &pass, FileTest);
+    RunTest("CommaTest()",      &pass, CommaTest);
+    RunTest("InvalidTest()",    &pass, InvalidTest);
+    return pass;
+}
+
+}
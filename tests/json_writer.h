@@ -0,0 +1,345 @@
+#pragma once
+
+namespace JSONWriterTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr const char* TEST_FILE_PATH = "tests/data/json_writer_test.json";
+
+constexpr const char* BUILDER_COMPACT =
+    "{\"uint32\":1,\"sint32\":-2,\"float32\":2.0,\"string\":\"a \\\"quoted\\\"\\n\\\\string\\u0000\\b\\f\\u001F\","
+    "\"literals\":[true,false,null],\"empty\":[{},[]],\"nested\":{\"array\":[[1],{\"key\":\"value\"}]}}";
+
+constexpr const char* BUILDER_PRETTY =
+    "{\n"
+    "    \"uint32\": 1,\n"
+    "    \"sint32\": -2,\n"
+    "    \"float32\": 2.0,\n"
+    "    \"string\": \"a \\\"quoted\\\"\\n\\\\string\\u0000\\b\\f\\u001F\",\n"
+    "    \"literals\": [\n"
+    "        true,\n"
+    "        false,\n"
+    "        null\n"
+    "    ],\n"
+    "    \"empty\": [\n"
+    "        {},\n"
+    "        []\n"
+    "    ],\n"
+    "    \"nested\": {\n"
+    "        \"array\": [\n"
+    "            [\n"
+    "                1\n"
+    "            ],\n"
+    "            {\n"
+    "                \"key\": \"value\"\n"
+    "            }\n"
+    "        ]\n"
+    "    }\n"
+    "}\n";
+
+/// Utils
+////////////////////////////////////////////////////////////
+void WriteBuilderJSON(JSONWriter* writer) {
+    BeginObject(writer);
+    WriteKey(writer, "uint32");   WriteUInt32(writer, 1);
+    WriteKey(writer, "sint32");   WriteSInt32(writer, -2);
+    WriteKey(writer, "float32");  WriteFloat32(writer, 2.0f);
+    WriteKey(writer, "string");   WriteString(writer, "a \"quoted\"\n\\string\0\b\f\x1F", 22);
+    WriteKey(writer, "literals");
+    BeginArray(writer);
+    WriteBoolean(writer, true);
+    WriteBoolean(writer, false);
+    WriteNull(writer);
+    EndArray(writer);
+    WriteKey(writer, "empty");
+    BeginArray(writer);
+    BeginObject(writer);
+    EndObject(writer);
+    BeginArray(writer);
+    EndArray(writer);
+    EndArray(writer);
+    WriteKey(writer, "nested");
+    BeginObject(writer);
+    WriteKey(writer, "array");
+    BeginArray(writer);
+    BeginArray(writer);
+    WriteUInt32(writer, 1);
+    EndArray(writer);
+    BeginObject(writer);
+    WriteKey(writer, "key");
+    WriteString(writer, "value");
+    EndObject(writer);
+    EndArray(writer);
+    EndObject(writer);
+    EndObject(writer);
+}
+
+bool BuilderOutputMatches(JSONWriteMode mode, const char* expected) {
+    String out = CreateString(&g_std_allocator);
+    JSONWriter writer = CreateJSONWriter(&g_std_allocator, &out, mode, 8);
+    WriteBuilderJSON(&writer);
+    DestroyJSONWriter(&writer);
+    bool match = StringsMatch(&out, expected);
+    DestroyString(&out);
+    return match;
+}
+
+void AppendOutput(void* data, const char* chars, uint32 size) {
+    AppendValues((String*)data, StringView{ chars, size });
+}
+
+bool FindEscapeCharMatchesScalar(const char* string, uint32 size) {
+    uint32 expected = Scalar_FindEscapeChar(string, size);
+    bool match = SSE2_FindEscapeChar(string, size) == expected;
+    if (HasAVX2()) {
+        match &= AVX2_FindEscapeChar(string, size) == expected;
+    }
+    return match;
+}
+
+// Writing every ASCII char as a string and unescaping the output gives the chars back.
+bool ASCIIRoundTripMatches() {
+    char chars[128] = {};
+    for (uint32 i = 0; i < sizeof(chars); i += 1) {
+        chars[i] = (char)i;
+    }
+    String out = CreateString(&g_std_allocator);
+    JSONWriter writer = CreateJSONWriter(&g_std_allocator, &out, JSONWriteMode::COMPACT, 1);
+    BeginArray(&writer);
+    WriteString(&writer, chars, sizeof(chars));
+    EndArray(&writer);
+    DestroyJSONWriter(&writer);
+
+    // Output is ["..."]; only the string's contents are unescaped. Output can't contain raw control chars.
+    bool match = true;
+    for (uint32 i = 0; i < out.count; i += 1) {
+        match &= (uint8)out.data[i] >= 0x20;
+    }
+    char unescaped[sizeof(chars)] = {};
+    uint32 unescaped_size = UnescapeJSONString(&out.data[2], out.count - 4, unescaped);
+    match &= unescaped_size == sizeof(chars) && memcmp(unescaped, chars, sizeof(chars)) == 0;
+    DestroyString(&out);
+    return match;
+}
+
+// Writing path's JSON, loading the output back and writing it again gives the same output.
+bool RoundTripMatches(const char* path, JSONWriteMode mode) {
+    JSON json = LoadJSON(&g_std_allocator, path);
+    String out = CreateString(&g_std_allocator);
+    JSONWriter writer = CreateJSONWriter(&g_std_allocator, &out, mode, Max(json.max_depth, 1u));
+    WriteJSON(&writer, &json);
+    DestroyJSONWriter(&writer);
+
+    SaveJSON(&json, TEST_FILE_PATH, mode);
+    DestroyJSON(&json);
+    json = LoadJSON(&g_std_allocator, TEST_FILE_PATH);
+    String round_trip_out = CreateString(&g_std_allocator);
+    writer = CreateJSONWriter(&g_std_allocator, &round_trip_out, mode, Max(json.max_depth, 1u));
+    WriteJSON(&writer, &json);
+    DestroyJSONWriter(&writer);
+    DestroyJSON(&json);
+    DeleteFile(TEST_FILE_PATH);
+
+    bool match = StringsMatch(&out, &round_trip_out);
+    DestroyString(&round_trip_out);
+    DestroyString(&out);
+    return match;
+}
+
+void WriteFloat32Root(float32 value) {
+    String out = CreateString(&g_std_allocator);
+    JSONWriter writer = CreateJSONWriter(&g_std_allocator, &out, JSONWriteMode::COMPACT, 1);
+    BeginArray(&writer);
+    WriteFloat32(&writer, value);
+    EndArray(&writer);
+    DestroyJSONWriter(&writer);
+    DestroyString(&out);
+}
+
+bool Float32OutputMatches(float32 value, const char* expected) {
+    String out = CreateString(&g_std_allocator);
+    JSONWriter writer = CreateJSONWriter(&g_std_allocator, &out, JSONWriteMode::COMPACT, 1);
+    BeginArray(&writer);
+    WriteFloat32(&writer, value);
+    EndArray(&writer);
+    DestroyJSONWriter(&writer);
+    bool match = StringsMatch(&out, expected);
+    DestroyString(&out);
+    return match;
+}
+
+void CreateInvalidFileWriter(uint32 buffer_size, uint32 max_depth) {
+    CreateJSONFileWriter(&g_std_allocator, TEST_FILE_PATH, buffer_size, JSONWriteMode::COMPACT, max_depth);
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool BuilderTest() {
+    bool pass = true;
+
+    RunTest("BuilderOutputMatches(COMPACT)", &pass, ExpectEqual, true,
+            BuilderOutputMatches(JSONWriteMode::COMPACT, BUILDER_COMPACT));
+    RunTest("BuilderOutputMatches(PRETTY)",  &pass, ExpectEqual, true,
+            BuilderOutputMatches(JSONWriteMode::PRETTY, BUILDER_PRETTY));
+
+    RunTest("Float32OutputMatches(2.5)",   &pass, ExpectEqual, true, Float32OutputMatches(2.5f,   "[2.5]"));
+    RunTest("Float32OutputMatches(-3)",    &pass, ExpectEqual, true, Float32OutputMatches(-3.0f,  "[-3.0]"));
+    RunTest("Float32OutputMatches(1e30)",  &pass, ExpectEqual, true, Float32OutputMatches(1e30f,  "[1e+30]"));
+    RunTest("Float32OutputMatches(1e-7)",  &pass, ExpectEqual, true, Float32OutputMatches(1e-7f,  "[1e-7]"));
+
+    return pass;
+}
+
+bool SinkTest() {
+    bool pass = true;
+
+    // Output flushed through the smallest buffer matches output written to a String, for both modes.
+    JSONWriteMode modes[] = { JSONWriteMode::COMPACT, JSONWriteMode::PRETTY };
+    const char* expected_outputs[] = { BUILDER_COMPACT, BUILDER_PRETTY };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(modes); i += 1) {
+        String out = CreateString(&g_std_allocator);
+        JSONWriter writer = CreateJSONWriter(&g_std_allocator, AppendOutput, &out, JSON_WRITER_MIN_BUFFER_SIZE,
+                                             modes[i], 8);
+        WriteBuilderJSON(&writer);
+        RunTest("buffered output size", &pass, ExpectEqual, true, out.count < StringSize(expected_outputs[i]));
+        DestroyJSONWriter(&writer);
+        RunTest("StringsMatch(out, expected)", &pass, ExpectEqual, true, StringsMatch(&out, expected_outputs[i]));
+        DestroyString(&out);
+    }
+
+    // Strings longer than the buffer are written a piece at a time.
+    char long_string[300] = {};
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(long_string); i += 1) {
+        long_string[i] = i % 50 == 49 ? '\n' : (char)('a' + i % 26);
+    }
+    String expected = CreateString(&g_std_allocator);
+    JSONWriter writer = CreateJSONWriter(&g_std_allocator, &expected, JSONWriteMode::COMPACT, 8);
+    BeginArray(&writer);
+    WriteString(&writer, long_string, sizeof(long_string));
+    EndArray(&writer);
+    DestroyJSONWriter(&writer);
+
+    String out = CreateString(&g_std_allocator);
+    writer = CreateJSONWriter(&g_std_allocator, AppendOutput, &out, JSON_WRITER_MIN_BUFFER_SIZE, JSONWriteMode::COMPACT,
+                              8);
+    BeginArray(&writer);
+    WriteString(&writer, long_string, sizeof(long_string));
+    EndArray(&writer);
+    DestroyJSONWriter(&writer);
+    RunTest("StringsMatch(long string)", &pass, ExpectEqual, true, StringsMatch(&out, &expected));
+    DestroyString(&out);
+    DestroyString(&expected);
+
+    return pass;
+}
+
+bool EscapeTest() {
+    bool pass = true;
+
+    // Escape chars at every position across SSE2 and AVX2 block boundaries, including chars >= 0x80 that signed
+    // compares would mistake for control chars.
+    char chars[80] = {};
+    bool positions_match = true;
+    const char escape_chars[] = { '\"', '\\', '\n', '\0', 0x1F };
+    for (uint32 e = 0; e < CTK_ARRAY_SIZE(escape_chars); e += 1) {
+        for (uint32 i = 0; i < sizeof(chars); i += 1) {
+            memset(chars, 0x80 | 'a', sizeof(chars));
+            chars[i] = escape_chars[e];
+            positions_match &= FindEscapeCharMatchesScalar(chars, sizeof(chars));
+        }
+    }
+    memset(chars, 0xFF, sizeof(chars));
+    positions_match &= FindEscapeCharMatchesScalar(chars, sizeof(chars));
+    RunTest("FindEscapeCharMatchesScalar()", &pass, ExpectEqual, true, positions_match);
+
+    // Random strings of chars with escape chars mixed in.
+    uint64 random_state = RandomSeed64(1);
+    bool random_match = true;
+    for (uint32 string_index = 0; string_index < 1000; string_index += 1) {
+        for (uint32 i = 0; i < sizeof(chars); i += 1) {
+            chars[i] = (char)(32 + Random64(&random_state) % 300);
+        }
+        random_match &= FindEscapeCharMatchesScalar(chars, (uint32)(Random64(&random_state) % sizeof(chars)));
+    }
+    RunTest("FindEscapeCharMatchesScalar(random)", &pass, ExpectEqual, true, random_match);
+    RunTest("ASCIIRoundTripMatches()",             &pass, ExpectEqual, true, ASCIIRoundTripMatches());
+
+    return pass;
+}
+
+bool RoundTripTest() {
+    bool pass = true;
+
+    const char* paths[] = {
+        "tests/data/valid.json",
+        "tests/data/gltf_test.json",
+        "tests/data/object_key_test.json",
+        "tests/data/string_parse_test.json",
+        "tests/data/scientific_e_notation.json",
+        "tests/data/large_object.json",
+        "tests/data/deep_nesting.json",
+    };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(paths); i += 1) {
+        char desc[80] = {};
+        WriteValues(desc, sizeof(desc), "RoundTripMatches(", paths[i], ", COMPACT)");
+        RunTest(desc, &pass, ExpectEqual, true, RoundTripMatches(paths[i], JSONWriteMode::COMPACT));
+        WriteValues(desc, sizeof(desc), "RoundTripMatches(", paths[i], ", PRETTY)");
+        RunTest(desc, &pass, ExpectEqual, true, RoundTripMatches(paths[i], JSONWriteMode::PRETTY));
+    }
+
+    // SaveJSON() gets its writer's max depth from LoadJSON(), so it isn't limited to a fixed depth.
+    JSON json = LoadJSON(&g_std_allocator, "tests/data/deep_nesting.json");
+    RunTest("LoadJSON(deep_nesting.json).max_depth", &pass, ExpectEqual, 300u, json.max_depth);
+    DestroyJSON(&json);
+
+    return pass;
+}
+
+bool InvalidTest() {
+    bool pass = true;
+
+    RunTest("WriteFloat32Root(INFINITY)", &pass, ExpectFatalError, WriteFloat32Root, INFINITY);
+    RunTest("WriteFloat32Root(NAN)",      &pass, ExpectFatalError, WriteFloat32Root, NAN);
+
+    // Root isn't a list, key in array, value without key, key without value, mismatched close, close without open,
+    // second root, deeper than max depth.
+    Func<void, JSONWriter*> invalid_writes[] = {
+        [](JSONWriter* writer) { WriteUInt32(writer, 1); },
+        [](JSONWriter* writer) { BeginArray(writer); WriteKey(writer, "key"); },
+        [](JSONWriter* writer) { BeginObject(writer); WriteNull(writer); },
+        [](JSONWriter* writer) { BeginObject(writer); WriteKey(writer, "a"); EndObject(writer); },
+        [](JSONWriter* writer) { BeginObject(writer); EndArray(writer); },
+        [](JSONWriter* writer) { EndArray(writer); },
+        [](JSONWriter* writer) { BeginArray(writer); EndArray(writer); BeginArray(writer); },
+        [](JSONWriter* writer) { BeginArray(writer); BeginArray(writer); BeginArray(writer); },
+    };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(invalid_writes); i += 1) {
+        String out = CreateString(&g_std_allocator);
+        JSONWriter writer = CreateJSONWriter(&g_std_allocator, &out, JSONWriteMode::COMPACT, 2);
+        char desc[32] = {};
+        WriteValues(desc, sizeof(desc), "invalid_writes[", i, "]");
+        RunTest(desc, &pass, ExpectFatalError, invalid_writes[i], &writer);
+        DestroyJSONWriter(&writer);
+        DestroyString(&out);
+    }
+
+    // Invalid settings are caught before the file is created.
+    RunTest("CreateJSONFileWriter(buffer_size = 0)", &pass, ExpectFatalError, CreateInvalidFileWriter, 0u, 8u);
+    RunTest("CreateJSONFileWriter(max_depth = 0)",   &pass, ExpectFatalError, CreateInvalidFileWriter,
+            JSON_WRITER_MIN_BUFFER_SIZE, 0u);
+    RunTest("PathExists(TEST_FILE_PATH)",            &pass, ExpectEqual, false, PathExists(TEST_FILE_PATH));
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+    RunTest("BuilderTest()",   &pass, BuilderTest);
+    RunTest("SinkTest()",      &pass, SinkTest);
+    RunTest("EscapeTest()",    &pass, EscapeTest);
+    RunTest("RoundTripTest()", &pass, RoundTripTest);
+    RunTest("InvalidTest()",   &pass, InvalidTest);
+    return pass;
+}
+
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+namespace JSONWriterPerfTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr const char* TEST_FILE_PATH   = "tests/data/large.json";
+constexpr uint32      TEST_PASSES      = 10;
+constexpr uint32      SINK_BUFFER_SIZE = 64 * 1024;
+constexpr uint32      MAX_DEPTH        = 64;
+
+/// Utils
+////////////////////////////////////////////////////////////
+void CountBytes(void* data, const char* chars, uint32 size) {
+    *(uint64*)data += size;
+}
+
+void PrintStage(const char* name, float64 ms, uint64 size) {
+    float64 size_gb = size / 1000000000.0;
+    PrintLine("    %-14s %8.2f ms  %10llu bytes  %6.3f GB / sec", name, ms, size, size_gb / (ms / 1000.0));
+}
+
+// Writes json to a String, reusing out's memory so only writing is timed after the first pass.
+float64 WriteToString(JSON* json, String* out, JSONWriteMode mode) {
+    out->count = 0;
+    Profile prof = BeginProfile("WriteToString");
+    JSONWriter writer = CreateJSONWriter(&g_std_allocator, out, mode, MAX_DEPTH);
+    WriteJSON(&writer, json);
+    DestroyJSONWriter(&writer);
+    EndProfile(&prof);
+    return prof.ms;
+}
+
+// Writes json through a fixed size buffer to a sink that only counts bytes.
+float64 WriteToSink(JSON* json, uint64* size, JSONWriteMode mode) {
+    *size = 0;
+    Profile prof = BeginProfile("WriteToSink");
+    JSONWriter writer = CreateJSONWriter(&g_std_allocator, CountBytes, size, SINK_BUFFER_SIZE, mode, MAX_DEPTH);
+    WriteJSON(&writer, json);
+    DestroyJSONWriter(&writer);
+    EndProfile(&prof);
+    return prof.ms;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+void Run() {
+    PrintLine("\nJSON Writer Performance Test");
+
+    JSON json = LoadJSON(&g_std_allocator, TEST_FILE_PATH);
+    String out = CreateString(&g_std_allocator, GetFileSize(TEST_FILE_PATH));
+    uint64 compact_size = 0;
+    uint64 pretty_size  = 0;
+    float64 compact_string_ms = 0;
+    float64 pretty_string_ms  = 0;
+    float64 compact_sink_ms   = 0;
+    float64 pretty_sink_ms    = 0;
+    for (uint32 pass = 0; pass < TEST_PASSES; pass += 1) {
+        compact_string_ms += WriteToString(&json, &out, JSONWriteMode::COMPACT);
+        pretty_string_ms  += WriteToString(&json, &out, JSONWriteMode::PRETTY);
+        compact_sink_ms   += WriteToSink(&json, &compact_size, JSONWriteMode::COMPACT);
+        pretty_sink_ms    += WriteToSink(&json, &pretty_size,  JSONWriteMode::PRETTY);
+    }
+    DestroyString(&out);
+    DestroyJSON(&json);
+
+    // Throughput is measured against the size of the output, not of the file that was loaded.
+    PrintLine("average of %u passes:", TEST_PASSES);
+    PrintStage("String/Compact", compact_string_ms / TEST_PASSES, compact_size);
+    PrintStage("String/Pretty",  pretty_string_ms  / TEST_PASSES, pretty_size);
+    PrintStage("Sink/Compact",   compact_sink_ms   / TEST_PASSES, compact_size);
+    PrintStage("Sink/Pretty",    pretty_sink_ms    / TEST_PASSES, pretty_size);
+}
+
+}
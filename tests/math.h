@@ -19,10 +19,52 @@ bool AlignTest() {
     return pass;
 }
 
+bool PopCountTest() {
+    bool pass = true;
+
+    uint64 vals[] = { 0, 1, 0x80000000, 0xFFFFFFFF, 0x8000000000000000, 0xFFFFFFFFFFFFFFFF, 0x0123456789ABCDEF };
+    uint32 counts[] = { 0, 1, 1, 32, 1, 64, 32 };
+    for (uint32 i = 0; i < CTK_ARRAY_SIZE(vals); i += 1) {
+        FString<64> scalar_description;
+        Write(&scalar_description, "ScalarPopCount(0x%llX)", vals[i]);
+        RunTest(&scalar_description, &pass, ExpectEqual, counts[i], ScalarPopCount(vals[i]));
+
+        FString<64> description;
+        Write(&description, "PopCount(0x%llX)", vals[i]);
+        RunTest(&description, &pass, ExpectEqual, counts[i], PopCount(vals[i]));
+    }
+
+    return pass;
+}
+
+bool RandomTest() {
+    bool pass = true;
+
+    // Seeds give repeatable, non-zero states, and consecutive seeds don't give similar states.
+    RunTest("RandomSeed64(1) == RandomSeed64(1)", &pass, ExpectEqual, RandomSeed64(1), RandomSeed64(1));
+    for (uint64 seed = 1; seed <= 8; seed += 1) {
+        FString<64> description;
+        Write(&description, "PopCount(RandomSeed64(%llu) ^ RandomSeed64(%llu)) >= 16", seed, seed + 1);
+        RunTest(&description, &pass, ExpectEqual, true, PopCount(RandomSeed64(seed) ^ RandomSeed64(seed + 1)) >= 16);
+    }
+
+    // Random64() covers all 64 bits, unlike rand().
+    uint64 random_state = RandomSeed64(1);
+    uint64 bits_set = 0;
+    for (uint32 i = 0; i < 64; i += 1) {
+        bits_set |= Random64(&random_state);
+    }
+    RunTest("Random64() bits set", &pass, ExpectEqual, UINT64_MAX, bits_set);
+
+    return pass;
+}
+
 bool Run() {
     bool pass = true;
 
     RunTest("AlignTest", &pass, AlignTest);
+    RunTest("PopCountTest", &pass, PopCountTest);
+    RunTest("RandomTest", &pass, RandomTest);
 
     return pass;
 }
@@ -0,0 +1,40 @@
+#pragma once
+
+namespace PerfUtils {
+
+/// Data
+////////////////////////////////////////////////////////////
+// Call through volatile pointer so calls aren't inlined and hoisted out of the loop.
+template<typename ReturnType, typename ...Args>
+using VolatileFunc = Func<ReturnType, Args...> volatile;
+
+/// Interface
+////////////////////////////////////////////////////////////
+// Prints prof's time and throughput of byte_count bytes, plus throughput of item_count items if item_name is set.
+void PrintThroughput(Profile* prof, uint64 byte_count, uint64 checksum, const char* item_name = NULL,
+                     uint64 item_count = 0) {
+    float64 seconds = prof->ms / 1000.0;
+    Print("    %-28s %8.2f ms  %7.2f GB/s", prof->name, prof->ms,
+          ((float64)byte_count / (1024.0 * 1024.0 * 1024.0)) / seconds);
+    if (item_name != NULL) {
+        Print("  %8.2f M %s/s", ((float64)item_count / 1000000.0) / seconds, item_name);
+    }
+    PrintLine("  (checksum %llu)", checksum);
+}
+
+// Calls TestFunc pass_count times, summing its results into a checksum so the calls can't be skipped, and prints the
+// throughput of byte_count bytes per call.
+template<typename ReturnType, typename ...Args>
+void ProfileFunc(const char* name, uint64 byte_count, uint32 pass_count, Func<ReturnType, Args...> TestFunc,
+                 Args... args) {
+    VolatileFunc<ReturnType, Args...> test_func = TestFunc;
+    uint64 checksum = 0;
+    Profile prof = BeginProfile(name);
+    for (uint32 pass = 0; pass < pass_count; pass += 1) {
+        checksum += (uint64)test_func(args...);
+    }
+    EndProfile(&prof);
+    PrintThroughput(&prof, byte_count * pass_count, checksum);
+}
+
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+namespace PriorityQueueTest {
+
+/// Utils
+////////////////////////////////////////////////////////////
+bool MinFirst(uint32* a, uint32* b) {
+    return *a < *b;
+}
+
+bool TestPopOrder(PriorityQueue<uint32>* queue, uint32 expected_count) {
+    bool pass = true;
+
+    if (!ExpectEqual("queue->count", expected_count, queue->count)) {
+        return false;
+    }
+
+    bool ordered = true;
+    uint32 prev = 0;
+    while (queue->count > 0) {
+        uint32 elem = Pop(queue);
+        if (elem < prev) {
+            ordered = false;
+        }
+        prev = elem;
+    }
+    if (!ExpectEqual("elements are popped in order", true, ordered)) {
+        pass = false;
+    }
+
+    return pass;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool PushPopTest() {
+    bool pass = true;
+
+    PriorityQueue<uint32> queue = CreatePriorityQueue<uint32>(&g_std_allocator, 4, MinFirst);
+    RunTest("Top(&queue) (empty)", &pass, ExpectFatalError, Top<uint32>, &queue);
+
+    uint32 elems[] = { 50, 20, 80, 10, 70, 30, 60, 40, 90 };
+    CTK_ITER_ARRAY(elem, elems) {
+        Push(&queue, *elem);
+    }
+    RunTest("Push() x9; queue.size", &pass, ExpectEqual, 16u, queue.size);
+    RunTest("Top(&queue)", &pass, ExpectEqual, 10u, Top(&queue));
+    RunTest("Pop(&queue)", &pass, ExpectEqual, 10u, Pop(&queue));
+    RunTest("Pop(&queue)", &pass, ExpectEqual, 20u, Pop(&queue));
+    RunTest("Pop() remaining", &pass, TestPopOrder, &queue, 7u);
+
+    RandomSeed(1);
+    for (uint32 i = 0; i < 1000; i += 1) {
+        Push(&queue, RandomRange(0u, 10000u));
+    }
+    RunTest("Push() x1000 random", &pass, TestPopOrder, &queue, 1000u);
+
+    DestroyPriorityQueue(&queue);
+
+    return pass;
+}
+
+bool DecreaseKeyTest() {
+    bool pass = true;
+
+    PriorityQueue<uint32> queue = CreatePriorityQueue<uint32>(&g_std_allocator, 16, MinFirst);
+    PriorityQueueHnd<uint32> hnds[10] = {};
+    for (uint32 i = 0; i < 10; i += 1) {
+        hnds[i] = Push(&queue, (i + 1) * 10);
+    }
+
+    DecreaseKey(&queue, hnds[9], 5u);
+    RunTest("DecreaseKey(&queue, hnds[9], 5); Top(&queue)", &pass, ExpectEqual, 5u, Top(&queue));
+    RunTest("Get(&queue, hnds[4])", &pass, ExpectEqual, 50u, Get(&queue, hnds[4]));
+
+    DecreaseKey(&queue, hnds[4], 15u);
+    RunTest("Pop(&queue)", &pass, ExpectEqual, 5u,  Pop(&queue));
+    RunTest("Pop(&queue)", &pass, ExpectEqual, 10u, Pop(&queue));
+    RunTest("Pop(&queue)", &pass, ExpectEqual, 15u, Pop(&queue));
+
+    RunTest("DecreaseKey() on popped element", &pass,
+            ExpectFatalError, DecreaseKey<uint32>, &queue, hnds[0], 1u);
+    RunTest("DecreaseKey() with lower priority", &pass,
+            ExpectFatalError, DecreaseKey<uint32>, &queue, hnds[1], 100u);
+
+    DestroyPriorityQueue(&queue);
+
+    return pass;
+}
+
+bool HeapifyTest() {
+    bool pass = true;
+
+    auto array = CreateArray<uint32>(&g_std_allocator, 100);
+    RandomSeed(2);
+    for (uint32 i = 0; i < 100; i += 1) {
+        Push(&array, RandomRange(0u, 1000u));
+    }
+
+    PriorityQueue<uint32> queue = CreatePriorityQueue(&g_std_allocator, &array, MinFirst);
+    RunTest("Get(&queue, {37})", &pass, ExpectEqual, Get(&array, 37), Get(&queue, { 37 }));
+
+    // Heap is full, so next push must grow it.
+    Push(&queue, 0u);
+    RunTest("Push() after heapify; Top(&queue)", &pass, ExpectEqual, 0u, Top(&queue));
+    RunTest("CreatePriorityQueue(&array)", &pass, TestPopOrder, &queue, 101u);
+
+    DestroyPriorityQueue(&queue);
+    DestroyArray(&array);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("PushPopTest()",     &pass, PushPopTest);
+    RunTest("DecreaseKeyTest()", &pass, DecreaseKeyTest);
+    RunTest("HeapifyTest()",     &pass, HeapifyTest);
+
+    return pass;
+}
+
+}
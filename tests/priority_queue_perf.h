@@ -0,0 +1,73 @@
+#pragma once
+
+namespace PriorityQueuePerfTest {
+
+/// Utils
+////////////////////////////////////////////////////////////
+bool MinFirst(uint32* a, uint32* b) {
+    return *a < *b;
+}
+
+bool SortAsc(uint32* a, uint32* b) {
+    return *a <= *b;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+void Run() {
+    PrintLine("\nPriorityQueue Performance Test");
+
+    // Sorted insert is O(n) per element, so it's only run at small counts.
+    constexpr uint32 MAX_SORTED_INSERT_COUNT = 10000;
+    constexpr uint32 TEST_COUNTS[] = { 1000, 10000, 100000, 1000000, 10000000 };
+
+    uint64 random_state = RandomSeed64(1);
+    CTK_ITER_ARRAY(test_count_it, TEST_COUNTS) {
+        uint32 test_count = *test_count_it;
+        auto elems = CreateArray<uint32>(&g_std_allocator, test_count);
+        for (uint32 i = 0; i < test_count; i += 1) {
+            Push(&elems, (uint32)Random64(&random_state));
+        }
+        uint64 checksum = 0;
+
+        Profile push_prof = BeginProfile("Push()/Pop()");
+        PriorityQueue<uint32> queue = CreatePriorityQueue<uint32>(&g_std_allocator, test_count, MinFirst);
+        CTK_ITER(elem, &elems) {
+            Push(&queue, *elem);
+        }
+        while (queue.count > 0) {
+            checksum += Pop(&queue);
+        }
+        EndProfile(&push_prof);
+        DestroyPriorityQueue(&queue);
+
+        Profile heapify_prof = BeginProfile("heapify/Pop()");
+        queue = CreatePriorityQueue(&g_std_allocator, &elems, MinFirst);
+        while (queue.count > 0) {
+            checksum += Pop(&queue);
+        }
+        EndProfile(&heapify_prof);
+        DestroyPriorityQueue(&queue);
+
+        Print("count %8u: Push()/Pop() %9.2f ms, heapify/Pop() %9.2f ms",
+              test_count, push_prof.ms, heapify_prof.ms);
+
+        if (test_count <= MAX_SORTED_INSERT_COUNT) {
+            Profile sorted_prof = BeginProfile("sorted Array insert");
+            auto sorted = CreateArray<uint32>(&g_std_allocator, test_count);
+            CTK_ITER(elem, &elems) {
+                Push(&sorted, *elem);
+                InsertionSort(&sorted, SortAsc);
+            }
+            checksum += sorted.data[0];
+            EndProfile(&sorted_prof);
+            DestroyArray(&sorted);
+            Print(", sorted Array insert %9.2f ms", sorted_prof.ms);
+        }
+
+        PrintLine(" (checksum %llu)", checksum);
+        DestroyArray(&elems);
+    }
+}
+
+}
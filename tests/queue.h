@@ -0,0 +1,198 @@
+#pragma once
+
+namespace QueueTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 THREAD_ELEM_COUNT = 100000;
+constexpr uint32 BATCH_SIZE        = 64;
+
+struct SPSCThreadState {
+    SPSCQueue<uint32>* queue;
+    uint64             sum;
+};
+
+struct MPMCThreadState {
+    MPMCQueue<uint32>* queue;
+    uint32             start;
+    uint64             sum;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+void SPSCProducer(void* data) {
+    auto state = (SPSCThreadState*)data;
+    uint32 batch[BATCH_SIZE] = {};
+    for (uint32 i = 0; i < THREAD_ELEM_COUNT; i += BATCH_SIZE) {
+        uint32 batch_size = Min(BATCH_SIZE, THREAD_ELEM_COUNT - i);
+        for (uint32 j = 0; j < batch_size; j += 1) {
+            batch[j] = i + j;
+        }
+        PushRange(state->queue, batch, batch_size);
+    }
+}
+
+void SPSCConsumer(void* data) {
+    auto state = (SPSCThreadState*)data;
+    uint32 batch[BATCH_SIZE] = {};
+    uint32 popped = 0;
+    while (popped < THREAD_ELEM_COUNT) {
+        uint32 pop_count = PopRange(state->queue, batch, BATCH_SIZE);
+        for (uint32 i = 0; i < pop_count; i += 1) {
+            state->sum += batch[i];
+        }
+        popped += pop_count;
+    }
+}
+
+void MPMCProducer(void* data) {
+    auto state = (MPMCThreadState*)data;
+    for (uint32 i = 0; i < THREAD_ELEM_COUNT; i += 1) {
+        Push(state->queue, state->start + i);
+    }
+}
+
+void MPMCConsumer(void* data) {
+    auto state = (MPMCThreadState*)data;
+    for (uint32 i = 0; i < THREAD_ELEM_COUNT; i += 1) {
+        state->sum += Pop(state->queue);
+    }
+}
+
+uint64 ExpectedSum(uint32 start, uint32 count) {
+    return ((uint64)start * count) + (((uint64)count * (count - 1)) / 2);
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool SPSCTest() {
+    bool pass = true;
+
+    RunTest("CreateSPSCQueue<uint32>(&g_std_allocator, 3)", &pass,
+            ExpectFatalError, CreateSPSCQueue<uint32>, &g_std_allocator, 3u);
+
+    SPSCQueue<uint32> queue = CreateSPSCQueue<uint32>(&g_std_allocator, 4);
+    for (uint32 i = 0; i < 4; i += 1) {
+        RunTest("TryPush(&queue, i)", &pass, ExpectEqual, true, TryPush(&queue, i));
+    }
+    RunTest("TryPush(&queue, 4) (full)", &pass, ExpectEqual, false, TryPush(&queue, 4u));
+    RunTest("GetCount(&queue)", &pass, ExpectEqual, 4u, GetCount(&queue));
+
+    uint32 elem = 0;
+    for (uint32 i = 0; i < 4; i += 1) {
+        RunTest("TryPop(&queue, &elem)", &pass, ExpectEqual, true, TryPop(&queue, &elem));
+        RunTest("elem", &pass, ExpectEqual, i, elem);
+    }
+    RunTest("TryPop(&queue, &elem) (empty)", &pass, ExpectEqual, false, TryPop(&queue, &elem));
+
+    DestroySPSCQueue(&queue);
+
+    return pass;
+}
+
+bool SPSCRangeTest() {
+    bool pass = true;
+
+    SPSCQueue<uint32> queue = CreateSPSCQueue<uint32>(&g_std_allocator, 8);
+    uint32 elems[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    uint32 popped[10] = {};
+
+    // Offset head/tail so next range wraps around end of buffer.
+    RunTest("TryPushRange(&queue, elems, 6)", &pass, ExpectEqual, 6u, TryPushRange(&queue, elems, 6));
+    RunTest("TryPopRange(&queue, popped, 6)", &pass, ExpectEqual, 6u, TryPopRange(&queue, popped, 6));
+
+    RunTest("TryPushRange(&queue, elems, 10) (wraps, 8 fit)", &pass,
+            ExpectEqual, 8u, TryPushRange(&queue, elems, 10));
+    RunTest("TryPopRange(&queue, popped, 10) (wraps)", &pass,
+            ExpectEqual, 8u, TryPopRange(&queue, popped, 10));
+    for (uint32 i = 0; i < 8; i += 1) {
+        RunTest("popped[i]", &pass, ExpectEqual, i, popped[i]);
+    }
+
+    DestroySPSCQueue(&queue);
+
+    return pass;
+}
+
+bool MPMCTest() {
+    bool pass = true;
+
+    MPMCQueue<uint32> queue = CreateMPMCQueue<uint32>(&g_std_allocator, 4);
+
+    // Run several laps to exercise sequence wrapping.
+    for (uint32 lap = 0; lap < 3; lap += 1) {
+        for (uint32 i = 0; i < 4; i += 1) {
+            RunTest("TryPush(&queue, i)", &pass, ExpectEqual, true, TryPush(&queue, lap * 4 + i));
+        }
+        RunTest("TryPush(&queue, 4) (full)", &pass, ExpectEqual, false, TryPush(&queue, 4u));
+
+        uint32 elem = 0;
+        for (uint32 i = 0; i < 4; i += 1) {
+            RunTest("TryPop(&queue, &elem)", &pass, ExpectEqual, true, TryPop(&queue, &elem));
+            RunTest("elem", &pass, ExpectEqual, lap * 4 + i, elem);
+        }
+        RunTest("TryPop(&queue, &elem) (empty)", &pass, ExpectEqual, false, TryPop(&queue, &elem));
+    }
+
+    DestroyMPMCQueue(&queue);
+
+    return pass;
+}
+
+bool ThreadedTest() {
+    bool pass = true;
+
+    constexpr uint32 THREAD_COUNT = 4;
+    ThreadPool thread_pool = {};
+    InitThreadPool(&thread_pool, &g_std_allocator, THREAD_COUNT);
+
+    // SPSC: 1 producer, 1 consumer.
+    SPSCQueue<uint32> spsc_queue = CreateSPSCQueue<uint32>(&g_std_allocator, 256);
+    SPSCThreadState spsc_state = { .queue = &spsc_queue, .sum = 0 };
+    TaskHnd producer = SubmitTask(&thread_pool, &spsc_state, SPSCProducer);
+    TaskHnd consumer = SubmitTask(&thread_pool, &spsc_state, SPSCConsumer);
+    Wait(&thread_pool, producer);
+    Wait(&thread_pool, consumer);
+    RunTest("SPSC consumed sum", &pass, ExpectEqual, ExpectedSum(0, THREAD_ELEM_COUNT), spsc_state.sum);
+    DestroySPSCQueue(&spsc_queue);
+
+    // MPMC: 2 producers, 2 consumers.
+    MPMCQueue<uint32> mpmc_queue = CreateMPMCQueue<uint32>(&g_std_allocator, 256);
+    MPMCThreadState producer_states[2] = {
+        { .queue = &mpmc_queue, .start = 0,                 .sum = 0 },
+        { .queue = &mpmc_queue, .start = THREAD_ELEM_COUNT, .sum = 0 },
+    };
+    MPMCThreadState consumer_states[2] = {
+        { .queue = &mpmc_queue, .start = 0, .sum = 0 },
+        { .queue = &mpmc_queue, .start = 0, .sum = 0 },
+    };
+    TaskHnd tasks[THREAD_COUNT] = {
+        SubmitTask(&thread_pool, &producer_states[0], MPMCProducer),
+        SubmitTask(&thread_pool, &producer_states[1], MPMCProducer),
+        SubmitTask(&thread_pool, &consumer_states[0], MPMCConsumer),
+        SubmitTask(&thread_pool, &consumer_states[1], MPMCConsumer),
+    };
+    CTK_ITER_ARRAY(task, tasks) {
+        Wait(&thread_pool, *task);
+    }
+    RunTest("MPMC consumed sum", &pass,
+            ExpectEqual, ExpectedSum(0, THREAD_ELEM_COUNT * 2), consumer_states[0].sum + consumer_states[1].sum);
+    DestroyMPMCQueue(&mpmc_queue);
+
+    DestroyThreadPool(&thread_pool);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("SPSCTest()",      &pass, SPSCTest);
+    RunTest("SPSCRangeTest()", &pass, SPSCRangeTest);
+    RunTest("MPMCTest()",      &pass, MPMCTest);
+    RunTest("ThreadedTest()",  &pass, ThreadedTest);
+
+    return pass;
+}
+
+}
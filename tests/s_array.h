@@ -0,0 +1,105 @@
+#pragma once
+
+namespace SArrayTest {
+
+/// Utils
+////////////////////////////////////////////////////////////
+template<typename Type, uint32 inline_size>
+bool TestSArrayFields(SArray<Type, inline_size>* array, uint32 expected_size, uint32 expected_count,
+                      bool expected_inline) {
+    bool pass = true;
+
+    if (!ExpectEqual("array->size", expected_size, array->size)) {
+        pass = false;
+    }
+
+    if (!ExpectEqual("array->count", expected_count, array->count)) {
+        pass = false;
+    }
+
+    if (!ExpectEqual("IsInline(array)", expected_inline, IsInline(array))) {
+        pass = false;
+    }
+
+    return pass;
+}
+
+template<uint32 inline_size>
+bool TestSArrayElements(SArray<uint32, inline_size>* array, uint32 start) {
+    bool pass = true;
+
+    CTK_ITER(elem, array) {
+        if (*elem != start + CTK_ITER_IDX(elem, array)) {
+            pass = false;
+        }
+    }
+    if (!ExpectEqual("elements are sequential", true, pass)) {
+        pass = false;
+    }
+
+    return pass;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool InlineTest() {
+    bool pass = true;
+
+    auto array = CreateSArray<uint32, 4>(NULL);
+    RunTest("CreateSArray<uint32, 4>(NULL)", &pass, TestSArrayFields, &array, 4u, 0u, true);
+
+    for (uint32 i = 0; i < 4; i += 1) {
+        Push(&array, i);
+    }
+    RunTest("Push() x4", &pass, TestSArrayFields, &array, 4u, 4u, true);
+    RunTest("Push() x4", &pass, TestSArrayElements, &array, 0u);
+
+    // No allocator, so array can't spill.
+    RunTest<Func<uint32*, SArray<uint32, 4>*, uint32>>(
+        "Push() x5 with no allocator", &pass, ExpectFatalError, Push, &array, 4u);
+
+    Remove(&array, 0);
+    RunTest("Remove(&array, 0)", &pass, TestSArrayElements, &array, 1u);
+
+    return pass;
+}
+
+bool SpillTest() {
+    bool pass = true;
+
+    auto array = CreateSArray<uint32, 4>(&g_std_allocator);
+    uint32 elems[] = { 0, 1, 2 };
+    PushRange(&array, elems, CTK_ARRAY_SIZE(elems));
+    RunTest("PushRange() x3", &pass, TestSArrayFields, &array, 4u, 3u, true);
+
+    Push(&array, 3u);
+    Push(&array, 4u);
+    RunTest("Push() x2 (spill)", &pass, TestSArrayFields, &array, 8u, 5u, false);
+    RunTest("Push() x2 (spill)", &pass, TestSArrayElements, &array, 0u);
+
+    for (uint32 i = 5; i < 20; i += 1) {
+        Push(&array, i);
+    }
+    RunTest("Push() x15 (grow)", &pass, TestSArrayFields, &array, 32u, 20u, false);
+    RunTest("Push() x15 (grow)", &pass, TestSArrayElements, &array, 0u);
+
+    RemoveRange(&array, 0, 10);
+    RunTest("RemoveRange(&array, 0, 10)", &pass, TestSArrayElements, &array, 10u);
+    RunTest("GetLast(&array)", &pass, ExpectEqual, 19u, GetLast(&array));
+
+    DestroySArray(&array);
+    RunTest("DestroySArray(&array)", &pass, TestSArrayFields, &array, 4u, 0u, true);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("InlineTest()", &pass, InlineTest);
+    RunTest("SpillTest()",  &pass, SpillTest);
+
+    return pass;
+}
+
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+namespace SegmentedArrayTest {
+
+/// Utils
+////////////////////////////////////////////////////////////
+bool TestSegmentedArrayElements(SegmentedArray<uint32>* array, uint32 expected_count) {
+    bool pass = true;
+
+    if (!ExpectEqual("array->count", expected_count, array->count)) {
+        pass = false;
+    }
+
+    uint32 index = 0;
+    bool sequential = true;
+    CTK_ITER_SEGMENTED(elem, array) {
+        if (*elem != index || Get(array, index) != index) {
+            sequential = false;
+        }
+        index += 1;
+    }
+    if (!ExpectEqual("elements are sequential", true, sequential)) {
+        pass = false;
+    }
+
+    if (!ExpectEqual("iterated element count", expected_count, index)) {
+        pass = false;
+    }
+
+    return pass;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool PushTest() {
+    bool pass = true;
+
+    RunTest("CreateSegmentedArray<uint32>(&g_std_allocator, 3)", &pass,
+            ExpectFatalError, CreateSegmentedArray<uint32>, &g_std_allocator, 3u);
+
+    auto array = CreateSegmentedArray<uint32>(&g_std_allocator, 4);
+    uint32* first = Push(&array, 0u);
+    for (uint32 i = 1; i < 10; i += 1) {
+        Push(&array, i);
+    }
+    RunTest("Push() x10", &pass, TestSegmentedArrayElements, &array, 10u);
+    RunTest("GetChunkCount(&array)", &pass, ExpectEqual, 3u, GetChunkCount(&array));
+    RunTest("GetChunkElemCount(&array, 2)", &pass, ExpectEqual, 2u, GetChunkElemCount(&array, 2));
+
+    // Chunks are never moved, so element addresses survive growth.
+    for (uint32 i = 10; i < 100; i += 1) {
+        Push(&array, i);
+    }
+    RunTest("Push() x90 (grow chunk table)", &pass, TestSegmentedArrayElements, &array, 100u);
+    RunTest("first element address is stable", &pass, ExpectEqual, true, first == GetPtr(&array, 0));
+
+    RunTest("Pop(&array)", &pass, ExpectEqual, 99u, Pop(&array));
+    RunTest("Pop(&array)", &pass, TestSegmentedArrayElements, &array, 99u);
+
+    DestroySegmentedArray(&array);
+
+    return pass;
+}
+
+bool PushRangeTest() {
+    bool pass = true;
+
+    auto array = CreateSegmentedArray<uint32>(&g_std_allocator, 8);
+    uint32 elems[20] = {};
+    for (uint32 i = 0; i < 20; i += 1) {
+        elems[i] = i;
+    }
+
+    // Unaligned start so range spans partial first chunk, full chunk, and partial last chunk.
+    PushRange(&array, elems, 3);
+    PushRange(&array, elems + 3, 17);
+    RunTest("PushRange() x2", &pass, TestSegmentedArrayElements, &array, 20u);
+    RunTest("GetChunkCount(&array)", &pass, ExpectEqual, 3u, GetChunkCount(&array));
+
+    // Chunks are kept for reuse after clearing.
+    Clear(&array);
+    RunTest("Clear(&array)", &pass, TestSegmentedArrayElements, &array, 0u);
+    RunTest("Clear(&array); array.chunk_count", &pass, ExpectEqual, 3u, array.chunk_count);
+
+    PushRange(&array, elems, 20);
+    RunTest("PushRange() after Clear()", &pass, TestSegmentedArrayElements, &array, 20u);
+    RunTest("PushRange() after Clear(); array.chunk_count", &pass, ExpectEqual, 3u, array.chunk_count);
+
+    DestroySegmentedArray(&array);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("PushTest()",      &pass, PushTest);
+    RunTest("PushRangeTest()", &pass, PushRangeTest);
+
+    return pass;
+}
+
+}
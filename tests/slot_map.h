@@ -0,0 +1,111 @@
+#pragma once
+
+namespace SlotMapTest {
+
+/// Utils
+////////////////////////////////////////////////////////////
+bool TestDenseElements(SlotMap<uint32>* map, uint32* expected_elems, uint32 expected_count) {
+    bool pass = true;
+
+    if (!ExpectEqual("map->count", expected_count, map->count)) {
+        return false;
+    }
+
+    CTK_ITER(elem, map) {
+        uint32 index = CTK_ITER_IDX(elem, map);
+        if (!ExpectEqual("dense element", expected_elems[index], *elem)) {
+            pass = false;
+        }
+    }
+
+    return pass;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool InsertRemoveTest() {
+    bool pass = true;
+
+    SlotMap<uint32> map = CreateSlotMap<uint32>(&g_std_allocator, 4);
+    SlotHnd<uint32> hnds[4] = {};
+    for (uint32 i = 0; i < 4; i += 1) {
+        hnds[i] = Insert(&map, i * 10);
+    }
+    uint32 expected_inserted[] = { 0, 10, 20, 30 };
+    RunTest("Insert() x4", &pass, TestDenseElements, &map, expected_inserted, 4u);
+    RunTest("*GetData(&map, hnds[2])", &pass, ExpectEqual, 20u, *GetData(&map, hnds[2]));
+
+    // Last element is swapped into removed element's position.
+    Remove(&map, hnds[1]);
+    uint32 expected_removed[] = { 0, 30, 20 };
+    RunTest("Remove(&map, hnds[1])", &pass, TestDenseElements, &map, expected_removed, 3u);
+    RunTest("IsValid(&map, hnds[1])", &pass, ExpectEqual, false, IsValid(&map, hnds[1]));
+    RunTest("*GetData(&map, hnds[3])", &pass, ExpectEqual, 30u, *GetData(&map, hnds[3]));
+    RunTest<Func<uint32*, SlotMap<uint32>*, SlotHnd<uint32>>>(
+        "GetData(&map, hnds[1])", &pass, ExpectFatalError, GetData, &map, hnds[1]);
+    RunTest<Func<void, SlotMap<uint32>*, SlotHnd<uint32>>>(
+        "Remove(&map, hnds[1])", &pass, ExpectFatalError, Remove, &map, hnds[1]);
+
+    // Removed slot is reused with a new generation, so the stale handle stays invalid.
+    SlotHnd<uint32> reused = Insert(&map, 40u);
+    RunTest("reused.index", &pass, ExpectEqual, hnds[1].index, reused.index);
+    RunTest("IsValid(&map, hnds[1])", &pass, ExpectEqual, false, IsValid(&map, hnds[1]));
+    RunTest("*GetData(&map, reused)", &pass, ExpectEqual, 40u, *GetData(&map, reused));
+
+    SlotHnd<uint32> null_hnd = {};
+    RunTest("IsValid(&map, {})", &pass, ExpectEqual, false, IsValid(&map, null_hnd));
+
+    DestroySlotMap(&map);
+
+    return pass;
+}
+
+bool GrowTest() {
+    bool pass = true;
+
+    SlotMap<uint32> map = CreateSlotMap<uint32>(&g_std_allocator, 2);
+    SlotHnd<uint32> hnds[10] = {};
+    for (uint32 i = 0; i < 10; i += 1) {
+        hnds[i] = Insert(&map, i);
+    }
+    RunTest("Insert() x10; map.size", &pass, ExpectEqual, 16u, map.size);
+
+    bool all_valid = true;
+    for (uint32 i = 0; i < 10; i += 1) {
+        if (!IsValid(&map, hnds[i]) || *GetData(&map, hnds[i]) != i) {
+            all_valid = false;
+        }
+    }
+    RunTest("handles valid after growth", &pass, ExpectEqual, true, all_valid);
+
+    // Remove even elements during iteration by dense index.
+    for (uint32 i = 0; i < map.count;) {
+        if (map.data[i] % 2 == 0) {
+            Remove(&map, GetHnd(&map, i));
+        }
+        else {
+            i += 1;
+        }
+    }
+    RunTest("remove even elements; map.count", &pass, ExpectEqual, 5u, map.count);
+    RunTest("IsValid(&map, hnds[3])", &pass, ExpectEqual, true,  IsValid(&map, hnds[3]));
+    RunTest("IsValid(&map, hnds[4])", &pass, ExpectEqual, false, IsValid(&map, hnds[4]));
+
+    Clear(&map);
+    RunTest("Clear(&map); IsValid(&map, hnds[3])", &pass, ExpectEqual, false, IsValid(&map, hnds[3]));
+
+    DestroySlotMap(&map);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("InsertRemoveTest()", &pass, InsertRemoveTest);
+    RunTest("GrowTest()",         &pass, GrowTest);
+
+    return pass;
+}
+
+}
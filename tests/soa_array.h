@@ -0,0 +1,68 @@
+#pragma once
+
+namespace SoAArrayTest {
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool PushTest() {
+    bool pass = true;
+
+    auto array = CreateSoAArray<uint32, float32, uint8>(&g_std_allocator, 2);
+    Push(&array, 1, 1.5f, 'a');
+    Push(&array, 2, 2.5f, 'b');
+    RunTest("Push() x2; array.count", &pass, ExpectEqual, 2u, array.count);
+    RunTest<Func<uint32, SoAArray<uint32, float32, uint8>*, uint32, float32, uint8>>(
+        "Push() with no space available", &pass, ExpectFatalError, Push, &array, 3u, 3.5f, (uint8)'c');
+
+    PushResize(&array, 2, 3, 3.5f, 'c');
+    RunTest("PushResize(); array.size", &pass, ExpectEqual, 4u, array.size);
+    RunTest("Get<0>(&array, 2)", &pass, ExpectEqual, 3u,   Get<0>(&array, 2));
+    RunTest("Get<1>(&array, 2)", &pass, ExpectEqual, 3.5f, Get<1>(&array, 2));
+    RunTest("Get<2>(&array, 2)", &pass, ExpectEqual, (uint8)'c', Get<2>(&array, 2));
+
+    bool columns_aligned = true;
+    CTK_ITER_ARRAY(column, array.columns) {
+        if ((uint64)*column % SOA_COLUMN_ALIGNMENT != 0) {
+            columns_aligned = false;
+        }
+    }
+    RunTest("columns are aligned", &pass, ExpectEqual, true, columns_aligned);
+
+    DestroySoAArray(&array);
+
+    return pass;
+}
+
+bool RemoveTest() {
+    bool pass = true;
+
+    auto array = CreateSoAArray<uint32, float32>(&g_std_allocator, 4);
+    for (uint32 i = 0; i < 4; i += 1) {
+        Push(&array, i, (float32)i);
+    }
+
+    // Last element is swapped into removed slot.
+    Remove(&array, 1);
+    RunTest("Remove(&array, 1); array.count", &pass, ExpectEqual, 3u, array.count);
+    RunTest("Get<0>(&array, 1)", &pass, ExpectEqual, 3u,   Get<0>(&array, 1));
+    RunTest("Get<1>(&array, 1)", &pass, ExpectEqual, 3.0f, Get<1>(&array, 1));
+
+    Remove(&array, 2);
+    RunTest("Remove(&array, 2) (last); array.count", &pass, ExpectEqual, 2u, array.count);
+    RunTest("Get<0>(&array, 0)", &pass, ExpectEqual, 0u, Get<0>(&array, 0));
+
+    DestroySoAArray(&array);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("PushTest()",   &pass, PushTest);
+    RunTest("RemoveTest()", &pass, RemoveTest);
+
+    return pass;
+}
+
+}
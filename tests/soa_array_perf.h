@@ -0,0 +1,76 @@
+#pragma once
+
+namespace SoAArrayPerfTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+struct Particle {
+    float32 position_x;
+    float32 position_y;
+    float32 position_z;
+    float32 velocity_x;
+    float32 velocity_y;
+    float32 velocity_z;
+    float32 mass;
+    float32 lifetime;
+    uint32  color;
+    uint32  flags;
+    uint32  id;
+    uint32  parent_id;
+};
+
+/// Tests
+////////////////////////////////////////////////////////////
+void Run() {
+    PrintLine("\nSoAArray Performance Test");
+
+    constexpr uint32  TEST_COUNT  = 10000000;
+    constexpr uint32  TEST_PASSES = 10;
+    constexpr float32 DELTA       = 0.016f;
+
+    auto aos = CreateArrayFull<Particle>(&g_std_allocator, TEST_COUNT);
+    auto soa = CreateSoAArray<float32, float32, float32, float32, float32, float32, float32, float32,
+                              uint32, uint32, uint32, uint32>(&g_std_allocator, TEST_COUNT);
+    for (uint32 i = 0; i < TEST_COUNT; i += 1) {
+        Particle* particle = GetPtr(&aos, i);
+        particle->position_x = (float32)i;
+        particle->velocity_x = 1.0f;
+        particle->id         = i;
+        Push(&soa, (float32)i, 0, 0, 1.0f, 0, 0, 0, 0, 0, 0, i, 0);
+    }
+
+    // Update only the x position from x velocity, so SoA only pulls 2 of 12 fields through cache.
+    float64 aos_total_ms = 0;
+    float64 soa_total_ms = 0;
+    for (uint32 pass = 0; pass < TEST_PASSES; pass += 1) {
+        Profile aos_prof = BeginProfile("AoS Array");
+        CTK_ITER(particle, &aos) {
+            particle->position_x += particle->velocity_x * DELTA;
+        }
+        EndProfile(&aos_prof);
+        aos_total_ms += aos_prof.ms;
+
+        Profile soa_prof = BeginProfile("SoAArray");
+        float32* position_x = GetColumn<0>(&soa);
+        float32* velocity_x = GetColumn<3>(&soa);
+        for (uint32 i = 0; i < soa.count; i += 1) {
+            position_x[i] += velocity_x[i] * DELTA;
+        }
+        EndProfile(&soa_prof);
+        soa_total_ms += soa_prof.ms;
+
+        PrintLine("pass %2u: AoS %.f ms, SoA %.f ms", pass, aos_prof.ms, soa_prof.ms);
+    }
+    PrintLine("average: AoS %.2f ms, SoA %.2f ms (%.2fx)",
+              aos_total_ms / TEST_PASSES,
+              soa_total_ms / TEST_PASSES,
+              aos_total_ms / soa_total_ms);
+
+    // Keep updated values live.
+    PrintLine("checksum: %f %f", Get(&aos, TEST_COUNT - 1).position_x, Get<0>(&soa, TEST_COUNT - 1));
+
+    DestroyArray(&aos);
+    DestroySoAArray(&soa);
+}
+
+}
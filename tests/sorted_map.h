@@ -0,0 +1,109 @@
+#pragma once
+
+namespace SortedMapTest {
+
+/// Utils
+////////////////////////////////////////////////////////////
+bool TestKeysSorted(SortedMap<uint32, uint32>* map, uint32 expected_count) {
+    bool pass = true;
+
+    if (!ExpectEqual("map->count", expected_count, map->count)) {
+        pass = false;
+    }
+
+    bool sorted = true;
+    for (uint32 i = 1; i < map->count; i += 1) {
+        if (!(map->keys[i - 1] < map->keys[i])) {
+            sorted = false;
+        }
+    }
+    if (!ExpectEqual("keys are sorted", true, sorted)) {
+        pass = false;
+    }
+
+    return pass;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool LowerBoundTest() {
+    bool pass = true;
+
+    uint32 keys[] = { 10, 20, 20, 30, 40 };
+    RunTest("LowerBound(keys, 5, 5)",  &pass, ExpectEqual, 0u, LowerBound(keys, 5, 5u));
+    RunTest("LowerBound(keys, 5, 20)", &pass, ExpectEqual, 1u, LowerBound(keys, 5, 20u));
+    RunTest("LowerBound(keys, 5, 25)", &pass, ExpectEqual, 3u, LowerBound(keys, 5, 25u));
+    RunTest("LowerBound(keys, 5, 50)", &pass, ExpectEqual, 5u, LowerBound(keys, 5, 50u));
+    RunTest("UpperBound(keys, 5, 20)", &pass, ExpectEqual, 3u, UpperBound(keys, 5, 20u));
+    RunTest("UpperBound(keys, 5, 40)", &pass, ExpectEqual, 5u, UpperBound(keys, 5, 40u));
+    RunTest("LowerBound(keys, 0, 20)", &pass, ExpectEqual, 0u, LowerBound(keys, 0, 20u));
+
+    return pass;
+}
+
+bool InsertRemoveTest() {
+    bool pass = true;
+
+    auto map = CreateSortedMap<uint32, uint32>(&g_std_allocator);
+    uint32 keys[] = { 50, 10, 40, 20, 30, 90, 70, 60, 80 };
+    CTK_ITER_ARRAY(key, keys) {
+        Insert(&map, *key, *key * 2);
+    }
+    RunTest("Insert() x9", &pass, TestKeysSorted, &map, 9u);
+    RunTest("*FindValue(&map, 70)", &pass, ExpectEqual, 140u, *FindValue(&map, 70u));
+    RunTest("FindValue(&map, 75)", &pass, ExpectEqual, true, FindValue(&map, 75u) == NULL);
+    RunTest<Func<uint32*, SortedMap<uint32, uint32>*, uint32, uint32>>(
+        "Insert() with existing key", &pass, ExpectFatalError, Insert, &map, 50u, 0u);
+
+    SortedMapRange range = GetRange(&map, 25u, 70u);
+    RunTest("GetRange(&map, 25, 70).start", &pass, ExpectEqual, 2u, range.start);
+    RunTest("GetRange(&map, 25, 70).end",   &pass, ExpectEqual, 6u, range.end);
+    RunTest("map.keys[range.start]", &pass, ExpectEqual, 30u, map.keys[range.start]);
+
+    Remove(&map, 10u);
+    Remove(&map, 90u);
+    RunTest("Remove() x2", &pass, TestKeysSorted, &map, 7u);
+    RunTest("map.keys[0]", &pass, ExpectEqual, 20u, map.keys[0]);
+    RunTest<Func<void, SortedMap<uint32, uint32>*, uint32>>(
+        "Remove() with missing key", &pass, ExpectFatalError, Remove, &map, 10u);
+
+    DestroySortedMap(&map);
+
+    return pass;
+}
+
+bool BulkBuildTest() {
+    bool pass = true;
+
+    Pair<uint32, uint32> pairs[1000] = {};
+    for (uint32 i = 0; i < 1000; i += 1) {
+        // 7919 is coprime with 1000, so keys are a permutation of 0..999.
+        pairs[i].key   = (i * 7919) % 1000;
+        pairs[i].value = i;
+    }
+
+    auto map = CreateSortedMap(&g_std_allocator, pairs, 1000);
+    RunTest("CreateSortedMap(pairs)", &pass, TestKeysSorted, &map, 1000u);
+    RunTest("*FindValue(&map, pairs[123].key)", &pass, ExpectEqual, 123u, *FindValue(&map, pairs[123].key));
+    DestroySortedMap(&map);
+
+    pairs[1].key = pairs[0].key;
+    const Pair<uint32, uint32>* duplicate_pairs = pairs;
+    RunTest<Func<SortedMap<uint32, uint32>, Allocator*, const Pair<uint32, uint32>*, uint32>>(
+        "CreateSortedMap(pairs) with duplicate keys", &pass,
+        ExpectFatalError, CreateSortedMap, &g_std_allocator, duplicate_pairs, 1000u);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("LowerBoundTest()",   &pass, LowerBoundTest);
+    RunTest("InsertRemoveTest()", &pass, InsertRemoveTest);
+    RunTest("BulkBuildTest()",    &pass, BulkBuildTest);
+
+    return pass;
+}
+
+}
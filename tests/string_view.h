@@ -0,0 +1,126 @@
+#pragma once
+
+namespace StringViewTest {
+
+/// Utils
+////////////////////////////////////////////////////////////
+bool ExpectView(const char* expected, StringView actual) {
+    return ExpectEqual(expected, StringSize(expected), actual.data, actual.size);
+}
+
+// Joins tokens with '|' so each iteration's output can be checked with a single string.
+bool ExpectSplit(const char* expected, StringView string, char delimiter) {
+    FString<256> joined = {};
+    uint32 token_count = 0;
+    CTK_ITER_SPLIT(split, string, delimiter) {
+        AppendValues(&joined, token_count > 0 ? "|" : "", split.token);
+        token_count += 1;
+    }
+    return ExpectEqual(expected, StringSize(expected), joined.data, joined.count);
+}
+
+bool ExpectTokens(const char* expected, StringView string, const char* delimiters) {
+    FString<256> joined = {};
+    uint32 token_count = 0;
+    CTK_ITER_TOKENS(tokenizer, string, delimiters) {
+        AppendValues(&joined, token_count > 0 ? "|" : "", tokenizer.token);
+        token_count += 1;
+    }
+    return ExpectEqual(expected, StringSize(expected), joined.data, joined.count);
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool ViewTest() {
+    bool pass = true;
+
+    StringView view = CTK_VIEW_STRING("  key = 1234  ");
+    RunTest("CTK_VIEW_STRING(); view.size", &pass, ExpectEqual, 14u, view.size);
+    RunTest("Trim(view)",                  &pass, ExpectView, "key = 1234",   Trim(view));
+    RunTest("TrimLeft(view)",              &pass, ExpectView, "key = 1234  ", TrimLeft(view));
+    RunTest("TrimRight(view)",             &pass, ExpectView, "  key = 1234", TrimRight(view));
+    RunTest("Trim(\" \\t\\r\\n\")",        &pass, ExpectView, "",             Trim(ViewString(" \t\r\n")));
+    RunTest("GetSubstring(view, 2, 3)",    &pass, ExpectView, "key",          GetSubstring(view, 2, 3));
+    RunTest("GetSubstring(view, 14)",      &pass, ExpectView, "",             GetSubstring(view, 14));
+    RunTest<Func<StringView, StringView, uint32, uint32>>(
+        "GetSubstring(view, 10, 5)", &pass, ExpectFatalError, GetSubstring, view, 10u, 5u);
+    RunTest<Func<StringView, StringView, uint32>>(
+        "GetSubstring(view, 15)", &pass, ExpectFatalError, GetSubstring, view, 15u);
+
+    StringView trimmed = Trim(view);
+    uint32 equals_index = FindChar(trimmed, '=');
+    RunTest("FindChar(trimmed, '=')",         &pass, ExpectEqual, 4u, equals_index);
+    RunTest("FindChar(trimmed, '#')",         &pass, ExpectEqual, STRING_NOT_FOUND, FindChar(trimmed, '#'));
+    RunTest("FindSubstring(trimmed, \"12\")", &pass, ExpectEqual, 6u, FindSubstring(trimmed, "12"));
+    RunTest("ToUInt32(value)",                &pass, ExpectEqual, 1234u,
+            ToUInt32(Trim(GetSubstring(trimmed, equals_index + 1))));
+    RunTest("TryToInt<sint32>(key) invalid",  &pass, ExpectEqual, true,
+            TryToInt<sint32>(GetSubstring(trimmed, 0, 3)).status == IntParseStatus::INVALID);
+    RunTest("ToFloat64(\"2.5e3\")",           &pass, ExpectEqual, 2500.0, ToFloat64(CTK_VIEW_STRING("2.5e3")));
+    RunTest("ToBool(\"true\")",               &pass, ExpectEqual, true, ToBool(CTK_VIEW_STRING("true")));
+
+    StringView key = GetSubstring(trimmed, 0, 3);
+    RunTest("StringsMatch(key, \"key\")",    &pass, ExpectEqual, true,  StringsMatch(key, "key"));
+    RunTest("StringsMatch(key, \"keys\")",   &pass, ExpectEqual, false, StringsMatch(key, "keys"));
+    RunTest("IsSubstring(trimmed, \"= 1\")", &pass, ExpectEqual, true,  IsSubstring(trimmed, "= 1"));
+    RunTest("StartsWith(trimmed, \"key\")",  &pass, ExpectEqual, true,  StartsWith(trimmed, "key"));
+    RunTest("StartsWith(trimmed, \"1234\")", &pass, ExpectEqual, false, StartsWith(trimmed, "1234"));
+    RunTest("EndsWith(trimmed, \"1234\")",   &pass, ExpectEqual, true,  EndsWith(trimmed, "1234"));
+    RunTest("EndsWith(\"34\", \"1234\")",    &pass, ExpectEqual, false, EndsWith(CTK_VIEW_STRING("34"), "1234"));
+
+    // Views of String and FString share their data.
+    String string = CreateString(&g_std_allocator, "string");
+    RunTest("ViewString(&string).data", &pass, ExpectEqual, (const char*)string.data, ViewString(&string).data);
+    FString<8> fstring = {};
+    PushRange(&fstring, "fstring");
+    RunTest("ViewString(&fstring)", &pass, ExpectView, "fstring", ViewString(&fstring));
+    String copy = CreateString(&g_std_allocator, GetSubstring(ViewString(&fstring), 1));
+    RunTest("CreateString(GetSubstring(&fstring, 1))", &pass, ExpectEqual, "string", &copy);
+    DestroyString(&copy);
+    DestroyString(&string);
+
+    return pass;
+}
+
+bool SplitTest() {
+    bool pass = true;
+
+    RunTest("split \"a,b,c\"",   &pass, ExpectSplit, "a|b|c",   CTK_VIEW_STRING("a,b,c"),   ',');
+    RunTest("split \"a,,b\"",    &pass, ExpectSplit, "a||b",    CTK_VIEW_STRING("a,,b"),    ',');
+    RunTest("split \",a,\"",     &pass, ExpectSplit, "|a|",     CTK_VIEW_STRING(",a,"),     ',');
+    RunTest("split \"abc\"",     &pass, ExpectSplit, "abc",     CTK_VIEW_STRING("abc"),     ',');
+    RunTest("split \"\"",        &pass, ExpectSplit, "",        CTK_VIEW_STRING(""),        ',');
+
+    // Long tokens, so delimiters are found across SIMD chunks.
+    char long_string[200] = {};
+    memset(long_string, 'x', sizeof(long_string));
+    long_string[70]  = '\n';
+    long_string[199] = '\n';
+    uint32 token_sizes[3] = {};
+    uint32 token_count = 0;
+    CTK_ITER_SPLIT(split, ViewString(long_string, sizeof(long_string)), '\n') {
+        token_sizes[Min(token_count, 2u)] = split.token.size;
+        token_count += 1;
+    }
+    RunTest("split long lines; token_count", &pass, ExpectEqual, 3u,   token_count);
+    RunTest("split long lines; token sizes", &pass, ExpectEqual, true,
+            token_sizes[0] == 70 && token_sizes[1] == 128 && token_sizes[2] == 0);
+
+    RunTest("tokenize \" a  b \"",     &pass, ExpectTokens, "a|b",       CTK_VIEW_STRING(" a  b "),       " ");
+    RunTest("tokenize \"x=1; y=2\"",   &pass, ExpectTokens, "x|1|y|2",   CTK_VIEW_STRING("x=1; y=2"),     "=; ");
+    RunTest("tokenize \"  \"",         &pass, ExpectTokens, "",          CTK_VIEW_STRING("  "),           " ");
+    RunTest("tokenize \"\\xFFa\\xFF\"", &pass, ExpectTokens, "a",        CTK_VIEW_STRING("\xFF" "a\xFF"), "\xFF");
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("ViewTest()",  &pass, ViewTest);
+    RunTest("SplitTest()", &pass, SplitTest);
+
+    return pass;
+}
+
+}
@@ -0,0 +1,214 @@
+#pragma once
+
+namespace UnicodeTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+struct UTF8Case {
+    const char* desc;
+    const char* string;
+    uint32      size;
+    bool        valid;
+};
+
+#define UTF8_CASE(DESC, LITERAL, VALID) { DESC, LITERAL, sizeof(LITERAL) - 1, VALID }
+
+/// Utils
+////////////////////////////////////////////////////////////
+// Mostly ASCII with runs of 2, 3 and 4-byte codepoints, which is what SIMD block boundaries need to be tested against.
+uint32 RandomCodepoint(uint64* random_state) {
+    uint64 random = Random64(random_state);
+    switch (random % 5) {
+        case 0:  return (uint32)(random >> 8) % 0x80;
+        case 1:  return 0x80 + (uint32)(random >> 8) % (0x800 - 0x80);
+        case 2:  {
+            uint32 codepoint = 0x800 + (uint32)(random >> 8) % (0x10000 - 0x800);
+            return IsSurrogate(codepoint) ? 0xFFFD : codepoint;
+        }
+        case 3:  return 0x10000 + (uint32)(random >> 8) % (MAX_CODEPOINT + 1 - 0x10000);
+        default: return 'a' + (uint32)(random >> 8) % 26;
+    }
+}
+
+bool ValidatorsMatch(const char* string, uint32 size, bool expected) {
+    bool pass = true;
+    pass &= ExpectEqual("Scalar_ValidateUTF8()", expected, Scalar_ValidateUTF8(string, size));
+    pass &= ExpectEqual("SSE41_ValidateUTF8()",  expected, SSE41_ValidateUTF8(string, size));
+    if (HasAVX2()) {
+        pass &= ExpectEqual("AVX2_ValidateUTF8()", expected, AVX2_ValidateUTF8(string, size));
+    }
+    return pass;
+}
+
+// Validates random strings with random byte mutations against Scalar_ValidateUTF8(), at every offset relative to SIMD
+// block boundaries.
+bool RandomStringsMatchScalar(uint32 count) {
+    uint64 random_state = RandomSeed64(1);
+    char string[256] = {};
+    for (uint32 i = 0; i < count; i += 1) {
+        uint32 size = 0;
+        uint32 max_size = 4 + (uint32)(Random64(&random_state) % (sizeof(string) - 4));
+        while (size + 4 <= max_size) {
+            size += EncodeUTF8(&string[size], RandomCodepoint(&random_state));
+        }
+
+        uint32 mutation_count = (uint32)(Random64(&random_state) % 3);
+        for (uint32 m = 0; m < mutation_count; m += 1) {
+            string[Random64(&random_state) % size] = (char)Random64(&random_state);
+        }
+
+        bool expected = Scalar_ValidateUTF8(string, size);
+        if (mutation_count == 0 && !expected) {
+            PrintLine("    unmutated string %u isn't valid", i);
+            return false;
+        }
+        if (SSE41_ValidateUTF8(string, size) != expected ||
+            (HasAVX2() && AVX2_ValidateUTF8(string, size) != expected))
+        {
+            PrintLine("    validators disagree on string %u (scalar: %s)", i, expected ? "valid" : "invalid");
+            return false;
+        }
+        if (expected && (SSE2_CountCodepoints(string, size) != Scalar_CountCodepoints(string, size) ||
+                         SSE2_GetUTF16Size(string, size)    != Scalar_GetUTF16Size(string, size) ||
+                         (HasAVX2() && AVX2_CountCodepoints(string, size) != Scalar_CountCodepoints(string, size)) ||
+                         (HasAVX2() && AVX2_GetUTF16Size(string, size)    != Scalar_GetUTF16Size(string, size))))
+        {
+            PrintLine("    SIMD codepoint count or UTF-16 size doesn't match scalar on string %u", i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Round-trips random codepoints through UTF-32 -> UTF-8 -> UTF-16 -> UTF-8 -> UTF-32.
+bool RandomCodepointsRoundTrip(uint32 count) {
+    uint64 random_state = RandomSeed64(2);
+    uint32 codepoints[300] = {};
+    for (uint32 i = 0; i < count; i += 1) {
+        uint32 codepoint_count = (uint32)(Random64(&random_state) % CTK_ARRAY_SIZE(codepoints));
+        for (uint32 c = 0; c < codepoint_count; c += 1) {
+            codepoints[c] = RandomCodepoint(&random_state);
+        }
+
+        String utf8 = CreateString(&g_std_allocator);
+        AppendUTF32(&utf8, codepoints, codepoint_count);
+        Array<uint16> utf16 = CreateUTF16Array(&g_std_allocator, &utf8);
+        String utf8_from_utf16 = CreateString(&g_std_allocator);
+        AppendUTF16(&utf8_from_utf16, utf16.data, utf16.count);
+        Array<uint32> utf32 = CreateUTF32Array(&g_std_allocator, &utf8_from_utf16);
+
+        bool match = StringsMatch(&utf8, &utf8_from_utf16) &&
+                     utf8.count == utf8.size &&
+                     CountCodepoints(&utf8) == codepoint_count &&
+                     utf32.count == codepoint_count &&
+                     memcmp(utf32.data, codepoints, codepoint_count * sizeof(uint32)) == 0;
+        DestroyArray(&utf32);
+        DestroyString(&utf8_from_utf16);
+        DestroyArray(&utf16);
+        DestroyString(&utf8);
+        if (!match) {
+            PrintLine("    codepoint set %u doesn't round-trip", i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+bool ValidateTest() {
+    bool pass = true;
+
+    UTF8Case cases[] = {
+        UTF8_CASE("empty",                           "",                                 true),
+        UTF8_CASE("ASCII",                           "hello, world",                     true),
+        UTF8_CASE("2-byte",                          "caf\xC3\xA9",                      true),
+        UTF8_CASE("3-byte",                          "\xE2\x82\xAC 100",                 true),
+        UTF8_CASE("4-byte",                          "\xF0\x9F\x98\x80",                 true),
+        UTF8_CASE("U+FFFF",                          "\xEF\xBF\xBF",                     true),
+        UTF8_CASE("U+10FFFF",                        "\xF4\x8F\xBF\xBF",                 true),
+        UTF8_CASE("lone continuation",               "a\x80" "b",                        false),
+        UTF8_CASE("2 continuations",                 "\xC3\xA9\xA9",                     false),
+        UTF8_CASE("truncated 2-byte",                "ab\xC3",                           false),
+        UTF8_CASE("truncated 3-byte",                "\xE2\x82",                         false),
+        UTF8_CASE("truncated 4-byte then ASCII",     "\xF0\x9F\x98" "a",                 false),
+        UTF8_CASE("overlong 2-byte",                 "\xC1\xBF",                         false),
+        UTF8_CASE("overlong 3-byte",                 "\xE0\x9F\xBF",                     false),
+        UTF8_CASE("overlong 4-byte",                 "\xF0\x8F\xBF\xBF",                 false),
+        UTF8_CASE("surrogate",                       "\xED\xA0\x80",                     false),
+        UTF8_CASE("past U+10FFFF",                   "\xF4\x90\x80\x80",                 false),
+        UTF8_CASE("0xF5 lead",                       "\xF5\x80\x80\x80",                 false),
+        UTF8_CASE("0xFF",                            "\xFF",                             false),
+        UTF8_CASE("valid across 16-byte boundary",   "0123456789abcd\xF0\x9F\x98\x80",   true),
+        UTF8_CASE("truncated at 16-byte boundary",   "0123456789abcde\xC3",              false),
+        UTF8_CASE("truncated at 32-byte boundary",   "0123456789abcdef0123456789abcde\xE2", false),
+        UTF8_CASE("truncated before ASCII block",    "0123456789abcde\xE2" "0123456789abcdef", false),
+    };
+    CTK_ITER_ARRAY(utf8_case, cases) {
+        RunTest(utf8_case->desc, &pass, ValidatorsMatch, utf8_case->string, utf8_case->size, utf8_case->valid);
+    }
+
+    RunTest("random strings match Scalar_ValidateUTF8()", &pass, RandomStringsMatchScalar, 100000u);
+
+    return pass;
+}
+
+bool TranscodeTest() {
+    bool pass = true;
+
+    char encoded[4] = {};
+    RunTest("EncodeUTF8(0x7F)",     &pass, ExpectEqual, 1u, EncodeUTF8(encoded, 0x7F));
+    RunTest("EncodeUTF8(0x80)",     &pass, ExpectEqual, 2u, EncodeUTF8(encoded, 0x80));
+    RunTest("EncodeUTF8(0x20AC)",   &pass, ExpectEqual, 3u, EncodeUTF8(encoded, 0x20AC));
+    RunTest("0x20AC bytes",         &pass, ExpectEqual, "\xE2\x82\xAC", 3u, (const char*)encoded, 3u);
+    RunTest("EncodeUTF8(0x1F600)",  &pass, ExpectEqual, 4u, EncodeUTF8(encoded, 0x1F600));
+    RunTest("0x1F600 bytes",        &pass, ExpectEqual, "\xF0\x9F\x98\x80", 4u, (const char*)encoded, 4u);
+
+    const char* mixed = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+    RunTest("CountCodepoints(mixed)", &pass, ExpectEqual, 4u, CountCodepoints(mixed, StringSize(mixed)));
+    RunTest("GetUTF16Size(mixed)",    &pass, ExpectEqual, 5u, GetUTF16Size(mixed, StringSize(mixed)));
+
+    uint16 unpaired[] = { 'a', 0xD83D, 'b' };
+    uint16 reversed[] = { 0xDE00, 0xD83D };
+    uint32 surrogate[] = { 0xD800 };
+    uint32 too_large[] = { MAX_CODEPOINT + 1 };
+    RunTest("GetUTF8Size(unpaired)",  &pass, ExpectEqual, UTF_INVALID, GetUTF8Size(unpaired,  3u));
+    RunTest("GetUTF8Size(reversed)",  &pass, ExpectEqual, UTF_INVALID, GetUTF8Size(reversed,  2u));
+    RunTest("GetUTF8Size(surrogate)", &pass, ExpectEqual, UTF_INVALID, GetUTF8Size(surrogate, 1u));
+    RunTest("GetUTF8Size(too_large)", &pass, ExpectEqual, UTF_INVALID, GetUTF8Size(too_large, 1u));
+
+    String string = CreateString(&g_std_allocator);
+    RunTest<Func<void, String*, const uint16*, uint32>>(
+        "AppendUTF16(&string, unpaired, 3)", &pass, ExpectFatalError,
+        AppendUTF16, &string, (const uint16*)unpaired, 3u);
+    RunTest<Func<Array<uint16>, Allocator*, const char*, uint32>>(
+        "CreateUTF16Array(\"\\xC3\")", &pass, ExpectFatalError, CreateUTF16Array, &g_std_allocator, "\xC3", 1u);
+
+    // Strings without an allocator can't grow.
+    char wrapped_data[3] = {};
+    String wrapped = WrapString(wrapped_data, sizeof(wrapped_data));
+    Clear(&wrapped);
+    uint32 euro[] = { 0x20AC };
+    AppendUTF32(&wrapped, euro, 1);
+    RunTest("AppendUTF32(&wrapped, euro)", &pass, ExpectEqual, "\xE2\x82\xAC", &wrapped);
+    RunTest<Func<void, String*, const uint32*, uint32>>(
+        "AppendUTF32(&wrapped, euro) (full)", &pass, ExpectFatalError, AppendUTF32, &wrapped, (const uint32*)euro, 1u);
+    DestroyString(&string);
+
+    RunTest("random codepoints round-trip", &pass, RandomCodepointsRoundTrip, 10000u);
+
+    return pass;
+}
+
+bool Run() {
+    bool pass = true;
+
+    RunTest("ValidateTest()",  &pass, ValidateTest);
+    RunTest("TranscodeTest()", &pass, TranscodeTest);
+
+    return pass;
+}
+
+}
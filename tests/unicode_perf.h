@@ -0,0 +1,99 @@
+#pragma once
+
+namespace UnicodePerfTest {
+
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 TEXT_SIZE   = 16 * 1024 * 1024;
+constexpr uint32 TEST_PASSES = 10;
+
+struct Text {
+    const char* desc;
+    char*       data;
+    uint32      size;
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+
+// Fills text with codepoints, non_ascii_percent of which are in [min_codepoint, max_codepoint).
+Text CreateText(const char* desc, uint32 non_ascii_percent, uint32 min_codepoint, uint32 max_codepoint) {
+    Text text = {};
+    text.desc = desc;
+    text.data = AllocateNZ<char>(&g_std_allocator, TEXT_SIZE);
+    text.size = 0;
+
+    uint64 random_state = RandomSeed64(1);
+    while (text.size + 4 <= TEXT_SIZE) {
+        uint64 random = Random64(&random_state);
+        uint32 codepoint = (uint32)(random % 100) < non_ascii_percent
+                           ? min_codepoint + (uint32)((random >> 8) % (max_codepoint - min_codepoint))
+                           : 'a' + (uint32)((random >> 8) % 26);
+        text.size += EncodeUTF8(&text.data[text.size], IsSurrogate(codepoint) ? 0xFFFD : codepoint);
+    }
+
+    return text;
+}
+
+/// Tests
+////////////////////////////////////////////////////////////
+void ValidatePerfTest(Text* text) {
+    PerfUtils::ProfileFunc<bool, const char*, uint32>("Scalar_ValidateUTF8()", text->size, TEST_PASSES,
+                                                      Scalar_ValidateUTF8, text->data, text->size);
+    if (HasSSE41()) {
+        PerfUtils::ProfileFunc<bool, const char*, uint32>("SSE41_ValidateUTF8()", text->size, TEST_PASSES,
+                                                          SSE41_ValidateUTF8, text->data, text->size);
+    }
+    if (HasAVX2()) {
+        PerfUtils::ProfileFunc<bool, const char*, uint32>("AVX2_ValidateUTF8()", text->size, TEST_PASSES,
+                                                          AVX2_ValidateUTF8, text->data, text->size);
+    }
+}
+
+void CountPerfTest(Text* text) {
+    PerfUtils::ProfileFunc<uint32, const char*, uint32>("Scalar_CountCodepoints()", text->size, TEST_PASSES,
+                                                        Scalar_CountCodepoints, text->data, text->size);
+    PerfUtils::ProfileFunc<uint32, const char*, uint32>("SSE2_CountCodepoints()", text->size, TEST_PASSES,
+                                                        SSE2_CountCodepoints, text->data, text->size);
+    if (HasAVX2()) {
+        PerfUtils::ProfileFunc<uint32, const char*, uint32>("AVX2_CountCodepoints()", text->size, TEST_PASSES,
+                                                            AVX2_CountCodepoints, text->data, text->size);
+    }
+}
+
+void TranscodePerfTest(Text* text) {
+    uint32 utf16_size = GetUTF16Size(text->data, text->size);
+    auto utf16 = AllocateNZ<uint16>(&g_std_allocator, utf16_size);
+    auto utf8  = AllocateNZ<char>(&g_std_allocator, text->size);
+    PerfUtils::ProfileFunc<uint32, const char*, uint32, uint16*>("Scalar_UTF8ToUTF16()", text->size, TEST_PASSES,
+                                                                 Scalar_UTF8ToUTF16, text->data, text->size, utf16);
+    PerfUtils::ProfileFunc<uint32, const char*, uint32, uint16*>("SSE2_UTF8ToUTF16()", text->size, TEST_PASSES,
+                                                                 SSE2_UTF8ToUTF16, text->data, text->size, utf16);
+    PerfUtils::ProfileFunc<uint32, const uint16*, uint32, char*>("Scalar_UTF16ToUTF8()", text->size, TEST_PASSES,
+                                                                 Scalar_UTF16ToUTF8, (const uint16*)utf16, utf16_size,
+                                                                 utf8);
+    PerfUtils::ProfileFunc<uint32, const uint16*, uint32, char*>("SSE2_UTF16ToUTF8()", text->size, TEST_PASSES,
+                                                                 SSE2_UTF16ToUTF8, (const uint16*)utf16, utf16_size,
+                                                                 utf8);
+    Deallocate(&g_std_allocator, utf8);
+    Deallocate(&g_std_allocator, utf16);
+}
+
+void Run() {
+    Text texts[] = {
+        CreateText("ASCII",                          0,   0,       0x80),
+        CreateText("Latin (10% 2-byte)",             10,  0xC0,    0x180),
+        CreateText("CJK (90% 3-byte)",               90,  0x4E00,  0xA000),
+        CreateText("emoji (50% 4-byte)",             50,  0x1F300, 0x1FA00),
+    };
+
+    CTK_ITER_ARRAY(text, texts) {
+        PrintLine("\nUTF-8 Performance Test: %s (%u MB)", text->desc, text->size / (1024 * 1024));
+        ValidatePerfTest(text);
+        CountPerfTest(text);
+        TranscodePerfTest(text);
+        Deallocate(&g_std_allocator, text->data);
+    }
+}
+
+}
@@ -0,0 +1,714 @@
+/// Data
+////////////////////////////////////////////////////////////
+constexpr uint32 MAX_CODEPOINT = 0x10FFFF;
+
+// Returned by size functions for input that isn't valid UTF-16/UTF-32.
+constexpr uint32 UTF_INVALID = UINT32_MAX;
+
+// Keiser-Lemire UTF-8 validation: every error in a sequence is visible in its first 2 bytes, except for missing or
+// extra continuation bytes. Each error flag is set in all 3 lookup tables (indexed by the first byte's high and low
+// nibbles and the second byte's high nibble) only for byte pairs that form that error, so ANDing the 3 lookups leaves
+// only the errors present.
+constexpr uint8 UTF8_TOO_SHORT      = 1 << 0; // 11______ 0_______ or 11______ 11______
+constexpr uint8 UTF8_TOO_LONG       = 1 << 1; // 0_______ 10______
+constexpr uint8 UTF8_OVERLONG_3     = 1 << 2; // 11100000 100_____
+constexpr uint8 UTF8_TOO_LARGE      = 1 << 3; // 11110100 1001____ or 11110100 101_____ or 11110101+ 1001____+
+constexpr uint8 UTF8_SURROGATE      = 1 << 4; // 11101101 101_____
+constexpr uint8 UTF8_OVERLONG_2     = 1 << 5; // 1100000_ 10______
+constexpr uint8 UTF8_TOO_LARGE_1000 = 1 << 6; // 11110101+ 1000____
+constexpr uint8 UTF8_OVERLONG_4     = 1 << 6; // 11110000 1000____
+constexpr uint8 UTF8_TWO_CONTS      = 1 << 7; // 10______ 10______; cleared where 3/4-byte sequences expect them.
+constexpr uint8 UTF8_CARRY          = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS;
+
+alignas(16) constexpr uint8 UTF8_BYTE_1_HIGH[16] = {
+    // 0_______: ASCII
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    // 10______: continuation
+    UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+    // 1100____: 2-byte lead
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+    // 1101____: 2-byte lead
+    UTF8_TOO_SHORT,
+    // 1110____: 3-byte lead
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+    // 1111____: 4-byte lead
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+};
+
+alignas(16) constexpr uint8 UTF8_BYTE_1_LOW[16] = {
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,   // ____0000
+    UTF8_CARRY | UTF8_OVERLONG_2,                                       // ____0001
+    UTF8_CARRY,                                                         // ____0010
+    UTF8_CARRY,                                                         // ____0011
+    UTF8_CARRY | UTF8_TOO_LARGE,                                        // ____0100
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                  // ____0101
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                  // ____0110
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                  // ____0111
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                  // ____1000
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                  // ____1001
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                  // ____1010
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                  // ____1011
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                  // ____1100
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE, // ____1101
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                  // ____1110
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                  // ____1111
+};
+
+alignas(16) constexpr uint8 UTF8_BYTE_2_HIGH[16] = {
+    // ________ 0_______: ASCII
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    // ________ 1000____
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+    // ________ 1001____
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+    // ________ 101_____
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    // ________ 11______
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+};
+
+/// Utils
+////////////////////////////////////////////////////////////
+bool IsContinuationByte(uint8 byte) {
+    return (byte & 0xC0) == 0x80;
+}
+
+bool IsSurrogate(uint32 unit) {
+    return unit >= 0xD800 && unit <= 0xDFFF;
+}
+
+// Assumes bytes start a valid sequence; returns sequence size.
+uint32 DecodeUTF8(const uint8* bytes, uint32* codepoint) {
+    uint8 lead = bytes[0];
+    if (lead < 0x80) {
+        *codepoint = lead;
+        return 1;
+    }
+    if (lead < 0xE0) {
+        *codepoint = ((lead & 0x1Fu) << 6) | (bytes[1] & 0x3Fu);
+        return 2;
+    }
+    if (lead < 0xF0) {
+        *codepoint = ((lead & 0x0Fu) << 12) | ((bytes[1] & 0x3Fu) << 6) | (bytes[2] & 0x3Fu);
+        return 3;
+    }
+    *codepoint = ((lead & 0x07u) << 18) | ((bytes[1] & 0x3Fu) << 12) | ((bytes[2] & 0x3Fu) << 6) | (bytes[3] & 0x3Fu);
+    return 4;
+}
+
+// Assumes units start a valid sequence; returns sequence size.
+uint32 DecodeUTF16(const uint16* units, uint32* codepoint) {
+    if (units[0] < 0xD800 || units[0] > 0xDBFF) {
+        *codepoint = units[0];
+        return 1;
+    }
+    *codepoint = 0x10000 + (((uint32)units[0] - 0xD800) << 10) + ((uint32)units[1] - 0xDC00);
+    return 2;
+}
+
+// Returns number of units written.
+uint32 EncodeUTF16(uint16* units, uint32 codepoint) {
+    if (codepoint < 0x10000) {
+        units[0] = (uint16)codepoint;
+        return 1;
+    }
+    codepoint -= 0x10000;
+    units[0] = (uint16)(0xD800 + (codepoint >> 10));
+    units[1] = (uint16)(0xDC00 + (codepoint & 0x3FF));
+    return 2;
+}
+
+// Writes codepoint's UTF-8 encoding (1-4 bytes) to buffer and returns its size. Codepoint must be <= MAX_CODEPOINT.
+uint32 EncodeUTF8(char* buffer, uint32 codepoint) {
+    CTK_ASSERT(codepoint <= MAX_CODEPOINT);
+
+    if (codepoint < 0x80) {
+        buffer[0] = (char)codepoint;
+        return 1;
+    }
+    if (codepoint < 0x800) {
+        buffer[0] = (char)(0xC0 | (codepoint >> 6));
+        buffer[1] = (char)(0x80 | (codepoint & 0x3F));
+        return 2;
+    }
+    if (codepoint < 0x10000) {
+        buffer[0] = (char)(0xE0 | (codepoint >> 12));
+        buffer[1] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+        buffer[2] = (char)(0x80 | (codepoint & 0x3F));
+        return 3;
+    }
+    buffer[0] = (char)(0xF0 | (codepoint >> 18));
+    buffer[1] = (char)(0x80 | ((codepoint >> 12) & 0x3F));
+    buffer[2] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+    buffer[3] = (char)(0x80 | (codepoint & 0x3F));
+    return 4;
+}
+
+/// Scalar Implementations
+////////////////////////////////////////////////////////////
+
+// Checks sequences against the well-formed byte sequence table in the Unicode standard (section 3.9).
+bool Scalar_ValidateUTF8(const char* string, uint32 size) {
+    const uint8* bytes = (const uint8*)string;
+    uint32 i = 0;
+    while (i < size) {
+        uint8 lead = bytes[i];
+        if (lead < 0x80) {
+            i += 1;
+            continue;
+        }
+
+        uint32 sequence_size = 0;
+        uint8 min_second = 0x80;
+        uint8 max_second = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            sequence_size = 2;
+        }
+        else if (lead >= 0xE0 && lead <= 0xEF) {
+            sequence_size = 3;
+            min_second = lead == 0xE0 ? 0xA0 : 0x80; // Overlong.
+            max_second = lead == 0xED ? 0x9F : 0xBF; // Surrogate.
+        }
+        else if (lead >= 0xF0 && lead <= 0xF4) {
+            sequence_size = 4;
+            min_second = lead == 0xF0 ? 0x90 : 0x80; // Overlong.
+            max_second = lead == 0xF4 ? 0x8F : 0xBF; // Past MAX_CODEPOINT.
+        }
+        else {
+            return false;
+        }
+
+        if (sequence_size > size - i || bytes[i + 1] < min_second || bytes[i + 1] > max_second) {
+            return false;
+        }
+        for (uint32 j = 2; j < sequence_size; j += 1) {
+            if (!IsContinuationByte(bytes[i + j])) {
+                return false;
+            }
+        }
+        i += sequence_size;
+    }
+
+    return true;
+}
+
+uint32 Scalar_CountCodepoints(const char* string, uint32 size) {
+    uint32 count = 0;
+    for (uint32 i = 0; i < size; i += 1) {
+        count += IsContinuationByte((uint8)string[i]) ? 0 : 1;
+    }
+    return count;
+}
+
+// 1 unit per codepoint, plus 1 for the second half of each surrogate pair (4-byte sequences).
+uint32 Scalar_GetUTF16Size(const char* string, uint32 size) {
+    uint32 unit_count = 0;
+    for (uint32 i = 0; i < size; i += 1) {
+        uint8 byte = (uint8)string[i];
+        unit_count += (IsContinuationByte(byte) ? 0 : 1) + (byte >= 0xF0 ? 1 : 0);
+    }
+    return unit_count;
+}
+
+uint32 Scalar_UTF8ToUTF16(const char* string, uint32 size, uint16* utf16) {
+    const uint8* bytes = (const uint8*)string;
+    uint32 unit_count = 0;
+    for (uint32 i = 0; i < size;) {
+        uint32 codepoint = 0;
+        i += DecodeUTF8(&bytes[i], &codepoint);
+        unit_count += EncodeUTF16(&utf16[unit_count], codepoint);
+    }
+    return unit_count;
+}
+
+uint32 Scalar_UTF8ToUTF32(const char* string, uint32 size, uint32* utf32) {
+    const uint8* bytes = (const uint8*)string;
+    uint32 codepoint_count = 0;
+    for (uint32 i = 0; i < size; codepoint_count += 1) {
+        i += DecodeUTF8(&bytes[i], &utf32[codepoint_count]);
+    }
+    return codepoint_count;
+}
+
+uint32 Scalar_UTF16ToUTF8(const uint16* utf16, uint32 unit_count, char* string) {
+    uint32 size = 0;
+    for (uint32 i = 0; i < unit_count;) {
+        uint32 codepoint = 0;
+        i += DecodeUTF16(&utf16[i], &codepoint);
+        size += EncodeUTF8(&string[size], codepoint);
+    }
+    return size;
+}
+
+uint32 Scalar_UTF32ToUTF8(const uint32* utf32, uint32 codepoint_count, char* string) {
+    uint32 size = 0;
+    for (uint32 i = 0; i < codepoint_count; i += 1) {
+        size += EncodeUTF8(&string[size], utf32[i]);
+    }
+    return size;
+}
+
+/// SSE2 Implementations
+////////////////////////////////////////////////////////////
+
+// Continuation bytes are 0x80-0xBF, which are -128 to -65 as signed bytes.
+uint32 SSE2_CountCodepoints(const char* string, uint32 size) {
+    __m128i max_continuation = _mm_set1_epi8(-65);
+    uint32 count = 0;
+    uint32 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)&string[i]);
+        count += PopCount((uint32)_mm_movemask_epi8(_mm_cmpgt_epi8(bytes, max_continuation)));
+    }
+
+    return count + Scalar_CountCodepoints(&string[i], size - i);
+}
+
+uint32 SSE2_GetUTF16Size(const char* string, uint32 size) {
+    __m128i max_continuation = _mm_set1_epi8(-65);
+    __m128i four_byte_lead   = _mm_set1_epi8((char)0xF0);
+    uint32 unit_count = 0;
+    uint32 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)&string[i]);
+        __m128i is_four_byte_lead = _mm_cmpeq_epi8(_mm_max_epu8(bytes, four_byte_lead), bytes);
+        unit_count += PopCount((uint32)_mm_movemask_epi8(_mm_cmpgt_epi8(bytes, max_continuation)));
+        unit_count += PopCount((uint32)_mm_movemask_epi8(is_four_byte_lead));
+    }
+
+    return unit_count + Scalar_GetUTF16Size(&string[i], size - i);
+}
+
+// SIMD transcoders widen/narrow runs of 16 ASCII chars at a time, and fall back to scalar for one sequence at a time
+// otherwise. Non-ASCII text is usually runs of ASCII (markup, spaces, digits) between non-ASCII sequences.
+uint32 SSE2_UTF8ToUTF16(const char* string, uint32 size, uint16* utf16) {
+    const uint8* bytes = (const uint8*)string;
+    __m128i zero = _mm_setzero_si128();
+    uint32 unit_count = 0;
+    uint32 i = 0;
+    while (i < size) {
+        if (i + 16 <= size) {
+            __m128i chars = _mm_loadu_si128((const __m128i*)&bytes[i]);
+            if (_mm_movemask_epi8(chars) == 0) {
+                _mm_storeu_si128((__m128i*)&utf16[unit_count],     _mm_unpacklo_epi8(chars, zero));
+                _mm_storeu_si128((__m128i*)&utf16[unit_count + 8], _mm_unpackhi_epi8(chars, zero));
+                unit_count += 16;
+                i += 16;
+                continue;
+            }
+        }
+
+        // After a non-ASCII block, convert 64 bytes of sequences with scalar code before checking for ASCII again, so
+        // mixed text only pays for a failed check once per 64 bytes.
+        for (uint32 block_end = Min(i + 64, size); i < block_end;) {
+            uint32 codepoint = 0;
+            i += DecodeUTF8(&bytes[i], &codepoint);
+            unit_count += EncodeUTF16(&utf16[unit_count], codepoint);
+        }
+    }
+    return unit_count;
+}
+
+uint32 SSE2_UTF8ToUTF32(const char* string, uint32 size, uint32* utf32) {
+    const uint8* bytes = (const uint8*)string;
+    __m128i zero = _mm_setzero_si128();
+    uint32 codepoint_count = 0;
+    uint32 i = 0;
+    while (i < size) {
+        if (i + 16 <= size) {
+            __m128i chars = _mm_loadu_si128((const __m128i*)&bytes[i]);
+            if (_mm_movemask_epi8(chars) == 0) {
+                __m128i low  = _mm_unpacklo_epi8(chars, zero);
+                __m128i high = _mm_unpackhi_epi8(chars, zero);
+                __m128i* dst = (__m128i*)&utf32[codepoint_count];
+                _mm_storeu_si128(dst,     _mm_unpacklo_epi16(low,  zero));
+                _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(low,  zero));
+                _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(high, zero));
+                codepoint_count += 16;
+                i += 16;
+                continue;
+            }
+        }
+
+        for (uint32 block_end = Min(i + 64, size); i < block_end; codepoint_count += 1) {
+            i += DecodeUTF8(&bytes[i], &utf32[codepoint_count]);
+        }
+    }
+    return codepoint_count;
+}
+
+uint32 SSE2_UTF16ToUTF8(const uint16* utf16, uint32 unit_count, char* string) {
+    __m128i non_ascii_bits = _mm_set1_epi16((sint16)0xFF80);
+    uint32 size = 0;
+    uint32 i = 0;
+    while (i < unit_count) {
+        if (i + 16 <= unit_count) {
+            __m128i low  = _mm_loadu_si128((const __m128i*)&utf16[i]);
+            __m128i high = _mm_loadu_si128((const __m128i*)&utf16[i + 8]);
+            __m128i non_ascii = _mm_and_si128(_mm_or_si128(low, high), non_ascii_bits);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(non_ascii, _mm_setzero_si128())) == 0xFFFF) {
+                _mm_storeu_si128((__m128i*)&string[size], _mm_packus_epi16(low, high));
+                size += 16;
+                i += 16;
+                continue;
+            }
+        }
+
+        for (uint32 block_end = Min(i + 64, unit_count); i < block_end;) {
+            uint32 codepoint = 0;
+            i += DecodeUTF16(&utf16[i], &codepoint);
+            size += EncodeUTF8(&string[size], codepoint);
+        }
+    }
+    return size;
+}
+
+uint32 SSE2_UTF32ToUTF8(const uint32* utf32, uint32 codepoint_count, char* string) {
+    __m128i non_ascii_bits = _mm_set1_epi32((sint32)0xFFFFFF80);
+    uint32 size = 0;
+    uint32 i = 0;
+    while (i < codepoint_count) {
+        if (i + 16 <= codepoint_count) {
+            const __m128i* src = (const __m128i*)&utf32[i];
+            __m128i a = _mm_loadu_si128(src);
+            __m128i b = _mm_loadu_si128(src + 1);
+            __m128i c = _mm_loadu_si128(src + 2);
+            __m128i d = _mm_loadu_si128(src + 3);
+            __m128i non_ascii = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), non_ascii_bits);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(non_ascii, _mm_setzero_si128())) == 0xFFFF) {
+                // Values are < 0x80, so signed saturation never clamps.
+                __m128i low  = _mm_packs_epi32(a, b);
+                __m128i high = _mm_packs_epi32(c, d);
+                _mm_storeu_si128((__m128i*)&string[size], _mm_packus_epi16(low, high));
+                size += 16;
+                i += 16;
+                continue;
+            }
+        }
+
+        for (uint32 block_end = Min(i + 64, codepoint_count); i < block_end; i += 1) {
+            size += EncodeUTF8(&string[size], utf32[i]);
+        }
+    }
+    return size;
+}
+
+/// SSE4.1 Implementations
+////////////////////////////////////////////////////////////
+__m128i SSE41_HighNibbles(__m128i bytes) {
+    return _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F));
+}
+
+__m128i SSE41_LoadTable(const uint8* table) {
+    return _mm_load_si128((const __m128i*)table);
+}
+
+// Returns non-zero bytes where block has errors, given the last 3 bytes of prev_block (or zeros for the first block).
+__m128i SSE41_CheckUTF8Block(__m128i block, __m128i prev_block) {
+    __m128i prev1 = _mm_alignr_epi8(block, prev_block, 15);
+    __m128i byte_1_high = _mm_shuffle_epi8(SSE41_LoadTable(UTF8_BYTE_1_HIGH), SSE41_HighNibbles(prev1));
+    __m128i byte_1_low  = _mm_shuffle_epi8(SSE41_LoadTable(UTF8_BYTE_1_LOW), _mm_and_si128(prev1, _mm_set1_epi8(0x0F)));
+    __m128i byte_2_high = _mm_shuffle_epi8(SSE41_LoadTable(UTF8_BYTE_2_HIGH), SSE41_HighNibbles(block));
+    __m128i special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+    // Bytes 3 and 4 of 3/4-byte sequences must be continuations, which TWO_CONTS flagged as errors.
+    __m128i prev2 = _mm_alignr_epi8(block, prev_block, 14);
+    __m128i prev3 = _mm_alignr_epi8(block, prev_block, 13);
+    __m128i is_third_byte  = _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 0x80)));
+    __m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 0x80)));
+    __m128i must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte),
+                                                 _mm_set1_epi8((char)0x80));
+    return _mm_xor_si128(must_be_continuation, special_cases);
+}
+
+// Non-zero bytes where block ends with an incomplete sequence, which is an error if no more bytes follow.
+__m128i SSE41_CheckUTF8Incomplete(__m128i block) {
+    __m128i max_complete = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                         (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+    return _mm_subs_epu8(block, max_complete);
+}
+
+bool SSE41_ValidateUTF8(const char* string, uint32 size) {
+    __m128i error            = _mm_setzero_si128();
+    __m128i prev_block       = _mm_setzero_si128();
+    __m128i prev_incomplete  = _mm_setzero_si128();
+    uint32 i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)&string[i]);
+        if (_mm_movemask_epi8(block) == 0) {
+            // ASCII block is only an error if the previous block ended mid-sequence.
+            error = _mm_or_si128(error, prev_incomplete);
+        }
+        else {
+            error = _mm_or_si128(error, SSE41_CheckUTF8Block(block, prev_block));
+            prev_incomplete = SSE41_CheckUTF8Incomplete(block);
+        }
+        prev_block = block;
+    }
+
+    if (i < size) {
+        // Pad tail with ASCII zeros, which never continue a sequence, so a truncated sequence is still an error.
+        alignas(16) char tail[16] = {};
+        memcpy(tail, &string[i], size - i);
+        __m128i block = _mm_load_si128((const __m128i*)tail);
+        error = _mm_or_si128(error, SSE41_CheckUTF8Block(block, prev_block));
+    }
+    else {
+        error = _mm_or_si128(error, prev_incomplete);
+    }
+
+    return _mm_testz_si128(error, error) != 0;
+}
+
+/// AVX2 Implementations
+////////////////////////////////////////////////////////////
+__m256i AVX2_HighNibbles(__m256i bytes) {
+    return _mm256_and_si256(_mm256_srli_epi16(bytes, 4), _mm256_set1_epi8(0x0F));
+}
+
+__m256i AVX2_LoadTable(const uint8* table) {
+    return _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)table));
+}
+
+// Same as SSE41_CheckUTF8Block(). alignr only shifts within 128-bit lanes, so each lane is shifted against the lane
+// before it: the previous block's high lane for the low lane, and this block's low lane for the high lane.
+__m256i AVX2_CheckUTF8Block(__m256i block, __m256i prev_block) {
+    __m256i lane_before = _mm256_permute2x128_si256(prev_block, block, 0x21);
+    __m256i prev1 = _mm256_alignr_epi8(block, lane_before, 15);
+    __m256i byte_1_high = _mm256_shuffle_epi8(AVX2_LoadTable(UTF8_BYTE_1_HIGH), AVX2_HighNibbles(prev1));
+    __m256i byte_1_low  = _mm256_shuffle_epi8(AVX2_LoadTable(UTF8_BYTE_1_LOW),
+                                              _mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)));
+    __m256i byte_2_high = _mm256_shuffle_epi8(AVX2_LoadTable(UTF8_BYTE_2_HIGH), AVX2_HighNibbles(block));
+    __m256i special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+    __m256i prev2 = _mm256_alignr_epi8(block, lane_before, 14);
+    __m256i prev3 = _mm256_alignr_epi8(block, lane_before, 13);
+    __m256i is_third_byte  = _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+    __m256i is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+    __m256i must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte),
+                                                    _mm256_set1_epi8((char)0x80));
+    return _mm256_xor_si256(must_be_continuation, special_cases);
+}
+
+__m256i AVX2_CheckUTF8Incomplete(__m256i block) {
+    __m256i max_complete = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                            (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+    return _mm256_subs_epu8(block, max_complete);
+}
+
+bool AVX2_ValidateUTF8(const char* string, uint32 size) {
+    __m256i error           = _mm256_setzero_si256();
+    __m256i prev_block      = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+    uint32 i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)&string[i]);
+        if (_mm256_movemask_epi8(block) == 0) {
+            error = _mm256_or_si256(error, prev_incomplete);
+        }
+        else {
+            error = _mm256_or_si256(error, AVX2_CheckUTF8Block(block, prev_block));
+            prev_incomplete = AVX2_CheckUTF8Incomplete(block);
+        }
+        prev_block = block;
+    }
+
+    if (i < size) {
+        alignas(32) char tail[32] = {};
+        memcpy(tail, &string[i], size - i);
+        __m256i block = _mm256_load_si256((const __m256i*)tail);
+        error = _mm256_or_si256(error, AVX2_CheckUTF8Block(block, prev_block));
+    }
+    else {
+        error = _mm256_or_si256(error, prev_incomplete);
+    }
+
+    return _mm256_testz_si256(error, error) != 0;
+}
+
+uint32 AVX2_CountCodepoints(const char* string, uint32 size) {
+    __m256i max_continuation = _mm256_set1_epi8(-65);
+    uint32 count = 0;
+    uint32 i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)&string[i]);
+        count += PopCount((uint32)_mm256_movemask_epi8(_mm256_cmpgt_epi8(bytes, max_continuation)));
+    }
+
+    return count + SSE2_CountCodepoints(&string[i], size - i);
+}
+
+uint32 AVX2_GetUTF16Size(const char* string, uint32 size) {
+    __m256i max_continuation = _mm256_set1_epi8(-65);
+    __m256i four_byte_lead   = _mm256_set1_epi8((char)0xF0);
+    uint32 unit_count = 0;
+    uint32 i = 0;
+    for (; i + 32 <= size; i += 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)&string[i]);
+        __m256i is_four_byte_lead = _mm256_cmpeq_epi8(_mm256_max_epu8(bytes, four_byte_lead), bytes);
+        unit_count += PopCount((uint32)_mm256_movemask_epi8(_mm256_cmpgt_epi8(bytes, max_continuation)));
+        unit_count += PopCount((uint32)_mm256_movemask_epi8(is_four_byte_lead));
+    }
+
+    return unit_count + SSE2_GetUTF16Size(&string[i], size - i);
+}
+
+/// Interface
+////////////////////////////////////////////////////////////
+
+// SIMD implementations are selected at runtime via CPUID; SSE2 is always available on x64.
+bool ValidateUTF8(const char* string, uint32 size) {
+    return HasAVX2()  ? AVX2_ValidateUTF8(string, size)  :
+           HasSSE41() ? SSE41_ValidateUTF8(string, size) :
+                        Scalar_ValidateUTF8(string, size);
+}
+
+bool ValidateUTF8(StringView string) {
+    return ValidateUTF8(string.data, string.size);
+}
+
+bool ValidateUTF8(String* string) {
+    return ValidateUTF8(string->data, string->count);
+}
+
+// String must be valid UTF-8.
+uint32 CountCodepoints(const char* string, uint32 size) {
+    return HasAVX2() ? AVX2_CountCodepoints(string, size) : SSE2_CountCodepoints(string, size);
+}
+
+uint32 CountCodepoints(StringView string) {
+    return CountCodepoints(string.data, string.size);
+}
+
+uint32 CountCodepoints(String* string) {
+    return CountCodepoints(string->data, string->count);
+}
+
+// Exact number of UTF-16 units needed to transcode string, which must be valid UTF-8.
+uint32 GetUTF16Size(const char* string, uint32 size) {
+    return HasAVX2() ? AVX2_GetUTF16Size(string, size) : SSE2_GetUTF16Size(string, size);
+}
+
+// Exact number of UTF-8 bytes needed to transcode utf16, or UTF_INVALID if utf16 has unpaired surrogates.
+uint32 GetUTF8Size(const uint16* utf16, uint32 unit_count) {
+    uint32 size = 0;
+    for (uint32 i = 0; i < unit_count; i += 1) {
+        uint16 unit = utf16[i];
+        if (unit < 0x80) {
+            size += 1;
+        }
+        else if (unit < 0x800) {
+            size += 2;
+        }
+        else if (!IsSurrogate(unit)) {
+            size += 3;
+        }
+        else if (unit <= 0xDBFF && i + 1 < unit_count && utf16[i + 1] >= 0xDC00 && utf16[i + 1] <= 0xDFFF) {
+            size += 4;
+            i += 1;
+        }
+        else {
+            return UTF_INVALID;
+        }
+    }
+    return size;
+}
+
+// Exact number of UTF-8 bytes needed to transcode utf32, or UTF_INVALID if utf32 has surrogates or values past
+// MAX_CODEPOINT.
+uint32 GetUTF8Size(const uint32* utf32, uint32 codepoint_count) {
+    uint32 size = 0;
+    for (uint32 i = 0; i < codepoint_count; i += 1) {
+        uint32 codepoint = utf32[i];
+        if (codepoint > MAX_CODEPOINT || IsSurrogate(codepoint)) {
+            return UTF_INVALID;
+        }
+        size += codepoint < 0x80 ? 1 : codepoint < 0x800 ? 2 : codepoint < 0x10000 ? 3 : 4;
+    }
+    return size;
+}
+
+// Raw transcoders: input must be valid, and output must have room for the sizes returned by GetUTF16Size(),
+// CountCodepoints() and GetUTF8Size(). Each returns the number of units written.
+uint32 UTF8ToUTF16(const char* string, uint32 size, uint16* utf16) {
+    return SSE2_UTF8ToUTF16(string, size, utf16);
+}
+
+uint32 UTF8ToUTF32(const char* string, uint32 size, uint32* utf32) {
+    return SSE2_UTF8ToUTF32(string, size, utf32);
+}
+
+uint32 UTF16ToUTF8(const uint16* utf16, uint32 unit_count, char* string) {
+    return SSE2_UTF16ToUTF8(utf16, unit_count, string);
+}
+
+uint32 UTF32ToUTF8(const uint32* utf32, uint32 codepoint_count, char* string) {
+    return SSE2_UTF32ToUTF8(utf32, codepoint_count, string);
+}
+
+// Validates string, then transcodes it into an array allocated at its exact UTF-16 size.
+Array<uint16> CreateUTF16Array(Allocator* allocator, const char* string, uint32 size) {
+    if (!ValidateUTF8(string, size)) {
+        CTK_FATAL("can't transcode string to UTF-16: string isn't valid UTF-8");
+    }
+
+    Array<uint16> utf16 = CreateArrayFull<uint16>(allocator, GetUTF16Size(string, size));
+    UTF8ToUTF16(string, size, utf16.data);
+    return utf16;
+}
+
+Array<uint16> CreateUTF16Array(Allocator* allocator, String* string) {
+    return CreateUTF16Array(allocator, string->data, string->count);
+}
+
+Array<uint32> CreateUTF32Array(Allocator* allocator, const char* string, uint32 size) {
+    if (!ValidateUTF8(string, size)) {
+        CTK_FATAL("can't transcode string to UTF-32: string isn't valid UTF-8");
+    }
+
+    Array<uint32> utf32 = CreateArrayFull<uint32>(allocator, CountCodepoints(string, size));
+    UTF8ToUTF32(string, size, utf32.data);
+    return utf32;
+}
+
+Array<uint32> CreateUTF32Array(Allocator* allocator, String* string) {
+    return CreateUTF32Array(allocator, string->data, string->count);
+}
+
+// Transcodes utf16 to UTF-8 and appends it to string, growing string to exactly fit if it has an allocator.
+void AppendUTF16(String* string, const uint16* utf16, uint32 unit_count) {
+    uint32 utf8_size = GetUTF8Size(utf16, unit_count);
+    if (utf8_size == UTF_INVALID) {
+        CTK_FATAL("can't append UTF-16 to string: UTF-16 has unpaired surrogates");
+    }
+    if (string->size - string->count < utf8_size) {
+        if (string->allocator == NULL) {
+            CTK_FATAL("can't append %u UTF-8 bytes to string: string has %u available bytes", utf8_size,
+                      string->size - string->count);
+        }
+        ResizeNZ(string, string->count + utf8_size);
+    }
+
+    string->count += UTF16ToUTF8(utf16, unit_count, &string->data[string->count]);
+}
+
+void AppendUTF32(String* string, const uint32* utf32, uint32 codepoint_count) {
+    uint32 utf8_size = GetUTF8Size(utf32, codepoint_count);
+    if (utf8_size == UTF_INVALID) {
+        CTK_FATAL("can't append UTF-32 to string: UTF-32 has surrogates or codepoints past 0x%X", MAX_CODEPOINT);
+    }
+    if (string->size - string->count < utf8_size) {
+        if (string->allocator == NULL) {
+            CTK_FATAL("can't append %u UTF-8 bytes to string: string has %u available bytes", utf8_size,
+                      string->size - string->count);
+        }
+        ResizeNZ(string, string->count + utf8_size);
+    }
+
+    string->count += UTF32ToUTF8(utf32, codepoint_count, &string->data[string->count]);
+}